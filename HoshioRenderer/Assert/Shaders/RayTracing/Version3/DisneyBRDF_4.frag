@@ -1,5 +1,6 @@
 #version 460 core
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out vec4 GBuffer; // xyz: GeoNormal, w: view depth (<0: sky)
 
 in vec3 CanvasPos; 
 
@@ -45,6 +46,7 @@ layout(std430, binding = 1) buffer Morton3DBuffer { uvec2 SortedMorton3D[]; };
 layout(std430, binding = 2) buffer LBVHNodeBuffer { LBVHNode LBVHNodes[]; };
 layout(std430, binding = 3) buffer AuxiliaryBuffer { ivec4 Root; };
 layout(std430, binding = 4) buffer EncodedBRDFMaterialSSBO{ EncodedBRDFMaterial Materials[]; };
+layout(std430, binding = 6) buffer SobolDirectionBuffer { uint SobolDirections[]; };
 
 layout(std140, binding = 5) uniform CameraBlock {
     vec4 AspectAndFovy; // x: Aspect, y: Fovy
@@ -52,23 +54,66 @@ layout(std140, binding = 5) uniform CameraBlock {
     vec4 Right;
     vec4 Up;
     vec4 Front;
+    mat4 PrevViewProj;
 } UCameraParam;
 
+layout(std140, binding = 6) uniform FrameBlock {
+    uvec2 uResolution;
+    uint uFrameCounter;
+    uint uSobolDimensionCount;
+    int uLBVHNodeCount;
+    int uReprojectHistory;
+    float uHistoryClamp;
+    float uSampleLimit;
+};
+
 uniform sampler2D uLastFrame;
 uniform sampler2D uSkybox;
 uniform sampler2D uHDRCache;
-uniform int uLBVHNodeCount;
-uniform uint uFrameCounter;
-uniform uvec2 uResolution; 
 
+uniform sampler2D uLastGBuffer;
+
+// 由 KH_ShaderFeatureBase::UpdatePermutation 注入宏时，开关特化为编译期常量
+#ifdef KH_ENABLE_SOBOL
+const int uEnableSobol = KH_ENABLE_SOBOL;
+#else
 uniform int uEnableSobol;
+#endif
+#ifdef KH_ENABLE_SKYBOX
+const int uEnableSkybox = KH_ENABLE_SKYBOX;
+#else
 uniform int uEnableSkybox;
+#endif
+#ifdef KH_ENABLE_IMPORTANCE_SAMPLING
+const int uEnableImportanceSampling = KH_ENABLE_IMPORTANCE_SAMPLING;
+#else
 uniform int uEnableImportanceSampling;
+#endif
+#ifdef KH_ENABLE_MIS
+const int uEnableMIS = KH_ENABLE_MIS;
+#else
 uniform int uEnableMIS;
+#endif
+#ifdef KH_ALLOW_SINGLE_IS
+const int uAllowSingleIS = KH_ALLOW_SINGLE_IS;
+#else
 uniform int uAllowSingleIS;
+#endif
+#ifdef KH_ENABLE_DIFFUSE_IS
+const int uEnableDiffuseIS = KH_ENABLE_DIFFUSE_IS;
+#else
 uniform int uEnableDiffuseIS;
+#endif
+#ifdef KH_ENABLE_SPECULAR_IS
+const int uEnableSpecularIS = KH_ENABLE_SPECULAR_IS;
+#else
 uniform int uEnableSpecularIS;
+#endif
+#ifdef KH_ENABLE_CLEARCOAT_IS
+const int uEnableClearcoatIS = KH_ENABLE_CLEARCOAT_IS;
+#else
 uniform int uEnableClearcoatIS;
+#endif
 
 const vec3 SkyColor = vec3(0.05, 0.05, 0.05);
 
@@ -94,125 +139,6 @@ struct HitResult {
 
 uint rngState;
 
-const uint V[16*32] = {
-	2147483648, 1073741824, 536870912, 268435456, 134217728, 67108864, 33554432, 
-	16777216, 8388608, 4194304, 2097152, 1048576, 524288, 262144, 131072, 65536, 
-	32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8, 4, 2, 1,
-	2147483648, 3221225472, 2684354560, 4026531840, 2281701376, 3422552064, 
-	2852126720, 4278190080, 2155872256, 3233808384, 2694840320, 4042260480, 
-	2290614272, 3435921408, 2863267840, 4294901760, 2147516416, 3221274624, 
-	2684395520, 4026593280, 2281736192, 3422604288, 2852170240, 4278255360, 
-	2155905152, 3233857728, 2694881440, 4042322160, 2290649224, 3435973836, 
-	2863311530, 4294967295,
-	2147483648, 3221225472, 1610612736, 2415919104, 3892314112, 1543503872, 
-	2382364672, 3305111552, 1753219072, 2629828608, 3999268864, 1435500544, 
-	2154299392, 3231449088, 1626210304, 2421489664, 3900735488, 1556135936, 
-	2388680704, 3314585600, 1751705600, 2627492864, 4008611328, 1431684352, 
-	2147543168, 3221249216, 1610649184, 2415969680, 3892340840, 1543543964, 
-	2382425838, 3305133397,
-	2147483648, 3221225472, 536870912, 1342177280, 4160749568, 1946157056, 
-	2717908992, 2466250752, 3632267264, 624951296, 1507852288, 3872391168, 
-	2013790208, 3020685312, 2181169152, 3271884800, 546275328, 1363623936, 
-	4226424832, 1977167872, 2693105664, 2437829632, 3689389568, 635137280, 
-	1484783744, 3846176960, 2044723232, 3067084880, 2148008184, 3222012020, 
-	537002146, 1342505107,
-	2147483648, 1073741824, 536870912, 2952790016, 4160749568, 3690987520, 
-	2046820352, 2634022912, 1518338048, 801112064, 2707423232, 4038066176, 
-	3666345984, 1875116032, 2170683392, 1085997056, 579305472, 3016343552, 
-	4217741312, 3719483392, 2013407232, 2617981952, 1510979072, 755882752, 
-	2726789248, 4090085440, 3680870432, 1840435376, 2147625208, 1074478300, 
-	537900666, 2953698205,
-	2147483648, 1073741824, 1610612736, 805306368, 2818572288, 335544320, 
-	2113929216, 3472883712, 2290089984, 3829399552, 3059744768, 1127219200, 
-	3089629184, 4199809024, 3567124480, 1891565568, 394297344, 3988799488, 
-	920674304, 4193267712, 2950604800, 3977188352, 3250028032, 129093376, 
-	2231568512, 2963678272, 4281226848, 432124720, 803643432, 1633613396, 
-	2672665246, 3170194367,
-	2147483648, 3221225472, 2684354560, 3489660928, 1476395008, 2483027968, 
-	1040187392, 3808428032, 3196059648, 599785472, 505413632, 4077912064, 
-	1182269440, 1736704000, 2017853440, 2221342720, 3329785856, 2810494976, 
-	3628507136, 1416089600, 2658719744, 864310272, 3863387648, 3076993792, 
-	553150080, 272922560, 4167467040, 1148698640, 1719673080, 2009075780, 
-	2149644390, 3222291575,
-	2147483648, 1073741824, 2684354560, 1342177280, 2281701376, 1946157056, 
-	436207616, 2566914048, 2625634304, 3208642560, 2720006144, 2098200576, 
-	111673344, 2354315264, 3464626176, 4027383808, 2886631424, 3770826752, 
-	1691164672, 3357462528, 1993345024, 3752330240, 873073152, 2870150400, 
-	1700563072, 87021376, 1097028000, 1222351248, 1560027592, 2977959924, 
-	23268898, 437609937,
-    2147483648, 1073741824, 2684354560, 1342177280, 671088640, 3556769792,
-    1778384896, 1895825408, 947912704, 1480589312, 3927965696, 823132160,
-    2561146880, 139722752, 3257532416, 3844407296, 4071784448, 2034778112,
-    4205060096, 3178434560, 413665280, 1213465600, 1646922240, 3039102208,
-    3669131904, 2907196736, 2426676896, 3430094608, 539495304, 269746564,
-    2282357922, 2218067473,
-    2147483648, 1073741824, 3758096384, 2952790016, 2550136832, 2483027968,
-    2315255808, 1526726656, 864026624, 3653238784, 1914699776, 1058013184,
-    3250061312, 2800484352, 1401290752, 703922176, 171606016, 455786496,
-    3549618176, 1778348032, 3929540608, 2871788544, 1269173760, 4259646208,
-    1610779008, 4026976576, 2016733344, 605713840, 305826616, 3475687836,
-    3113412898, 2197780721,
-    2147483648, 1073741824, 2684354560, 268435456, 134217728, 1811939328,
-    2650800128, 587202560, 1468006400, 2915041280, 2141192192, 2446327808,
-    1233649664, 3470000128, 2282356736, 739180544, 1041072128, 857194496,
-    1605394432, 3254300672, 3784148992, 3000484864, 504392192, 1663611136,
-    4152723584, 3183723200, 2008703968, 4260868912, 3615493624, 3988785180,
-    3751805978, 2177894957,
-    2147483648, 1073741824, 536870912, 805306368, 1476395008, 2885681152,
-    2516582400, 721420288, 3565158400, 155189248, 3802136576, 1380974592,
-    1311244288, 3340500992, 1654521856, 308740096, 1846771712, 4147232768,
-    983080960, 3192164352, 4164651008, 3693986816, 3993412096, 3072561920,
-    447221120, 2388397760, 2688420704, 1882653104, 2017167560, 2620246612,
-    3456542538, 2267256725,
-    2147483648, 3221225472, 2684354560, 1342177280, 4160749568, 2348810240,
-    3791650816, 855638016, 260046848, 557842432, 2510290944, 1584398336,
-    3624402944, 472121344, 3122003968, 4013359104, 361136128, 2658123776,
-    2015059968, 1278513152, 1108248576, 1661717504, 4155337216, 2910033152,
-    2004879232, 1832912064, 3617588256, 1030751792, 797446008, 2976123604,
-    3451258746, 2185692887,
-    2147483648, 3221225472, 1610612736, 2415919104, 939524096, 3288334336,
-    1107296256, 2734686208, 4051697664, 2856321024, 4242538496, 2232418304,
-    3758620672, 1342963712, 1476788224, 1409875968, 2047049728, 1728856064,
-    3011780608, 155856896, 225384448, 794469376, 484953600, 3574878464,
-    3087007872, 67109056, 570425440, 855638160, 3380609080, 1849688260,
-    3202351170, 638582947,
-    2147483648, 1073741824, 536870912, 4026531840, 2818572288, 1409286144,
-    2583691264, 2634022912, 511705088, 1556086784, 2099249152, 2366636032,
-    612892672, 1908670464, 3953262592, 1977548800, 1805811712, 902905856,
-    1269014528, 3318927360, 3819005952, 2447084544, 2041508352, 215957760,
-    1730838656, 1343569984, 436314144, 3708670192, 1048832168, 2898971732,
-    3576517274, 3642593693,
-    2147483648, 3221225472, 536870912, 3489660928, 3623878656, 3288334336,
-    1174405120, 2231369728, 2776629248, 1992294400, 2912944128, 1789919232,
-    765984768, 2864447488, 229244928, 2058420224, 3584524288, 3200073728,
-    2476990464, 1001721856, 908703744, 1299348480, 2609078784, 667211520,
-    3056187520, 2373090496, 3145949728, 4156872656, 1848227928, 1232239620,
-    4253246054, 1925502805
-};
-
-uint GrayCode(uint i) {
-	return i ^ (i>>1);
-}
-
-float Sobol(uint d, uint i) {
-	uint result = 0;
-	uint offset = d * 32;
-	for(uint j = 0; i > 0; i >>= 1, j++) 
-	{
-		if((i & 1) == 1)
-			result ^= V[j+offset];
-	}
-
-	return float(result) * (1.0f/float(0xFFFFFFFFU));
-}
-
-vec2 SobolVec2(uint i, uint b) {
-	float u = Sobol(b*2, GrayCode(i));
-	float v = Sobol(b*2+1, GrayCode(i));
-	return vec2(u, v);
-}
-
-
 void InitRNG()
 {
     uvec2 fc = uvec2(gl_FragCoord.xy);
@@ -234,21 +160,49 @@ float rand()
     return float(rngState) / 4294967296.0;
 }
 
-float UintTo01(uint x)
+// Burley 2020, Practical Hash-based Owen Scrambling
+uint LaineKarrasPermutation(uint x, uint seed)
+{
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return x;
+}
+
+uint NestedUniformScramble(uint x, uint seed)
 {
-    return float(x) / 4294967296.0;
+    x = bitfieldReverse(x);
+    x = LaineKarrasPermutation(x, seed);
+    return bitfieldReverse(x);
 }
 
-vec2 PixelRotation(uvec2 pix, uint bounce)
+uint SobolSample(uint index, uint dim)
 {
-    uint s0 = wang_hash(pix.x * 1973u ^ pix.y * 9277u ^ bounce * 26699u ^ 0x68bc21ebu);
-    uint s1 = wang_hash(s0 ^ 0x02e5be93u);
-    return vec2(UintTo01(s0), UintTo01(s1));
+    uint result = 0u;
+    uint offset = dim * 32u;
+    for (uint j = 0u; index != 0u; index >>= 1u, j++)
+    {
+        if ((index & 1u) != 0u)
+            result ^= SobolDirections[offset + j];
+    }
+    return result;
 }
 
-vec2 CranleyPattersonRotation(vec2 sobol2, uvec2 pix, uint bounce)
+// 像素级打乱样本序号，再对每一维独立做 Owen scrambling
+vec2 OwenSobolVec2(uint index, uint pair, uvec2 pix)
 {
-    return fract(sobol2 + PixelRotation(pix, bounce));
+    uint dim = pair * 2u;
+    if (dim + 1u >= uSobolDimensionCount)
+        return vec2(rand(), rand());
+
+    uint seed = wang_hash(pix.x * 1973u ^ pix.y * 9277u ^ 0x68bc21ebu);
+    uint shuffled = NestedUniformScramble(index, seed);
+
+    uint u = NestedUniformScramble(SobolSample(shuffled, dim), wang_hash(seed ^ (dim * 0x9e3779b9u)));
+    uint v = NestedUniformScramble(SobolSample(shuffled, dim + 1u), wang_hash(seed ^ ((dim + 1u) * 0x9e3779b9u)));
+    return vec2(float(u >> 8), float(v >> 8)) / 16777216.0;
 }
 
 BRDFMaterial DecodeBRDFMaterial(int MaterialSlotID)
@@ -815,14 +769,46 @@ SampleBRDFResult SampleSingleIS(float xi_1, float xi_2, vec3 V, vec3 Ns, int Mat
     return result;
 }
 
+// uHDRCache 为 2D alias 表（布局见 KH_Texture.cpp BuildEnvAliasTable），O(1) 采样
 vec3 FetchHDRCache(float xi1, float xi2)
 {
-    ivec2 size = textureSize(uHDRCache, 0);
-    ivec2 p = ivec2(
-        min(int(xi1 * float(size.x)), size.x - 1),
-        min(int(xi2 * float(size.y)), size.y - 1)
-    );
-    return texelFetch(uHDRCache, p, 0).rgb;
+    ivec2 size = textureSize(uSkybox, 0);
+
+    float fv = xi2 * float(size.y);
+    int v = min(int(fv), size.y - 1);
+    float rv = fv - float(v);
+
+    vec4 marginal = texelFetch(uHDRCache, ivec2(v % size.x, size.y + v / size.x), 0);
+    if (rv < marginal.x)
+    {
+        rv = rv / marginal.x;
+    }
+    else
+    {
+        v = int(marginal.y);
+        rv = (rv - marginal.x) / max(1.0 - marginal.x, 1e-6);
+    }
+
+    float fu = xi1 * float(size.x);
+    int u = min(int(fu), size.x - 1);
+    float ru = fu - float(u);
+
+    vec4 conditional = texelFetch(uHDRCache, ivec2(u, v), 0);
+    float pdfUV = conditional.z;
+    if (ru < conditional.x)
+    {
+        ru = ru / conditional.x;
+    }
+    else
+    {
+        u = int(conditional.y);
+        ru = (ru - conditional.x) / max(1.0 - conditional.x, 1e-6);
+        pdfUV = conditional.w;
+    }
+
+    // 复用剩余的随机数在 texel 内抖动
+    vec2 uv = (vec2(u, v) + clamp(vec2(ru, rv), 0.0, 0.99999)) / vec2(size);
+    return vec3(uv, pdfUV);
 }
 
 
@@ -865,12 +851,13 @@ float BRDF_PDF_Eval(vec3 wi, vec3 V, vec3 Ns, int MaterialSlotID)
 float EnvPdf_Eval(vec3 wi)
 {
     vec2 uv = SampleSphericalMap(normalize(wi));
-    ivec2 size = textureSize(uHDRCache, 0);
+    ivec2 size = textureSize(uSkybox, 0);
     ivec2 p = ivec2(
         min(int(uv.x * float(size.x)), size.x - 1),
         min(int(uv.y * float(size.y)), size.y - 1)
     );
-    float pdfUV = texelFetch(uHDRCache, p, 0).a;
+    // .z 为本 texel 的 pdf，.w 是 alias 的 pdf
+    float pdfUV = texelFetch(uHDRCache, p, 0).z;
 
     float elev = PI * (uv.y - 0.5);
     float sinThetaPolar = max(cos(elev), 1e-6);
@@ -940,6 +927,11 @@ vec3 SampleHDR(float xi_env1, float xi_env2,  vec3 V, HitResult hit_result){
 
 
 
+const float ReprojectionDepthTolerance = 0.05;
+const float ReprojectionNormalTolerance = 0.9;
+
+HitResult PrimaryHit;
+
 vec3 PathTracing(Ray ray, int maxBounce)
 {
     vec3 finalColor = vec3(0.0);
@@ -959,6 +951,8 @@ vec3 PathTracing(Ray ray, int maxBounce)
     for (int bounce = 0; bounce < maxBounce; bounce++)
     {
         HitResult hit_result = HitBVH(currRay);
+        if (bounce == 0)
+            PrimaryHit = hit_result;
         vec3 V  = -currRay.Direction;
 
         if (!hit_result.bIsHit)
@@ -1000,12 +994,10 @@ vec3 PathTracing(Ray ray, int maxBounce)
 
         if (uEnableSobol == 1)
         {
-            vec2 sobol2 = SobolVec2(uFrameCounter + 1u, 2 * bounce);
-            vec2 p = CranleyPattersonRotation(sobol2, pix, 2 * bounce);
+            vec2 p = OwenSobolVec2(uFrameCounter, uint(2 * bounce), pix);
             xi_brdf1 = p.x;
             xi_brdf2 = p.y;
-            sobol2 = SobolVec2(uFrameCounter + 1u, 2 * bounce + 1);
-            p = CranleyPattersonRotation(sobol2, pix, 2 * bounce + 1);
+            p = OwenSobolVec2(uFrameCounter, uint(2 * bounce + 1), pix);
             xi_env1 = p.x;
             xi_env2 = p.y;
         }
@@ -1059,6 +1051,57 @@ vec3 PathTracing(Ray ray, int maxBounce)
     return finalColor;
 }
 
+vec4 EncodeGBuffer(vec3 PrimaryDirection)
+{
+    if (!PrimaryHit.bIsHit)
+        return vec4(PrimaryDirection, -1.0);
+
+    float ViewDepth = dot(PrimaryHit.HitPoint - UCameraParam.Position.xyz, UCameraParam.Front.xyz);
+    return vec4(normalize(PrimaryHit.GeoNormal), ViewDepth);
+}
+
+// 用上一帧的 ViewProj 把当前主光线命中点投影回上一帧，深度/法线不一致视为遮挡变化
+bool ReprojectHistory(vec3 PrimaryDirection, out vec4 History)
+{
+    History = vec4(0.0);
+
+    // 未命中时按无穷远方向投影，只受相机旋转影响
+    vec4 PrevClip = PrimaryHit.bIsHit
+        ? UCameraParam.PrevViewProj * vec4(PrimaryHit.HitPoint, 1.0)
+        : UCameraParam.PrevViewProj * vec4(PrimaryDirection, 0.0);
+
+    if (PrevClip.w <= 1e-6)
+        return false;
+
+    vec2 PrevUV = PrevClip.xy / PrevClip.w * 0.5 + 0.5;
+    if (any(lessThan(PrevUV, vec2(0.0))) || any(greaterThanEqual(PrevUV, vec2(1.0))))
+        return false;
+
+    ivec2 PrevPix = ivec2(PrevUV * vec2(uResolution));
+    vec4 PrevGBuffer = texelFetch(uLastGBuffer, PrevPix, 0);
+
+    if (!PrimaryHit.bIsHit)
+    {
+        if (PrevGBuffer.w >= 0.0)
+            return false;
+    }
+    else
+    {
+        if (PrevGBuffer.w < 0.0)
+            return false;
+
+        float DepthError = abs(PrevGBuffer.w - PrevClip.w) / max(PrevClip.w, 1e-4);
+        if (DepthError > ReprojectionDepthTolerance)
+            return false;
+
+        if (dot(PrevGBuffer.xyz, normalize(PrimaryHit.GeoNormal)) < ReprojectionNormalTolerance)
+            return false;
+    }
+
+    History = texelFetch(uLastFrame, PrevPix, 0);
+    return true;
+}
+
 void main()
 {
     InitRNG();
@@ -1070,10 +1113,27 @@ void main()
     vec4 Color = vec4(PathTracing(ray, 4), 1.0);
     ivec2 pix = ivec2(gl_FragCoord.xy);
 
-    vec4 LastFrameColor = texelFetch(uLastFrame, pix , 0);
+    GBuffer = EncodeGBuffer(ray.Direction);
+
+    // LastFrameColor.a 记录该像素已累积的样本数
+    vec4 LastFrameColor = vec4(0.0);
+    if (uFrameCounter > 0u)
+    {
+        if (uReprojectHistory == 1)
+        {
+            if (ReprojectHistory(ray.Direction, LastFrameColor))
+                LastFrameColor.a = min(LastFrameColor.a, uHistoryClamp);
+        }
+        else
+        {
+            LastFrameColor = texelFetch(uLastFrame, pix, 0);
+        }
+    }
+
+    float SampleCount = LastFrameColor.a;
 
-    if(uFrameCounter < 4096)
-        FragColor = mix(LastFrameColor, Color, 1.0/float(uFrameCounter+1));
+    if (SampleCount < uSampleLimit)
+        FragColor = vec4(mix(LastFrameColor.rgb, Color.rgb, 1.0 / (SampleCount + 1.0)), SampleCount + 1.0);
     else
         FragColor = LastFrameColor;
  
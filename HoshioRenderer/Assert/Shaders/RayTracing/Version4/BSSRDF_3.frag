@@ -1,5 +1,6 @@
 #version 460 core
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out vec4 GBuffer; // xyz: GeoNormal, w: view depth (<0: sky)
 
 in vec3 CanvasPos; 
 
@@ -37,21 +38,36 @@ layout(std140, binding = 5) uniform CameraBlock {
     vec4 Right;
     vec4 Up;
     vec4 Front;
+    mat4 PrevViewProj;
 } UCameraParam;
 
+layout(std140, binding = 6) uniform FrameBlock {
+    uvec2 uResolution;
+    uint uFrameCounter;
+    uint uSobolDimensionCount;
+    int uLBVHNodeCount;
+    int uReprojectHistory;
+    float uHistoryClamp;
+    float uSampleLimit;
+};
+
 layout(std430, binding = 6) buffer InvertCDFSSBO {float InvertCDF[]; };
 
 uniform sampler2D uLastFrame;
 uniform sampler2D uSkybox;
 uniform sampler2D uHDRCache;
-uniform int uLBVHNodeCount;
-uniform uint uFrameCounter;
-uniform uvec2 uResolution; 
+
+uniform sampler2D uLastGBuffer;
 
 uniform int uInvertCDFResolution;
 //uniform float uRmax;
 
+// 由 KH_ShaderFeatureBase::UpdatePermutation 注入宏时，开关特化为编译期常量
+#ifdef KH_ENABLE_SKYBOX
+const int uEnableSkybox = KH_ENABLE_SKYBOX;
+#else
 uniform int uEnableSkybox;
+#endif
 
 const vec3 SkyColor = vec3(0.005, 0.005, 0.005);
 
@@ -454,25 +470,58 @@ HitResult HitBVH(Ray ray)
 
 float sqr(float x) { return x*x; }
 
+// uHDRCache 为 2D alias 表（布局见 KH_Texture.cpp BuildEnvAliasTable），O(1) 采样
 vec3 FetchHDRCache(float xi1, float xi2)
 {
-    ivec2 size = textureSize(uHDRCache, 0);
-    ivec2 p = ivec2(
-        min(int(xi1 * float(size.x)), size.x - 1),
-        min(int(xi2 * float(size.y)), size.y - 1)
-    );
-    return texelFetch(uHDRCache, p, 0).rgb;
+    ivec2 size = textureSize(uSkybox, 0);
+
+    float fv = xi2 * float(size.y);
+    int v = min(int(fv), size.y - 1);
+    float rv = fv - float(v);
+
+    vec4 marginal = texelFetch(uHDRCache, ivec2(v % size.x, size.y + v / size.x), 0);
+    if (rv < marginal.x)
+    {
+        rv = rv / marginal.x;
+    }
+    else
+    {
+        v = int(marginal.y);
+        rv = (rv - marginal.x) / max(1.0 - marginal.x, 1e-6);
+    }
+
+    float fu = xi1 * float(size.x);
+    int u = min(int(fu), size.x - 1);
+    float ru = fu - float(u);
+
+    vec4 conditional = texelFetch(uHDRCache, ivec2(u, v), 0);
+    float pdfUV = conditional.z;
+    if (ru < conditional.x)
+    {
+        ru = ru / conditional.x;
+    }
+    else
+    {
+        u = int(conditional.y);
+        ru = (ru - conditional.x) / max(1.0 - conditional.x, 1e-6);
+        pdfUV = conditional.w;
+    }
+
+    // 复用剩余的随机数在 texel 内抖动
+    vec2 uv = (vec2(u, v) + clamp(vec2(ru, rv), 0.0, 0.99999)) / vec2(size);
+    return vec3(uv, pdfUV);
 }
 
 float EnvPdf_Eval(vec3 wi)
 {
     vec2 uv = SampleSphericalMap(normalize(wi));
-    ivec2 size = textureSize(uHDRCache, 0);
+    ivec2 size = textureSize(uSkybox, 0);
     ivec2 p = ivec2(
         min(int(uv.x * float(size.x)), size.x - 1),
         min(int(uv.y * float(size.y)), size.y - 1)
     );
-    float pdfUV = texelFetch(uHDRCache, p, 0).a;
+    // .z 为本 texel 的 pdf，.w 是 alias 的 pdf
+    float pdfUV = texelFetch(uHDRCache, p, 0).z;
 
     float elev = PI * (uv.y - 0.5);
     float sinThetaPolar = max(cos(elev), 1e-6);
@@ -971,6 +1020,11 @@ SampleBSSRDFResult SampleBSSRDF(vec3 po, vec3 No, int materialSlot)
     return result;
 }
 
+const float ReprojectionDepthTolerance = 0.05;
+const float ReprojectionNormalTolerance = 0.9;
+
+HitResult PrimaryHit;
+
 vec3 PathTracing(Ray ray, int maxBounce)
 {
     vec3 finalColor = vec3(0.0);
@@ -980,6 +1034,8 @@ vec3 PathTracing(Ray ray, int maxBounce)
     for (int bounce = 0; bounce < maxBounce; bounce++)
     {
         HitResult hit_result = HitBVH(currRay);
+        if (bounce == 0)
+            PrimaryHit = hit_result;
         vec3 V = -currRay.Direction;
 
         if (!hit_result.bIsHit)
@@ -1024,6 +1080,57 @@ vec3 PathTracing(Ray ray, int maxBounce)
     return finalColor;
 }
 
+vec4 EncodeGBuffer(vec3 PrimaryDirection)
+{
+    if (!PrimaryHit.bIsHit)
+        return vec4(PrimaryDirection, -1.0);
+
+    float ViewDepth = dot(PrimaryHit.HitPoint - UCameraParam.Position.xyz, UCameraParam.Front.xyz);
+    return vec4(normalize(PrimaryHit.GeoNormal), ViewDepth);
+}
+
+// 用上一帧的 ViewProj 把当前主光线命中点投影回上一帧，深度/法线不一致视为遮挡变化
+bool ReprojectHistory(vec3 PrimaryDirection, out vec4 History)
+{
+    History = vec4(0.0);
+
+    // 未命中时按无穷远方向投影，只受相机旋转影响
+    vec4 PrevClip = PrimaryHit.bIsHit
+        ? UCameraParam.PrevViewProj * vec4(PrimaryHit.HitPoint, 1.0)
+        : UCameraParam.PrevViewProj * vec4(PrimaryDirection, 0.0);
+
+    if (PrevClip.w <= 1e-6)
+        return false;
+
+    vec2 PrevUV = PrevClip.xy / PrevClip.w * 0.5 + 0.5;
+    if (any(lessThan(PrevUV, vec2(0.0))) || any(greaterThanEqual(PrevUV, vec2(1.0))))
+        return false;
+
+    ivec2 PrevPix = ivec2(PrevUV * vec2(uResolution));
+    vec4 PrevGBuffer = texelFetch(uLastGBuffer, PrevPix, 0);
+
+    if (!PrimaryHit.bIsHit)
+    {
+        if (PrevGBuffer.w >= 0.0)
+            return false;
+    }
+    else
+    {
+        if (PrevGBuffer.w < 0.0)
+            return false;
+
+        float DepthError = abs(PrevGBuffer.w - PrevClip.w) / max(PrevClip.w, 1e-4);
+        if (DepthError > ReprojectionDepthTolerance)
+            return false;
+
+        if (dot(PrevGBuffer.xyz, normalize(PrimaryHit.GeoNormal)) < ReprojectionNormalTolerance)
+            return false;
+    }
+
+    History = texelFetch(uLastFrame, PrevPix, 0);
+    return true;
+}
+
 void main()
 {
     InitRNG();
@@ -1035,10 +1142,27 @@ void main()
     vec4 Color = vec4(PathTracing(ray, 4), 1.0);
     ivec2 pix = ivec2(gl_FragCoord.xy);
 
-    vec4 LastFrameColor = texelFetch(uLastFrame, pix , 0);
+    GBuffer = EncodeGBuffer(ray.Direction);
+
+    // LastFrameColor.a 记录该像素已累积的样本数
+    vec4 LastFrameColor = vec4(0.0);
+    if (uFrameCounter > 0u)
+    {
+        if (uReprojectHistory == 1)
+        {
+            if (ReprojectHistory(ray.Direction, LastFrameColor))
+                LastFrameColor.a = min(LastFrameColor.a, uHistoryClamp);
+        }
+        else
+        {
+            LastFrameColor = texelFetch(uLastFrame, pix, 0);
+        }
+    }
+
+    float SampleCount = LastFrameColor.a;
 
-    if(uFrameCounter < 20480)
-        FragColor = mix(LastFrameColor, Color, 1.0/float(uFrameCounter+1));
+    if (SampleCount < uSampleLimit)
+        FragColor = vec4(mix(LastFrameColor.rgb, Color.rgb, 1.0 / (SampleCount + 1.0)), SampleCount + 1.0);
     else
         FragColor = LastFrameColor;
 }
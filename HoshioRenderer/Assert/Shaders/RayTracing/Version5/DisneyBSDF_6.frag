@@ -1,5 +1,6 @@
 #version 460 core
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out vec4 GBuffer; // xyz: GeoNormal, w: view depth (<0: sky)
 
 in vec3 CanvasPos; 
 
@@ -47,6 +48,7 @@ layout(std430, binding = 1) buffer Morton3DBuffer { uvec2 SortedMorton3D[]; };
 layout(std430, binding = 2) buffer LBVHNodeBuffer { LBVHNode LBVHNodes[]; };
 layout(std430, binding = 3) buffer AuxiliaryBuffer { ivec4 Root; };
 layout(std430, binding = 4) buffer EncodedBSDFMaterialSSBO{ EncodedBSDFMaterial Materials[]; };
+layout(std430, binding = 6) buffer SobolDirectionBuffer { uint SobolDirections[]; };
 
 layout(std140, binding = 5) uniform CameraBlock {
     vec4 AspectAndFovy; // x: Aspect, y: Fovy
@@ -54,17 +56,41 @@ layout(std140, binding = 5) uniform CameraBlock {
     vec4 Right;
     vec4 Up;
     vec4 Front;
+    mat4 PrevViewProj;
 } UCameraParam;
 
+layout(std140, binding = 6) uniform FrameBlock {
+    uvec2 uResolution;
+    uint uFrameCounter;
+    uint uSobolDimensionCount;
+    int uLBVHNodeCount;
+    int uReprojectHistory;
+    float uHistoryClamp;
+    float uSampleLimit;
+};
+
 uniform sampler2D uLastFrame;
 uniform sampler2D uSkybox;
 uniform sampler2D uHDRCache;
-uniform int uLBVHNodeCount;
-uniform uint uFrameCounter;
-uniform uvec2 uResolution; 
 
+uniform sampler2D uLastGBuffer;
+
+// 由 KH_ShaderFeatureBase::UpdatePermutation 注入宏时，开关特化为编译期常量
+#ifdef KH_ENABLE_VNDF
+const int uEnableVNDF = KH_ENABLE_VNDF;
+#else
 uniform int uEnableVNDF;
+#endif
+#ifdef KH_ENABLE_SKYBOX
+const int uEnableSkybox = KH_ENABLE_SKYBOX;
+#else
 uniform int uEnableSkybox;
+#endif
+#ifdef KH_ENABLE_SOBOL
+const int uEnableSobol = KH_ENABLE_SOBOL;
+#else
+uniform int uEnableSobol;
+#endif
 
 
 const vec3 SkyColor = vec3(0.05);
@@ -112,6 +138,76 @@ float rand()
     return float(rngState) / 4294967296.0;
 }
 
+// ---------------- Owen-scrambled Sobol ----------------
+// 维度分配：0-1 相机抖动，之后每次弹射固定占用 SOBOL_DIMS_PER_BOUNCE 维
+#define SOBOL_DIM_CAMERA_JITTER 0u
+#define SOBOL_DIM_BOUNCE_BASE   2u
+#define SOBOL_DIMS_PER_BOUNCE   8u
+
+#define SOBOL_DIM_BSDF_SELECT   0u  // glass / BRDF
+#define SOBOL_DIM_BSDF_LOBE     1u  // BRDF lobe, glass reflect / refract
+#define SOBOL_DIM_BSDF_DIR      2u  // 2 dims
+#define SOBOL_DIM_ENV_NEE       4u  // 2 dims
+#define SOBOL_DIM_RR            6u
+
+uint SobolPixelSeed;
+uint SobolBounceDimension;
+
+void InitSobol()
+{
+    uvec2 fc = uvec2(gl_FragCoord.xy);
+    SobolPixelSeed = wang_hash(fc.x * 1973u ^ fc.y * 9277u ^ 0x68bc21ebu);
+    SobolBounceDimension = SOBOL_DIM_BOUNCE_BASE;
+}
+
+// Burley 2020, Practical Hash-based Owen Scrambling
+uint LaineKarrasPermutation(uint x, uint seed)
+{
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return x;
+}
+
+uint NestedUniformScramble(uint x, uint seed)
+{
+    x = bitfieldReverse(x);
+    x = LaineKarrasPermutation(x, seed);
+    return bitfieldReverse(x);
+}
+
+uint SobolSample(uint index, uint dim)
+{
+    uint result = 0u;
+    uint offset = dim * 32u;
+    for (uint j = 0u; index != 0u; index >>= 1u, j++)
+    {
+        if ((index & 1u) != 0u)
+            result ^= SobolDirections[offset + j];
+    }
+    return result;
+}
+
+float SobolOwen(uint dim)
+{
+    if (uEnableSobol == 0 || dim >= uSobolDimensionCount)
+        return rand();
+
+    // 像素级打乱样本序号，再对每一维独立做 Owen scrambling
+    uint index = NestedUniformScramble(uFrameCounter, SobolPixelSeed);
+    uint x = SobolSample(index, dim);
+    x = NestedUniformScramble(x, wang_hash(SobolPixelSeed ^ (dim * 0x9e3779b9u)));
+    return float(x >> 8) / 16777216.0;
+}
+
+float SampleBounceDimension(uint offset)
+{
+    return SobolOwen(SobolBounceDimension + offset);
+}
+
+
 
 BSDFMaterial DecodeBSDFMaterial(int MaterialSlotID)
 {
@@ -283,7 +379,10 @@ vec3 GetRayDirection(vec2 uv)
 
     vec2 pixelSize = 2.0 / vec2(uResolution);
 
-    uv += pixelSize * (rand() - 0.5);
+    if (uEnableSobol == 1)
+        uv += pixelSize * (vec2(SobolOwen(SOBOL_DIM_CAMERA_JITTER), SobolOwen(SOBOL_DIM_CAMERA_JITTER + 1u)) - 0.5);
+    else
+        uv += pixelSize * (rand() - 0.5);
 
     vec3 DirWorldSpace = (uv.x * UCameraParam.AspectAndFovy.x * scale) * UCameraParam.Right.xyz +
         (uv.y * scale) * UCameraParam.Up.xyz +
@@ -888,12 +987,13 @@ float BSDF_PDF_Eval(vec3 wi, vec3 wo, vec3 Ns, float p_glass, bool bIsInside, in
 float EnvPdf_Eval(vec3 wi)
 {
     vec2 uv = SampleSphericalMap(normalize(wi));
-    ivec2 size = textureSize(uHDRCache, 0);
+    ivec2 size = textureSize(uSkybox, 0);
     ivec2 p = ivec2(
         min(int(uv.x * float(size.x)), size.x - 1),
         min(int(uv.y * float(size.y)), size.y - 1)
     );
-    float pdfUV = texelFetch(uHDRCache, p, 0).a;
+    // .z 为本 texel 的 pdf，.w 是 alias 的 pdf
+    float pdfUV = texelFetch(uHDRCache, p, 0).z;
 
     float elev = PI * (uv.y - 0.5);
     float sinThetaPolar = max(cos(elev), 1e-6);
@@ -917,9 +1017,9 @@ SampleBSDFResult SampleBRDF(vec3 V, vec3 Ns, int MaterialSlotID)
     float p_specular  = r_specular  / r_sum;
     float p_clearcoat = r_clearcoat / r_sum;
 
-    float xi_1 = rand();
-    float xi_2 = rand();
-    float xi_3 = rand();
+    float xi_1 = SampleBounceDimension(SOBOL_DIM_BSDF_DIR);
+    float xi_2 = SampleBounceDimension(SOBOL_DIM_BSDF_DIR + 1u);
+    float xi_3 = SampleBounceDimension(SOBOL_DIM_BSDF_LOBE);
 
     SampleBSDFResult result;
     result.wi = vec3(0.0);
@@ -979,10 +1079,13 @@ SampleBSDFResult SampleBSDF_Glass(vec3 wo, vec3 Ns, bool bIsInside, int Material
     result.PDF = 0.0;
 
     vec3 H;
+    float xi_1 = SampleBounceDimension(SOBOL_DIM_BSDF_DIR);
+    float xi_2 = SampleBounceDimension(SOBOL_DIM_BSDF_DIR + 1u);
+
     if(uEnableVNDF == 1)
-        H = SampleGGXVNDF_World(wo, Ns, alpha, alpha, rand(), rand());
+        H = SampleGGXVNDF_World(wo, Ns, alpha, alpha, xi_1, xi_2);
     else
-        H = SampleGTR2(rand(), rand(), Ns, alpha);
+        H = SampleGTR2(xi_1, xi_2, Ns, alpha);
 
     if (dot(wo, H) < 0.0)
         H = -H;
@@ -993,7 +1096,7 @@ SampleBSDFResult SampleBSDF_Glass(vec3 wo, vec3 Ns, bool bIsInside, int Material
     vec3 wi_refract = refract(-wo, H, eta_wo2wi);
 
     bool tir = dot(wi_refract, wi_refract) <= 1e-12;
-    float xi = rand();
+    float xi = SampleBounceDimension(SOBOL_DIM_BSDF_LOBE);
 
     if (tir || xi < Fg)
     {
@@ -1039,7 +1142,7 @@ SampleBSDFResult SampleBSDF(vec3 wo, vec3 Ns, vec3 Ng, bool bIsInside, int Mater
     float p_glass = r_glass / r_sum;
     result.p_glass = p_glass;
 
-    float xi = rand();
+    float xi = SampleBounceDimension(SOBOL_DIM_BSDF_SELECT);
 
     if (xi < p_glass)
         result = SampleBSDF_Glass(wo, Ns, bIsInside, MaterialSlotID);
@@ -1064,14 +1167,46 @@ float PowerHeuristic(float a, float b)
     return (s > 1e-20) ? (a2 / s) : 0.0;
 }
 
+// uHDRCache 为 2D alias 表（布局见 KH_Texture.cpp BuildEnvAliasTable），O(1) 采样
 vec3 FetchHDRCache(float xi1, float xi2)
 {
-    ivec2 size = textureSize(uHDRCache, 0);
-    ivec2 p = ivec2(
-        min(int(xi1 * float(size.x)), size.x - 1),
-        min(int(xi2 * float(size.y)), size.y - 1)
-    );
-    return texelFetch(uHDRCache, p, 0).rgb;
+    ivec2 size = textureSize(uSkybox, 0);
+
+    float fv = xi2 * float(size.y);
+    int v = min(int(fv), size.y - 1);
+    float rv = fv - float(v);
+
+    vec4 marginal = texelFetch(uHDRCache, ivec2(v % size.x, size.y + v / size.x), 0);
+    if (rv < marginal.x)
+    {
+        rv = rv / marginal.x;
+    }
+    else
+    {
+        v = int(marginal.y);
+        rv = (rv - marginal.x) / max(1.0 - marginal.x, 1e-6);
+    }
+
+    float fu = xi1 * float(size.x);
+    int u = min(int(fu), size.x - 1);
+    float ru = fu - float(u);
+
+    vec4 conditional = texelFetch(uHDRCache, ivec2(u, v), 0);
+    float pdfUV = conditional.z;
+    if (ru < conditional.x)
+    {
+        ru = ru / conditional.x;
+    }
+    else
+    {
+        u = int(conditional.y);
+        ru = (ru - conditional.x) / max(1.0 - conditional.x, 1e-6);
+        pdfUV = conditional.w;
+    }
+
+    // 复用剩余的随机数在 texel 内抖动
+    vec2 uv = (vec2(u, v) + clamp(vec2(ru, rv), 0.0, 0.99999)) / vec2(size);
+    return vec3(uv, pdfUV);
 }
 
 vec3 SampleHDR(float xi_env1, float xi_env2, vec3 V, float p_glass, HitResult hit_result)
@@ -1125,6 +1260,11 @@ vec3 SampleHDR(float xi_env1, float xi_env2, vec3 V, float p_glass, HitResult hi
          / max(pdfEnv, 1e-6);
 }
 
+const float ReprojectionDepthTolerance = 0.05;
+const float ReprojectionNormalTolerance = 0.9;
+
+HitResult PrimaryHit;
+
 vec3 PathTracing(Ray ray, int maxBounce)
 {
     vec3 finalColor = vec3(0.0);
@@ -1133,17 +1273,15 @@ vec3 PathTracing(Ray ray, int maxBounce)
 
     uvec2 pix = uvec2(gl_FragCoord.xy);
 
-    float xi_bsdf1 = rand();
-    float xi_bsdf2 = rand();
-    float xi_env1 = rand();
-    float xi_env2 = rand();
-    float xi_1 = rand();
-
     float pdf_bsdf = 0.0;
 
     for (int bounce = 0; bounce < maxBounce; bounce++)
     {
+        SobolBounceDimension = SOBOL_DIM_BOUNCE_BASE + uint(bounce) * SOBOL_DIMS_PER_BOUNCE;
+
         HitResult hit_result = HitBVH(currRay);
+        if (bounce == 0)
+            PrimaryHit = hit_result;
 
         vec3 V  = -currRay.Direction;
 
@@ -1167,11 +1305,8 @@ vec3 PathTracing(Ray ray, int maxBounce)
             break;
         }
 
-        xi_bsdf1 = rand();
-        xi_bsdf2 = rand();
-        xi_env1 = rand();
-        xi_env2 = rand();
-        xi_1 = rand();
+        float xi_env1 = SampleBounceDimension(SOBOL_DIM_ENV_NEE);
+        float xi_env2 = SampleBounceDimension(SOBOL_DIM_ENV_NEE + 1u);
 
         vec3 Ng = normalize(hit_result.GeoNormal);
         vec3 Ns = normalize(hit_result.ShadeNormal);
@@ -1208,7 +1343,7 @@ vec3 PathTracing(Ray ray, int maxBounce)
         if (bounce >= 3)
         {
             float p = clamp(max(throughput.r, max(throughput.g, throughput.b)), 0.05, 0.95);
-            if (rand() > p)
+            if (SampleBounceDimension(SOBOL_DIM_RR) > p)
                 break;
             throughput /= p;
         }
@@ -1217,9 +1352,61 @@ vec3 PathTracing(Ray ray, int maxBounce)
     return finalColor;
 }
 
+vec4 EncodeGBuffer(vec3 PrimaryDirection)
+{
+    if (!PrimaryHit.bIsHit)
+        return vec4(PrimaryDirection, -1.0);
+
+    float ViewDepth = dot(PrimaryHit.HitPoint - UCameraParam.Position.xyz, UCameraParam.Front.xyz);
+    return vec4(normalize(PrimaryHit.GeoNormal), ViewDepth);
+}
+
+// 用上一帧的 ViewProj 把当前主光线命中点投影回上一帧，深度/法线不一致视为遮挡变化
+bool ReprojectHistory(vec3 PrimaryDirection, out vec4 History)
+{
+    History = vec4(0.0);
+
+    // 未命中时按无穷远方向投影，只受相机旋转影响
+    vec4 PrevClip = PrimaryHit.bIsHit
+        ? UCameraParam.PrevViewProj * vec4(PrimaryHit.HitPoint, 1.0)
+        : UCameraParam.PrevViewProj * vec4(PrimaryDirection, 0.0);
+
+    if (PrevClip.w <= 1e-6)
+        return false;
+
+    vec2 PrevUV = PrevClip.xy / PrevClip.w * 0.5 + 0.5;
+    if (any(lessThan(PrevUV, vec2(0.0))) || any(greaterThanEqual(PrevUV, vec2(1.0))))
+        return false;
+
+    ivec2 PrevPix = ivec2(PrevUV * vec2(uResolution));
+    vec4 PrevGBuffer = texelFetch(uLastGBuffer, PrevPix, 0);
+
+    if (!PrimaryHit.bIsHit)
+    {
+        if (PrevGBuffer.w >= 0.0)
+            return false;
+    }
+    else
+    {
+        if (PrevGBuffer.w < 0.0)
+            return false;
+
+        float DepthError = abs(PrevGBuffer.w - PrevClip.w) / max(PrevClip.w, 1e-4);
+        if (DepthError > ReprojectionDepthTolerance)
+            return false;
+
+        if (dot(PrevGBuffer.xyz, normalize(PrimaryHit.GeoNormal)) < ReprojectionNormalTolerance)
+            return false;
+    }
+
+    History = texelFetch(uLastFrame, PrevPix, 0);
+    return true;
+}
+
 void main()
 {
     InitRNG();
+    InitSobol();
 
     Ray ray;
     ray.Start = UCameraParam.Position.xyz;
@@ -1228,10 +1415,27 @@ void main()
     vec4 Color = vec4(PathTracing(ray, 8), 1.0);
     ivec2 pix = ivec2(gl_FragCoord.xy);
 
-    vec4 LastFrameColor = texelFetch(uLastFrame, pix , 0);
+    GBuffer = EncodeGBuffer(ray.Direction);
+
+    // LastFrameColor.a 记录该像素已累积的样本数
+    vec4 LastFrameColor = vec4(0.0);
+    if (uFrameCounter > 0u)
+    {
+        if (uReprojectHistory == 1)
+        {
+            if (ReprojectHistory(ray.Direction, LastFrameColor))
+                LastFrameColor.a = min(LastFrameColor.a, uHistoryClamp);
+        }
+        else
+        {
+            LastFrameColor = texelFetch(uLastFrame, pix, 0);
+        }
+    }
+
+    float SampleCount = LastFrameColor.a;
 
-    if(uFrameCounter < 4096)
-        FragColor = mix(LastFrameColor, Color, 1.0/float(uFrameCounter+1));
+    if (SampleCount < uSampleLimit)
+        FragColor = vec4(mix(LastFrameColor.rgb, Color.rgb, 1.0 / (SampleCount + 1.0)), SampleCount + 1.0);
     else
         FragColor = LastFrameColor;
 }
@@ -0,0 +1,707 @@
+#include "KH_Benchmark.h"
+#include "KH_RayReplay.h"
+#include "Hit/KH_AABB.h"
+#include "Hit/KH_BVH.h"
+#include "Hit/KH_Ray.h"
+#include "Scene/KH_Shape.h"
+#include "Pipeline/KH_Texture.h"
+#include "Utils/KH_Algorithms.h"
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+#include "Utils/KH_SobolTable.h"
+
+namespace
+{
+    constexpr uint32_t RandomSeed = 20240601u;
+
+    // 与 KH_CpuPathTracer 的离线 BVH 一致的深度上限，叶子较小以体现划分质量
+    constexpr uint32_t BVHMaxDepth = 48;
+    constexpr uint32_t BVHMaxLeafPrimitives = 4;
+
+    bool ParseUInt(const char* text, uint32_t& outValue)
+    {
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(text, &end, 10);
+        if (end == text || *end != '\0' || value == 0)
+            return false;
+
+        outValue = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    double MedianOf(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        const size_t mid = values.size() / 2;
+        return (values.size() % 2 == 1) ? values[mid] : 0.5 * (values[mid - 1] + values[mid]);
+    }
+
+    std::vector<KH_Ray> GenerateRays(std::mt19937& rng, uint32_t count)
+    {
+        std::uniform_real_distribution<float> outer(-1.0f, 2.0f);
+        std::uniform_real_distribution<float> inner(0.0f, 1.0f);
+
+        // 起点散布在单位立方体周围，方向指向立方体内的随机点，约一半的光线会穿过几何体
+        std::vector<KH_Ray> rays;
+        rays.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const glm::vec3 start(outer(rng), outer(rng), outer(rng));
+            const glm::vec3 target(inner(rng), inner(rng), inner(rng));
+            const glm::vec3 direction = target - start;
+            rays.emplace_back(start, glm::length(direction) > 1e-4f ? glm::normalize(direction) : glm::vec3(0.0f, 0.0f, 1.0f));
+        }
+
+        return rays;
+    }
+
+    // 单位立方体内的三角形汤，边长随数量缩小，使包围盒重叠程度与规模无关
+    std::vector<KH_ScenePrimitive> GenerateTriangleSoup(std::mt19937& rng, uint32_t count)
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+        const float edge = 2.0f / std::cbrt(static_cast<float>(count));
+
+        std::vector<KH_ScenePrimitive> primitives;
+        primitives.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const glm::vec3 center(unit(rng), unit(rng), unit(rng));
+            glm::vec3 p1 = center + edge * glm::vec3(offset(rng), offset(rng), offset(rng));
+            glm::vec3 p2 = center + edge * glm::vec3(offset(rng), offset(rng), offset(rng));
+            glm::vec3 p3 = center + edge * glm::vec3(offset(rng), offset(rng), offset(rng));
+
+            // 避免退化三角形的法线为 NaN
+            if (glm::length(glm::cross(p2 - p1, p3 - p1)) < 1e-8f)
+                p3 += glm::vec3(edge, 0.0f, edge);
+
+            primitives.push_back(std::make_unique<KH_Triangle>(p1, p2, p3));
+        }
+
+        return primitives;
+    }
+
+    // 天空渐变加一个高亮太阳与噪声，分布与真实 HDR 环境图相近
+    std::vector<float> GenerateEnvironment(std::mt19937& rng, int width, int height)
+    {
+        std::uniform_real_distribution<float> noise(0.9f, 1.1f);
+        const glm::vec2 sun(0.3f * width, 0.25f * height);
+        const float sunRadius = 0.01f * width;
+
+        std::vector<float> pixels(static_cast<size_t>(width) * height * 3);
+        for (int v = 0; v < height; ++v)
+        {
+            const float sky = 0.2f + 0.8f * (1.0f - static_cast<float>(v) / height);
+            for (int u = 0; u < width; ++u)
+            {
+                const float distance = glm::length(glm::vec2(u, v) - sun);
+                const float radiance = (distance < sunRadius ? 500.0f : sky) * noise(rng);
+
+                float* pixel = pixels.data() + (static_cast<size_t>(v) * width + u) * 3;
+                pixel[0] = radiance;
+                pixel[1] = radiance * 0.95f;
+                pixel[2] = radiance * 0.9f;
+            }
+        }
+
+        return pixels;
+    }
+
+    void AppendCsvField(std::string& out, std::string_view text)
+    {
+        if (text.find_first_of(",\"\n") == std::string_view::npos)
+        {
+            out += text;
+            return;
+        }
+
+        out += '"';
+        for (const char c : text)
+        {
+            if (c == '"')
+                out += '"';
+            out += c;
+        }
+        out += '"';
+    }
+}
+
+double KH_BenchmarkResult::GetNanosecondsPerOperation() const
+{
+    return Operations > 0 ? MedianMilliseconds * 1.0e6 / static_cast<double>(Operations) : 0.0;
+}
+
+double KH_BenchmarkResult::GetMillionOperationsPerSecond() const
+{
+    return MedianMilliseconds > 0.0 ? static_cast<double>(Operations) / (MedianMilliseconds * 1.0e3) : 0.0;
+}
+
+bool KH_Benchmark::IsBenchmarkRequested(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--benchmark") == 0)
+            return true;
+    }
+
+    return false;
+}
+
+bool KH_Benchmark::ParseArguments(int argc, char** argv, KH_BenchmarkSettings& outSettings)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--benchmark")
+            continue;
+
+        if (arg == "--gpu")
+        {
+            outSettings.bGpuTraversal = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            LOG_E(std::format("Benchmark: missing value for {}", arg));
+            return false;
+        }
+
+        const char* value = argv[++i];
+        bool bValid = true;
+
+        if (arg == "--output")
+            outSettings.OutputPath = value;
+        else if (arg == "--repetitions")
+            bValid = ParseUInt(value, outSettings.Repetitions);
+        else if (arg == "--max-triangles")
+            bValid = ParseUInt(value, outSettings.MaxTriangles);
+        else if (arg == "--threads")
+            bValid = ParseUInt(value, outSettings.Threads);
+        else if (arg == "--filter")
+            outSettings.Filter = value;
+        else if (arg == "--rays")
+            outSettings.RayFiles.push_back(value);
+        else
+        {
+            LOG_E(std::format("Benchmark: unknown argument {}", arg));
+            return false;
+        }
+
+        if (!bValid)
+        {
+            LOG_E(std::format("Benchmark: invalid value '{}' for {}", value, arg));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool KH_Benchmark::Run(const KH_BenchmarkSettings& settings)
+{
+    Settings = settings;
+    Results.clear();
+    Sink = 0;
+
+    LOG_D(std::format("Benchmark: {} repetitions, up to {} triangles, {} worker threads",
+        Settings.Repetitions, Settings.MaxTriangles, KH_JobSystem::Instance().GetWorkerCount()));
+
+    RunMortonCode();
+    RunLowDiscrepancy();
+    RunScanCPU();
+    RunEnvImportanceTable();
+    RunRayHits();
+    RunBVHBuilds();
+
+    for (const std::string& rayFile : Settings.RayFiles)
+        RunRayReplay(rayFile);
+
+    LOG_D(std::format("Benchmark: {} cases finished (checksum {:016x})", Results.size(), Sink));
+
+    const std::string extension = std::filesystem::path(Settings.OutputPath).extension().string();
+    return (extension == ".csv" || extension == ".CSV") ? WriteCsv(Settings.OutputPath) : WriteJson(Settings.OutputPath);
+}
+
+bool KH_Benchmark::IsSelected(const std::string& group, const std::string& name) const
+{
+    return Settings.Filter.empty() || (group + "/" + name).find(Settings.Filter) != std::string::npos;
+}
+
+void KH_Benchmark::Measure(const std::string& group, const std::string& name, uint64_t size, uint64_t operations,
+    const std::function<void()>& setup, const std::function<uint64_t()>& body)
+{
+    const uint32_t repetitions = std::max(Settings.Repetitions, 1u);
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+
+    for (uint32_t i = 0; i <= repetitions; ++i)
+    {
+        if (setup)
+            setup();
+
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t checksum = body();
+        const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        Sink += checksum;
+
+        // 第 0 次为预热，填充缓存与分配器，不计入结果
+        if (i > 0)
+            samples.push_back(milliseconds);
+    }
+
+    KH_BenchmarkResult result;
+    result.Group = group;
+    result.Name = name;
+    result.Size = size;
+    result.Operations = operations;
+    result.Repetitions = repetitions;
+    result.MedianMilliseconds = MedianOf(samples);
+    result.MinMilliseconds = *std::min_element(samples.begin(), samples.end());
+    result.MaxMilliseconds = *std::max_element(samples.begin(), samples.end());
+
+    LOG_D(std::format("Benchmark: {}/{} [{}] median {:.3f} ms, {:.2f} ns/op, {:.2f} Mop/s",
+        group, name, size, result.MedianMilliseconds, result.GetNanosecondsPerOperation(), result.GetMillionOperationsPerSecond()));
+
+    Results.push_back(std::move(result));
+}
+
+void KH_Benchmark::RunMortonCode()
+{
+    constexpr uint32_t Count = 1u << 20;
+
+    std::mt19937 rng(RandomSeed);
+    std::uniform_int_distribution<uint32_t> coord(0u, 1023u);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<glm::uvec3> integerPoints(Count);
+    std::vector<glm::vec3> floatPoints(Count);
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+        integerPoints[i] = glm::uvec3(coord(rng), coord(rng), coord(rng));
+        floatPoints[i] = glm::vec3(unit(rng), unit(rng), unit(rng));
+    }
+
+    if (IsSelected("MortonCode", "Morton3D"))
+    {
+        Measure("MortonCode", "Morton3D", Count, Count, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (const glm::uvec3& p : integerPoints)
+                checksum += KH_MortonCode::Morton3D(p.x, p.y, p.z);
+            return checksum;
+        });
+    }
+
+    if (IsSelected("MortonCode", "Morton3D_MagicBits"))
+    {
+        Measure("MortonCode", "Morton3D_MagicBits", Count, Count, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (const glm::uvec3& p : integerPoints)
+                checksum += KH_MortonCode::Morton3D_MagicBits(p.x, p.y, p.z);
+            return checksum;
+        });
+    }
+
+    if (IsSelected("MortonCode", "Morton3DFloat_MagicBits"))
+    {
+        Measure("MortonCode", "Morton3DFloat_MagicBits", Count, Count, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (const glm::vec3& p : floatPoints)
+                checksum += KH_MortonCode::Morton3DFloat_MagicBits(p);
+            return checksum;
+        });
+    }
+
+    if (IsSelected("MortonCode", "Morton3DFloat_IndexAugmentation"))
+    {
+        Measure("MortonCode", "Morton3DFloat_IndexAugmentation", Count, Count, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (uint32_t i = 0; i < Count; ++i)
+                checksum ^= KH_MortonCode::Morton3DFloat_IndexAugmentation(floatPoints[i], i);
+            return checksum;
+        });
+    }
+}
+
+void KH_Benchmark::RunLowDiscrepancy()
+{
+    constexpr uint32_t Count = 1u << 18;
+    constexpr int Dimensions = 4;
+
+    const auto quantize = [](float value) { return static_cast<uint64_t>(value * 4294967296.0f); };
+
+    if (IsSelected("LowDiscrepancy", "Sobol"))
+    {
+        // KH_Sobol::Sobol 的方向数从下标 1 开始
+        std::vector<std::vector<uint32_t>> directions(Dimensions, std::vector<uint32_t>(33, 0u));
+        for (int d = 0; d < Dimensions; ++d)
+            std::copy_n(KH_SobolDirectionTable + d * 32, 32, directions[d].begin() + 1);
+
+        Measure("LowDiscrepancy", "Sobol", Count, static_cast<uint64_t>(Count) * Dimensions, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                for (int d = 0; d < Dimensions; ++d)
+                    checksum += quantize(KH_Sobol::Sobol(directions[d], KH_Sobol::GrayCode(i)));
+            }
+            return checksum;
+        });
+    }
+
+    if (IsSelected("LowDiscrepancy", "Halton"))
+    {
+        Measure("LowDiscrepancy", "Halton", Count, static_cast<uint64_t>(Count) * Dimensions, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                for (int d = 0; d < Dimensions; ++d)
+                    checksum += quantize(KH_LowDiscrepancySequence::Halton(d, static_cast<int>(i)));
+            }
+            return checksum;
+        });
+    }
+
+    if (IsSelected("LowDiscrepancy", "Hammersley"))
+    {
+        Measure("LowDiscrepancy", "Hammersley", Count, static_cast<uint64_t>(Count) * Dimensions, nullptr, [&]()
+        {
+            uint64_t checksum = 0;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                for (int d = 0; d < Dimensions; ++d)
+                    checksum += quantize(KH_LowDiscrepancySequence::Hammersley(d, static_cast<int>(i), static_cast<int>(Count)));
+            }
+            return checksum;
+        });
+    }
+}
+
+void KH_Benchmark::RunScanCPU()
+{
+    if (!IsSelected("ScanCPU", "Blelloch"))
+        return;
+
+    std::mt19937 rng(RandomSeed);
+    std::uniform_int_distribution<int> value(0, 15);
+
+    for (const uint32_t count : { 1u << 10, 1u << 16, 1u << 20 })
+    {
+        std::vector<int> data(count);
+        for (int& element : data)
+            element = value(rng);
+
+        // 扫描原地修改数据，每次计时前重新拷贝输入
+        std::unique_ptr<KH_ScanCPU> scan;
+        Measure("ScanCPU", "Blelloch", count, count,
+            [&]() { scan = std::make_unique<KH_ScanCPU>(data, false); },
+            [&]()
+            {
+                scan->ProcessScanCPU();
+                return static_cast<uint64_t>(scan->Data.back());
+            });
+    }
+}
+
+void KH_Benchmark::RunEnvImportanceTable()
+{
+    if (!IsSelected("EnvImportanceTable", "AliasTable"))
+        return;
+
+    std::mt19937 rng(RandomSeed);
+
+    for (const glm::ivec2 extent : { glm::ivec2(512, 256), glm::ivec2(2048, 1024), glm::ivec2(4096, 2048) })
+    {
+        const std::vector<float> pixels = GenerateEnvironment(rng, extent.x, extent.y);
+        const uint64_t pixelCount = static_cast<uint64_t>(extent.x) * extent.y;
+
+        Measure("EnvImportanceTable", "AliasTable", pixelCount, pixelCount, nullptr, [&]()
+        {
+            const std::vector<glm::vec4> table = KH_TextureManager::BuildEnvImportanceTable(pixels.data(), extent.x, extent.y, 3);
+            return static_cast<uint64_t>(table.size()) + static_cast<uint64_t>(table.back().x * 1024.0f);
+        });
+    }
+}
+
+void KH_Benchmark::RunRayHits()
+{
+    constexpr uint32_t RayCount = 1u << 20;
+    constexpr uint32_t ShapeCount = 1u << 12;
+
+    std::mt19937 rng(RandomSeed);
+    const std::vector<KH_Ray> rays = GenerateRays(rng, RayCount);
+
+    if (IsSelected("RayHit", "AABB"))
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<KH_AABB> boxes;
+        boxes.reserve(ShapeCount);
+        for (uint32_t i = 0; i < ShapeCount; ++i)
+        {
+            const glm::vec3 a(unit(rng), unit(rng), unit(rng));
+            const glm::vec3 b(unit(rng), unit(rng), unit(rng));
+            boxes.emplace_back(glm::min(a, b), glm::max(a, b));
+        }
+
+        Measure("RayHit", "AABB", ShapeCount, RayCount, nullptr, [&]()
+        {
+            uint64_t hits = 0;
+            for (uint32_t i = 0; i < RayCount; ++i)
+                hits += boxes[i & (ShapeCount - 1)].Hit(rays[i]).bIsHit ? 1 : 0;
+            return hits;
+        });
+    }
+
+    if (IsSelected("RayHit", "Triangle"))
+    {
+        // 顶点取自整个单位立方体，三角形较大，命中与未命中的分支都被覆盖
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<KH_Triangle> triangles;
+        triangles.reserve(ShapeCount);
+        for (uint32_t i = 0; i < ShapeCount; ++i)
+            triangles.emplace_back(glm::vec3(unit(rng), unit(rng), unit(rng)),
+                glm::vec3(unit(rng), unit(rng), unit(rng)),
+                glm::vec3(unit(rng), unit(rng), unit(rng)));
+
+        Measure("RayHit", "Triangle", ShapeCount, RayCount, nullptr, [&]()
+        {
+            uint64_t hits = 0;
+            for (uint32_t i = 0; i < RayCount; ++i)
+                hits += triangles[i & (ShapeCount - 1)].Hit(rays[i]).bIsHit ? 1 : 0;
+            return hits;
+        });
+    }
+}
+
+void KH_Benchmark::RunBVHBuilds()
+{
+    struct KH_BVHBuildCase
+    {
+        const char* Name;
+        bool bFlat;
+        KH_BVH_BUILD_MODE Mode;
+    };
+
+    const KH_BVHBuildCase cases[] = {
+        { "BVH_Base", false, KH_BVH_BUILD_MODE::Base },
+        { "BVH_SAH", false, KH_BVH_BUILD_MODE::SAH },
+        { "FlatBVH_Base", true, KH_BVH_BUILD_MODE::Base },
+        { "FlatBVH_SAH", true, KH_BVH_BUILD_MODE::SAH },
+    };
+
+    for (uint64_t count = 1000; count <= Settings.MaxTriangles; count *= 10)
+    {
+        const bool bAnySelected = std::any_of(std::begin(cases), std::end(cases),
+            [&](const KH_BVHBuildCase& buildCase) { return IsSelected("BVHBuild", buildCase.Name); });
+        if (!bAnySelected)
+            return;
+
+        std::mt19937 rng(RandomSeed);
+        std::vector<KH_ScenePrimitive> primitives = GenerateTriangleSoup(rng, static_cast<uint32_t>(count));
+        const uint32_t primitiveCount = static_cast<uint32_t>(primitives.size());
+
+        for (const KH_BVHBuildCase& buildCase : cases)
+        {
+            if (!IsSelected("BVHBuild", buildCase.Name))
+                continue;
+
+            std::unique_ptr<KH_BVHNode> root;
+            std::vector<KH_FlatBVHNode> flatNodes;
+            std::mt19937 shuffleRng(RandomSeed);
+
+            // 构建会按轴排序图元，每次计时前打乱成同一顺序，释放上一棵树的时间也不计入
+            const auto setup = [&]()
+            {
+                root.reset();
+                flatNodes.clear();
+                shuffleRng.seed(RandomSeed);
+                std::shuffle(primitives.begin(), primitives.end(), shuffleRng);
+            };
+
+            const auto build = [&]() -> uint64_t
+            {
+                if (buildCase.bFlat)
+                {
+                    if (buildCase.Mode == KH_BVH_BUILD_MODE::SAH)
+                        KH_FlatBVHNode::BuildNodeSAH(primitives, flatNodes, 0, primitiveCount, 0, BVHMaxLeafPrimitives, BVHMaxDepth);
+                    else
+                        KH_FlatBVHNode::BuildNode(primitives, flatNodes, 0, primitiveCount, 0, BVHMaxLeafPrimitives, BVHMaxDepth);
+                    return flatNodes.size();
+                }
+
+                root = std::make_unique<KH_BVHNode>();
+                if (buildCase.Mode == KH_BVH_BUILD_MODE::SAH)
+                    root->BuildNodeSAH(primitives, 0, primitiveCount, 0, BVHMaxLeafPrimitives, BVHMaxDepth);
+                else
+                    root->BuildNode(primitives, 0, primitiveCount, 0, BVHMaxLeafPrimitives, BVHMaxDepth);
+                return static_cast<uint64_t>(root->AABB.GetSurfaceArea() * 1024.0f);
+            };
+
+            Measure("BVHBuild", buildCase.Name, count, count, setup, build);
+        }
+    }
+}
+
+void KH_Benchmark::RunRayReplay(const std::string& filePath)
+{
+    KH_RaySet raySet;
+    if (!raySet.LoadFromFile(filePath))
+        return;
+
+    if (raySet.GetTriangleCount() == 0 || raySet.Rays.empty())
+    {
+        LOG_W(std::format("Benchmark: ray set {} has no triangles or rays", filePath));
+        return;
+    }
+
+    const std::string sceneName = std::filesystem::path(raySet.SceneName.empty() ? filePath : raySet.SceneName).stem().string();
+    const std::string group = "RayReplay/" + sceneName;
+
+    struct KH_RayReplayCase
+    {
+        const char* Name;
+        KH_CapturedRayType Type;
+        KH_RayQuery Query;
+    };
+
+    const KH_RayReplayCase cases[] = {
+        { "Primary.Closest", KH_CapturedRayType::Primary, KH_RayQuery::Closest },
+        { "Bounce.Closest", KH_CapturedRayType::Bounce, KH_RayQuery::Closest },
+        { "Shadow.Any", KH_CapturedRayType::Shadow, KH_RayQuery::Any },
+    };
+    constexpr size_t CaseCount = std::size(cases);
+
+    std::array<std::vector<KH_CapturedRay>, CaseCount> rays;
+    for (size_t i = 0; i < CaseCount; ++i)
+        rays[i] = raySet.GetRays(cases[i].Type);
+
+    // 第一个运行的目标（默认是录制时使用的 KH_CpuPathTracer）的命中数作为参考。
+    // KH_Triangle::Hit 的行列式阈值较大，极小的三角形可能被它漏掉，只报告超过千分之一的差异
+    std::array<int64_t, CaseCount> referenceHits;
+    referenceHits.fill(-1);
+
+    for (std::unique_ptr<KH_RayReplayTarget>& target : KH_RayReplayTarget::CreateTargets(Settings.bGpuTraversal))
+    {
+        const std::string targetName = target->GetName();
+
+        const bool bAnySelected = std::any_of(std::begin(cases), std::end(cases),
+            [&](const KH_RayReplayCase& replayCase) { return IsSelected(group, targetName + "." + replayCase.Name); });
+        if (!bAnySelected)
+            continue;
+
+        if (!target->Build(raySet))
+        {
+            LOG_W(std::format("Benchmark: failed to build {} for {}", targetName, group));
+            continue;
+        }
+
+        for (size_t i = 0; i < CaseCount; ++i)
+        {
+            const std::string name = targetName + "." + cases[i].Name;
+            if (!IsSelected(group, name) || rays[i].empty())
+                continue;
+
+            target->PrepareRays(rays[i]);
+
+            uint64_t hits = 0;
+            Measure(group, name, raySet.GetTriangleCount(), rays[i].size(), nullptr, [&]()
+            {
+                hits = target->Trace(rays[i], cases[i].Query);
+                return hits;
+            });
+
+            LOG_D(std::format("Benchmark: {}/{} {:.2f} Mrays/s, {} of {} rays hit",
+                group, name, Results.back().GetMillionOperationsPerSecond(), hits, rays[i].size()));
+
+            if (referenceHits[i] < 0)
+            {
+                referenceHits[i] = static_cast<int64_t>(hits);
+            }
+            else if (std::abs(static_cast<int64_t>(hits) - referenceHits[i]) * 1000 > static_cast<int64_t>(rays[i].size()))
+            {
+                LOG_W(std::format("Benchmark: {}/{} hit {} rays, reference hit {}", group, name, hits, referenceHits[i]));
+            }
+        }
+
+        // 每个目标用完即释放，大场景下不同时持有多棵树
+        target.reset();
+    }
+}
+
+bool KH_Benchmark::WriteJson(const std::string& filePath) const
+{
+    std::string json = std::format("{{\n  \"repetitions\": {},\n  \"workerThreads\": {},\n  \"results\": [\n",
+        std::max(Settings.Repetitions, 1u), KH_JobSystem::Instance().GetWorkerCount());
+
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        const KH_BenchmarkResult& result = Results[i];
+        json += std::format(
+            "    {{\"group\": \"{}\", \"name\": \"{}\", \"size\": {}, \"operations\": {}, \"repetitions\": {}, "
+            "\"medianMs\": {:.6f}, \"minMs\": {:.6f}, \"maxMs\": {:.6f}, \"nsPerOp\": {:.4f}, \"mopsPerSec\": {:.4f}}}{}\n",
+            result.Group, result.Name, result.Size, result.Operations, result.Repetitions,
+            result.MedianMilliseconds, result.MinMilliseconds, result.MaxMilliseconds,
+            result.GetNanosecondsPerOperation(), result.GetMillionOperationsPerSecond(), i + 1 < Results.size() ? "," : "");
+    }
+
+    json += "  ]\n}\n";
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOG_E(std::format("Benchmark: failed to open {}", filePath));
+        return false;
+    }
+
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file)
+    {
+        LOG_E(std::format("Benchmark: failed to write {}", filePath));
+        return false;
+    }
+
+    LOG_D(std::format("Benchmark: wrote {} results to {}", Results.size(), filePath));
+    return true;
+}
+
+bool KH_Benchmark::WriteCsv(const std::string& filePath) const
+{
+    std::string csv = "group,name,size,operations,repetitions,median_ms,min_ms,max_ms,ns_per_op,mops_per_sec\n";
+
+    for (const KH_BenchmarkResult& result : Results)
+    {
+        AppendCsvField(csv, result.Group);
+        csv += ',';
+        AppendCsvField(csv, result.Name);
+        csv += std::format(",{},{},{},{:.6f},{:.6f},{:.6f},{:.4f},{:.4f}\n",
+            result.Size, result.Operations, result.Repetitions,
+            result.MedianMilliseconds, result.MinMilliseconds, result.MaxMilliseconds,
+            result.GetNanosecondsPerOperation(), result.GetMillionOperationsPerSecond());
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOG_E(std::format("Benchmark: failed to open {}", filePath));
+        return false;
+    }
+
+    file.write(csv.data(), static_cast<std::streamsize>(csv.size()));
+    if (!file)
+    {
+        LOG_E(std::format("Benchmark: failed to write {}", filePath));
+        return false;
+    }
+
+    LOG_D(std::format("Benchmark: wrote {} results to {}", Results.size(), filePath));
+    return true;
+}
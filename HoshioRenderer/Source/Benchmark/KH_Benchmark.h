@@ -0,0 +1,93 @@
+#pragma once
+
+#include "KH_Common.h"
+
+struct KH_BenchmarkSettings
+{
+    // 按扩展名选择格式：.csv 写 CSV，其余写 JSON
+    std::string OutputPath = "BenchmarkResults.json";
+
+    // 每个用例计时的次数，取中位数；之前另有一次不计时的预热
+    uint32_t Repetitions = 5;
+
+    // BVH 构建的最大三角形数，从 10^3 按 10 倍递增。每个三角形是独立的堆对象，
+    // 10^7 需要数 GB 内存，默认只到 10^6
+    uint32_t MaxTriangles = 1000000;
+
+    // 作业系统的工作线程数，0 表示按硬件线程数自动选择（环境光重要性表构建是并行的）
+    uint32_t Threads = 0;
+
+    // 非空时只运行 "分组/名称" 中包含该子串的用例
+    std::string Filter;
+
+    // KH_RaySet 文件（headless --capture-rays 录制），每个文件按场景分组回放
+    std::vector<std::string> RayFiles;
+
+    // 光线回放时追加 GPU LBVH 目标，需要创建离屏 GL 上下文
+    bool bGpuTraversal = false;
+};
+
+struct KH_BenchmarkResult
+{
+    std::string Group;
+    std::string Name;
+
+    // 问题规模（元素数、像素数或三角形数）与每次计时内执行的操作数
+    uint64_t Size = 0;
+    uint64_t Operations = 0;
+    uint32_t Repetitions = 0;
+
+    double MedianMilliseconds = 0.0;
+    double MinMilliseconds = 0.0;
+    double MaxMilliseconds = 0.0;
+
+    double GetNanosecondsPerOperation() const;
+    // 光线回放中即 Mrays/s
+    double GetMillionOperationsPerSecond() const;
+};
+
+// 无窗口、无 GL 上下文的 CPU 微基准：Morton 编码、Sobol / 低差异序列、KH_ScanCPU、
+// 环境光重要性表构建、KH_AABB / KH_Triangle 求交，以及 KH_BVH / KH_FlatBVH 各构建模式。
+// 输入由固定种子生成，不同机器、不同提交之间的结果可直接对比。
+// 另可回放录制的光线文件，对比各加速结构的最近交点与任一交点吞吐
+class KH_Benchmark
+{
+public:
+    KH_Benchmark() = default;
+
+    KH_Benchmark(const KH_Benchmark&) = delete;
+    KH_Benchmark& operator=(const KH_Benchmark&) = delete;
+
+    // 解析 --benchmark 之后的参数：--output、--repetitions、--max-triangles、--threads、--filter、
+    // --rays（可重复）与不带值的 --gpu
+    static bool ParseArguments(int argc, char** argv, KH_BenchmarkSettings& outSettings);
+    static bool IsBenchmarkRequested(int argc, char** argv);
+
+    bool Run(const KH_BenchmarkSettings& settings);
+
+    const std::vector<KH_BenchmarkResult>& GetResults() const { return Results; }
+
+private:
+    KH_BenchmarkSettings Settings;
+    std::vector<KH_BenchmarkResult> Results;
+
+    // 计时体的结果累加到这里并在结束时输出，防止被编译器整体消除
+    uint64_t Sink = 0;
+
+    bool IsSelected(const std::string& group, const std::string& name) const;
+
+    // setup 每次计时前调用且不计入耗时
+    void Measure(const std::string& group, const std::string& name, uint64_t size, uint64_t operations,
+        const std::function<void()>& setup, const std::function<uint64_t()>& body);
+
+    void RunMortonCode();
+    void RunLowDiscrepancy();
+    void RunScanCPU();
+    void RunEnvImportanceTable();
+    void RunRayHits();
+    void RunBVHBuilds();
+    void RunRayReplay(const std::string& filePath);
+
+    bool WriteJson(const std::string& filePath) const;
+    bool WriteCsv(const std::string& filePath) const;
+};
@@ -0,0 +1,231 @@
+#include "KH_RayReplay.h"
+#include "Headless/KH_OffscreenContext.h"
+#include "Hit/KH_BVH.h"
+#include "Hit/KH_LBVH.h"
+#include "Hit/KH_Ray.h"
+#include "Pipeline/KH_CpuPathTracer.h"
+#include "Pipeline/KH_Shader.h"
+#include "Scene/KH_Scene.h"
+#include "Scene/KH_Shape.h"
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+
+namespace
+{
+    // 与 KH_Benchmark 的 BVH 构建用例一致
+    constexpr uint32_t BVHMaxDepth = 48;
+    constexpr uint32_t BVHMaxLeafPrimitives = 4;
+
+    // 每个任务追踪的光线数，足够摊薄调度开销
+    constexpr uint32_t RaysPerTask = 1024;
+
+    // 与 TraceRays.comp 的 local_size_x 一致；单次派发不超过 GL 保证的最小工作组数 65535
+    constexpr uint32_t TraceRaysGroupSize = 64;
+    constexpr uint32_t MaxRaysPerDispatch = TraceRaysGroupSize * 32768;
+
+    template<typename F>
+    uint64_t CountHits(const std::vector<KH_CapturedRay>& rays, F&& traceRay)
+    {
+        return KH_JobSystem::Instance().ParallelReduce<uint64_t>(0, static_cast<uint32_t>(rays.size()), RaysPerTask, 0,
+            [&](uint32_t first, uint32_t last)
+            {
+                uint64_t hits = 0;
+                for (uint32_t i = first; i < last; ++i)
+                    hits += traceRay(rays[i]) ? 1 : 0;
+                return hits;
+            },
+            [](uint64_t a, uint64_t b) { return a + b; });
+    }
+
+    class KH_CpuPathTracerReplayTarget : public KH_RayReplayTarget
+    {
+    public:
+        const char* GetName() const override { return "CpuPathTracer"; }
+
+        bool Build(const KH_RaySet& raySet) override
+        {
+            Tracer.PrepareGeometry(raySet.TrianglePositions);
+            return Tracer.GetStats().BVHNodeCount > 0;
+        }
+
+        uint64_t Trace(const std::vector<KH_CapturedRay>& rays, KH_RayQuery query) override
+        {
+            if (query == KH_RayQuery::Any)
+            {
+                return CountHits(rays, [&](const KH_CapturedRay& ray)
+                {
+                    return Tracer.IntersectAny(ray.GetStart(), ray.GetDirection(), ray.GetTMax());
+                });
+            }
+
+            return CountHits(rays, [&](const KH_CapturedRay& ray)
+            {
+                float distance;
+                return Tracer.IntersectClosest(ray.GetStart(), ray.GetDirection(), ray.GetTMax(), distance);
+            });
+        }
+
+    private:
+        KH_CpuPathTracer Tracer;
+    };
+
+    // KH_IBVH::Intersect：有序遍历，用当前最近距离裁剪，与 TraceRays.comp 的遍历方式相同
+    class KH_IBVHReplayTarget : public KH_RayReplayTarget
+    {
+    public:
+        KH_IBVHReplayTarget(std::string name, std::unique_ptr<KH_IBVH> bvh)
+            : Name(std::move(name))
+            , BVH(std::move(bvh))
+        {
+        }
+
+        const char* GetName() const override { return Name.c_str(); }
+
+        bool Build(const KH_RaySet& raySet) override
+        {
+            const std::vector<glm::vec3>& positions = raySet.TrianglePositions;
+
+            std::vector<KH_ScenePrimitive> primitives;
+            primitives.reserve(positions.size() / 3);
+            for (size_t i = 0; i + 2 < positions.size(); i += 3)
+                primitives.push_back(std::make_unique<KH_Triangle>(positions[i], positions[i + 1], positions[i + 2]));
+
+            BVH->BuildFromPrimitives(std::move(primitives));
+            return BVH->PrimitiveCount > 0;
+        }
+
+        uint64_t Trace(const std::vector<KH_CapturedRay>& rays, KH_RayQuery query) override
+        {
+            const bool bAnyHit = query == KH_RayQuery::Any;
+            return CountHits(rays, [&](const KH_CapturedRay& ray)
+            {
+                float distance;
+                return BVH->Intersect(KH_Ray(ray.GetStart(), ray.GetDirection()), ray.GetTMax(), bAnyHit, distance);
+            });
+        }
+
+    private:
+        std::string Name;
+        std::unique_ptr<KH_IBVH> BVH;
+    };
+
+    // 用与实时渲染相同的 KH_GpuLBVHScene 在 GPU 上构建 LBVH，再以 TraceRays.comp 遍历。
+    // 计时包含派发与 glFinish，不含光线上传
+    class KH_GpuLBVHReplayTarget : public KH_RayReplayTarget
+    {
+    public:
+        const char* GetName() const override { return "GpuLBVH"; }
+
+        bool Build(const KH_RaySet& raySet) override
+        {
+            if (!KH_OffscreenContext::Instance().Create(1, 1))
+                return false;
+
+            const std::vector<glm::vec3>& positions = raySet.TrianglePositions;
+
+            KH_ModelImport import;
+            import.SourcePath = raySet.SceneName;
+
+            KH_CookedMesh& mesh = import.Meshes.emplace_back();
+            mesh.Vertices.reserve(positions.size());
+            mesh.Indices.reserve(positions.size());
+            for (size_t i = 0; i + 2 < positions.size(); i += 3)
+            {
+                const glm::vec3 normal = glm::cross(positions[i + 1] - positions[i], positions[i + 2] - positions[i]);
+                const float length = glm::length(normal);
+
+                for (size_t k = i; k < i + 3; ++k)
+                {
+                    KH_Vertex& vertex = mesh.Vertices.emplace_back();
+                    vertex.Position = positions[k];
+                    if (length > 0.0f)
+                        vertex.Normal = normal / length;
+
+                    mesh.Indices.push_back(static_cast<unsigned int>(k));
+                    mesh.LocalAABB.Merge(positions[k], positions[k]);
+                }
+            }
+
+            KH_Model model;
+            model.ApplyImport(std::move(import));
+
+            // 构造时加载示例着色器，必须在上下文创建之后
+            Scene = std::make_unique<KH_GpuLBVHScene>();
+            Scene->EnsureDefaultMaterials();
+            Scene->AddModel(0, std::move(model));
+            Scene->BindAndBuild();
+
+            TraceShader = KH_ShaderManager::Instance().LoadComputeShader("Assert/Shaders/ComputeShaders/RayTraversal/TraceRays.comp");
+            HitCountSSBO.SetData(std::vector<uint32_t>{ 0u }, GL_DYNAMIC_READ);
+
+            glFinish();
+            return TraceShader.IsValid() && Scene->GetLBVHNodeCount() > 0;
+        }
+
+        void PrepareRays(const std::vector<KH_CapturedRay>& rays) override
+        {
+            RaySSBO.SetData(rays, GL_STATIC_DRAW);
+            glFinish();
+        }
+
+        uint64_t Trace(const std::vector<KH_CapturedRay>& rays, KH_RayQuery query) override
+        {
+            const uint32_t rayCount = static_cast<uint32_t>(rays.size());
+
+            HitCountSSBO.Clear();
+
+            TraceShader.Use();
+            TraceShader.SetInt("uLBVHNodeCount", Scene->GetLBVHNodeCount());
+            TraceShader.SetInt("uAnyHit", query == KH_RayQuery::Any ? 1 : 0);
+
+            Scene->BindTraversalBuffers();
+            RaySSBO.Bind();
+            HitCountSSBO.Bind();
+
+            for (uint32_t offset = 0; offset < rayCount; offset += MaxRaysPerDispatch)
+            {
+                const uint32_t count = std::min(rayCount - offset, MaxRaysPerDispatch);
+                TraceShader.SetInt("uRayOffset", static_cast<int>(offset));
+                TraceShader.SetInt("uRayCount", static_cast<int>(rayCount));
+                glDispatchCompute((count + TraceRaysGroupSize - 1) / TraceRaysGroupSize, 1, 1);
+            }
+
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+            glFinish();
+
+            std::vector<uint32_t> hitCount;
+            HitCountSSBO.GetData(hitCount);
+            return hitCount.empty() ? 0 : hitCount[0];
+        }
+
+    private:
+        std::unique_ptr<KH_GpuLBVHScene> Scene;
+        KH_Shader TraceShader;
+
+        KH_SSBO<KH_CapturedRay> RaySSBO{ 7 };
+        KH_SSBO<uint32_t> HitCountSSBO{ 8 };
+    };
+}
+
+std::vector<std::unique_ptr<KH_RayReplayTarget>> KH_RayReplayTarget::CreateTargets(bool bIncludeGpu)
+{
+    std::vector<std::unique_ptr<KH_RayReplayTarget>> targets;
+
+    targets.push_back(std::make_unique<KH_CpuPathTracerReplayTarget>());
+
+    targets.push_back(std::make_unique<KH_IBVHReplayTarget>("BVH_Base",
+        std::make_unique<KH_BVH>(BVHMaxDepth, BVHMaxLeafPrimitives, KH_BVH_BUILD_MODE::Base)));
+    targets.push_back(std::make_unique<KH_IBVHReplayTarget>("BVH_SAH",
+        std::make_unique<KH_BVH>(BVHMaxDepth, BVHMaxLeafPrimitives, KH_BVH_BUILD_MODE::SAH)));
+    targets.push_back(std::make_unique<KH_IBVHReplayTarget>("FlatBVH_Base",
+        std::make_unique<KH_FlatBVH>(BVHMaxDepth, BVHMaxLeafPrimitives, KH_BVH_BUILD_MODE::Base)));
+    targets.push_back(std::make_unique<KH_IBVHReplayTarget>("FlatBVH_SAH",
+        std::make_unique<KH_FlatBVH>(BVHMaxDepth, BVHMaxLeafPrimitives, KH_BVH_BUILD_MODE::SAH)));
+
+    targets.push_back(std::make_unique<KH_IBVHReplayTarget>("LBVH", std::make_unique<KH_LBVH>()));
+
+    if (bIncludeGpu)
+        targets.push_back(std::make_unique<KH_GpuLBVHReplayTarget>());
+
+    return targets;
+}
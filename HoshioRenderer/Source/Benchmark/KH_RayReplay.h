@@ -0,0 +1,34 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "Hit/KH_RayCapture.h"
+
+enum class KH_RayQuery
+{
+    // 最近交点，对应相机与弹射光线
+    Closest = 0,
+    // 找到任一交点即返回，对应阴影光线
+    Any = 1
+};
+
+// 光线回放目标：把 KH_RaySet 中的三角形建成一种加速结构，再批量追踪光线并返回命中数。
+// 命中数在各目标之间应一致（允许求交阈值带来的少量差异），用于交叉校验
+class KH_RayReplayTarget
+{
+public:
+    virtual ~KH_RayReplayTarget() = default;
+
+    virtual const char* GetName() const = 0;
+
+    // 不计时
+    virtual bool Build(const KH_RaySet& raySet) = 0;
+
+    // 每批光线计时前调用一次，不计时（GPU 目标在这里上传光线）
+    virtual void PrepareRays(const std::vector<KH_CapturedRay>& rays) { (void)rays; }
+
+    virtual uint64_t Trace(const std::vector<KH_CapturedRay>& rays, KH_RayQuery query) = 0;
+
+    // CPU 目标：KH_CpuPathTracer 的 BVH，KH_BVH / KH_FlatBVH 的 Base 与 SAH 构建，KH_LBVH；
+    // bIncludeGpu 时追加 GPU LBVH（需要能创建离屏 GL 上下文）
+    static std::vector<std::unique_ptr<KH_RayReplayTarget>> CreateTargets(bool bIncludeGpu);
+};
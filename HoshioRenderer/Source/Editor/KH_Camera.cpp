@@ -88,7 +88,7 @@ void KH_Camera::ProcessKeyboard(CameraMovement direction, float deltaTime)
     if (direction == CameraMovement::Down)
         Position -= Up * velocity;
 
-    KH_Editor::Instance().RequestFrameReset();
+    KH_Editor::Instance().RequestHistoryReprojection();
 }
 
 void KH_Camera::ProcessMouseMovement(float xoffset, float yoffset, bool constrainPitch)
@@ -109,7 +109,7 @@ void KH_Camera::ProcessMouseMovement(float xoffset, float yoffset, bool constrai
 
     UpdateCameraVectors();
 
-    KH_Editor::Instance().RequestFrameReset();
+    KH_Editor::Instance().RequestHistoryReprojection();
 }
 
 void KH_Camera::ProcessMouseScroll(float yoffset)
@@ -1,6 +1,7 @@
 #include "KH_Canvas.h"
 #include "Utils/KH_DebugUtils.h"
 #include "KH_Editor.h"
+#include "Pipeline/KH_GLState.h"
 
 #include "Hit/KH_Ray.h"
 
@@ -11,20 +12,13 @@ KH_Canvas::KH_Canvas()
     sceneDesc.Width = 64;
     sceneDesc.Height = 64;
     sceneDesc.Attachments = {
-        KH_FramebufferTextureFormat::RGBA32F,      // Scene Color
+        KH_FramebufferTextureFormat::RGBA32F,      // Scene Color (a: sample count)
+        KH_FramebufferTextureFormat::RGBA32F,      // GBuffer (xyz: normal, w: view depth)
         KH_FramebufferTextureFormat::DEPTH32F      // Depth
     };
 
     SceneFramebuffer[0].Create(sceneDesc);
     SceneFramebuffer[1].Create(sceneDesc);
-
-
-    sceneDesc.Attachments = {
-        KH_FramebufferTextureFormat::RGBA8,      // Final Color
-    };
-
-    PostProcessFramebuffers[0].Create(sceneDesc);
-    PostProcessFramebuffers[1].Create(sceneDesc);
 }
 
 void KH_Canvas::Render()
@@ -37,16 +31,16 @@ void KH_Canvas::Render()
         uint32_t viewportWidth = static_cast<uint32_t>(viewportPanelSize.x);
         uint32_t viewportHeight = static_cast<uint32_t>(viewportPanelSize.y);
 
-        KH_Framebuffer& Framebuffer = GetLastPostProcessFramebuffer();
+        const KH_Framebuffer& SceneColor = GetSceneFramebuffer();
 
-        if (viewportWidth != Framebuffer.GetWidth() || viewportHeight != Framebuffer.GetHeight())
+        if (viewportWidth != SceneColor.GetWidth() || viewportHeight != SceneColor.GetHeight())
         {
             if (viewportPanelSize.x > 0 && viewportPanelSize.y > 0)
             {
                 ResizeAllFramebuffers(viewportWidth, viewportHeight);
 
                 KH_Editor::Instance().UpdateCanvasExtent(viewportWidth, viewportHeight);
-                glViewport(0, 0, KH_Editor::GetCanvasWidth(), KH_Editor::GetCanvasHeight());
+                KH_GLState::Instance().Viewport(0, 0, KH_Editor::GetCanvasWidth(), KH_Editor::GetCanvasHeight());
 
                 Timer.Reset();
             }
@@ -61,7 +55,7 @@ void KH_Canvas::Render()
             Timer.InActive();
         }
 
-        uint32_t textureID = Framebuffer.GetColorAttachmentID(0);
+        uint32_t textureID = GetPresentFramebuffer().GetColorAttachmentID(0);
 
         ImVec2 imagePos = ImGui::GetCursorScreenPos();
         CanvasMin = glm::vec2(imagePos.x, imagePos.y);
@@ -85,19 +79,19 @@ KH_Framebuffer& KH_Canvas::GetSceneFramebuffer()
     return SceneFramebuffer[FrameBufferHandle];
 }
 
-KH_Framebuffer& KH_Canvas::GetCurrentPostProcessFramebuffer()
+KH_Framebuffer& KH_Canvas::GetLastFramebuffer()
 {
-	return PostProcessFramebuffers[CurrentPostProcessFBO];
+    return SceneFramebuffer[(FrameBufferHandle + 1) % 2];
 }
 
-KH_Framebuffer& KH_Canvas::GetLastPostProcessFramebuffer()
+const KH_Framebuffer& KH_Canvas::GetPresentFramebuffer() const
 {
-    return PostProcessFramebuffers[(CurrentPostProcessFBO + 1) % 2];
+    return PresentFramebuffer ? *PresentFramebuffer : SceneFramebuffer[FrameBufferHandle];
 }
 
-KH_Framebuffer& KH_Canvas::GetLastFramebuffer()
+void KH_Canvas::SetPresentFramebuffer(const KH_Framebuffer* framebuffer)
 {
-    return SceneFramebuffer[(FrameBufferHandle + 1) % 2];
+    PresentFramebuffer = framebuffer;
 }
 
 void KH_Canvas::BindSceneFramebuffer()
@@ -110,21 +104,6 @@ void KH_Canvas::UnbindSceneFramebuffer()
     GetSceneFramebuffer().Unbind();
 }
 
-void KH_Canvas::BindPostProcessFramebuffer()
-{
-    GetCurrentPostProcessFramebuffer().Bind();
-}
-
-void KH_Canvas::UnbindPostProcessFramebuffer()
-{
-    GetLastPostProcessFramebuffer().Unbind();
-}
-
-void KH_Canvas::SwapPostProcessFramebuffers()
-{
-    CurrentPostProcessFBO = (CurrentPostProcessFBO + 1) % 2;
-}
-
 void KH_Canvas::SwapFramebuffer()
 {
     FrameBufferHandle = (FrameBufferHandle + 1) % 2;
@@ -132,11 +111,9 @@ void KH_Canvas::SwapFramebuffer()
 
 void KH_Canvas::ResizeAllFramebuffers(int width, int height)
 {
+    // 后处理的临时目标由 KH_RenderTargetPool 按新尺寸复用，这里只需处理场景历史
     SceneFramebuffer[0].Resize(width, height);
     SceneFramebuffer[1].Resize(width, height);
-
-    PostProcessFramebuffers[0].Resize(width, height);
-    PostProcessFramebuffers[1].Resize(width, height);
 }
 
 
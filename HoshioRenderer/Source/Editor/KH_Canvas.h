@@ -13,18 +13,15 @@ public:
 	void Render() override;
 
 	KH_Framebuffer& GetSceneFramebuffer();
-	KH_Framebuffer& GetCurrentPostProcessFramebuffer();
-	KH_Framebuffer& GetLastPostProcessFramebuffer();
 	KH_Framebuffer& GetLastFramebuffer();
 
+	// 后处理图的输出（池化目标），未执行后处理时为场景颜色
+	const KH_Framebuffer& GetPresentFramebuffer() const;
+	void SetPresentFramebuffer(const KH_Framebuffer* framebuffer);
+
 	void BindSceneFramebuffer();
 	void UnbindSceneFramebuffer();
 
-	void BindPostProcessFramebuffer();
-	void UnbindPostProcessFramebuffer();
-
-	void SwapPostProcessFramebuffers();
-
 	void SwapFramebuffer();
 
 	bool IsMouseInsideCanvas() const;
@@ -49,10 +46,9 @@ private:
 	bool bHistoryValid = false;
 
 	uint32_t FrameBufferHandle = 0;
-	uint32_t CurrentPostProcessFBO = 0;
 	KH_Framebuffer SceneFramebuffer[2];
 	//KH_Framebuffer TAAFramebuffers[2];
-	KH_Framebuffer PostProcessFramebuffers[2];
+	const KH_Framebuffer* PresentFramebuffer = nullptr;
 	KH_Timer Timer;
 
 	glm::vec2 CanvasMin = glm::vec2(0.0f);
@@ -1,6 +1,12 @@
 #include "KH_Editor.h"
 #include "Hit/KH_Ray.h"
 #include "Scene/KH_Scene.h"
+#include "Pipeline/KH_GLState.h"
+#include "Pipeline/KH_RenderTargetPool.h"
+#include "Pipeline/KH_AccumulationCheckpoint.h"
+#include "Pipeline/KH_FrameCapture.h"
+#include "Utils/KH_JobSystem.h"
+#include "Utils/KH_Profiler.h"
 
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -78,42 +84,6 @@ namespace
         }
     }
 
-    void AddDefaultMaterialToFeature(KH_ShaderFeatureBase* feature)
-    {
-        if (feature == nullptr || feature->GetMaterialCount() > 0)
-            return;
-
-        if (auto* brdf = dynamic_cast<KH_DisneyBRDF*>(feature))
-        {
-            KH_BRDFMaterial mat{};
-            mat.BaseColor = glm::vec3(0.8f);
-            mat.Emissive = glm::vec3(0.0f);
-            mat.Specular = 0.5f;
-            mat.Roughness = 0.5f;
-            brdf->AddMaterial(mat);
-        }
-        else if (auto* bssrdf = dynamic_cast<KH_BSSRDF*>(feature))
-        {
-            KH_BSSRDFMaterial mat{};
-            mat.Emissive = glm::vec3(0.0f);
-            mat.BaseColor = glm::vec3(0.8f);
-            mat.Radius = glm::vec3(1.0f, 0.2f, 0.1f);
-            mat.Eta = 1.3f;
-            mat.Scale = 0.05f;
-            bssrdf->AddMaterial(mat);
-        }
-        else if (auto* bsdf = dynamic_cast<KH_DisneyBSDF*>(feature))
-        {
-            KH_BSDFMaterial mat{};
-            mat.BaseColor = glm::vec3(0.8f);
-            mat.Emissive = glm::vec3(0.0f);
-            mat.Specular = 0.5f;
-            mat.Roughness = 0.5f;
-            mat.IOR = 1.5f;
-            bsdf->AddMaterial(mat);
-        }
-    }
-
 }
 
 namespace
@@ -160,11 +130,143 @@ void KH_Editor::RequestSceneRebuild()
     RequestFrameReset();
 }
 
+void KH_Editor::RequestObjectRebuild(int ObjectID)
+{
+    if (ObjectID < 0)
+    {
+        RequestSceneRebuild();
+        return;
+    }
+
+    Scene.MarkObjectDirty(static_cast<size_t>(ObjectID));
+    bObjectRebuildRequested = true;
+    RequestFrameReset();
+}
+
 void KH_Editor::RequestFrameReset()
 {
     bFrameResetRequested = true;
 }
 
+void KH_Editor::RequestHistoryReprojection()
+{
+    // 未开启重投影时，相机移动仍然清空累积
+    if (!bEnableTemporalReprojection)
+    {
+        RequestFrameReset();
+    }
+}
+
+bool KH_Editor::IsTemporalReprojectionEnabled() const
+{
+    return bEnableTemporalReprojection;
+}
+
+void KH_Editor::SetTemporalReprojectionEnabled(bool bEnabled)
+{
+    bEnableTemporalReprojection = bEnabled;
+}
+
+float KH_Editor::GetHistoryClamp() const
+{
+    return HistoryClamp;
+}
+
+void KH_Editor::SetHistoryClamp(float Clamp)
+{
+    HistoryClamp = std::max(Clamp, 1.0f);
+}
+
+bool KH_Editor::IsIdleFrame() const
+{
+    return bIdleFrame;
+}
+
+bool KH_Editor::IsIdleSkipEnabled() const
+{
+    return bIdleSkipEnabled;
+}
+
+void KH_Editor::SetIdleSkipEnabled(bool bEnabled)
+{
+    bIdleSkipEnabled = bEnabled;
+}
+
+uint32_t KH_Editor::GetSampleLimit() const
+{
+    return SampleLimit;
+}
+
+void KH_Editor::SetSampleLimit(uint32_t Limit)
+{
+    SampleLimit = std::max(Limit, 1u);
+    SampleTarget = SampleLimit;
+}
+
+uint32_t KH_Editor::GetSampleTarget() const
+{
+    return SampleTarget;
+}
+
+uint32_t KH_Editor::GetAccumulatedFrames() const
+{
+    return AccumulatedFrames;
+}
+
+void KH_Editor::RenderMoreSamples(uint32_t Count)
+{
+    SampleTarget = std::max(SampleTarget, AccumulatedFrames) + Count;
+}
+
+bool KH_Editor::IsCheckpointEnabled() const
+{
+    return bCheckpointEnabled;
+}
+
+void KH_Editor::SetCheckpointEnabled(bool bEnabled)
+{
+    bCheckpointEnabled = bEnabled;
+}
+
+uint32_t KH_Editor::GetCheckpointInterval() const
+{
+    return CheckpointInterval;
+}
+
+void KH_Editor::SetCheckpointInterval(uint32_t Interval)
+{
+    CheckpointInterval = std::max(Interval, 1u);
+}
+
+std::string KH_Editor::GetCheckpointPath() const
+{
+    if (!CheckpointPath.empty())
+        return CheckpointPath;
+
+    return CurrentSceneXmlPath.empty() ? "Accumulation.khck" : CurrentSceneXmlPath + ".khck";
+}
+
+void KH_Editor::SetCheckpointPath(std::string Path)
+{
+    CheckpointPath = std::move(Path);
+}
+
+bool KH_Editor::IsCheckpointWritePending() const
+{
+    return PendingCheckpointWrite.valid() &&
+        PendingCheckpointWrite.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+void KH_Editor::RequestCheckpointSave()
+{
+    bCheckpointSaveRequested = true;
+}
+
+void KH_Editor::RequestCheckpointLoad()
+{
+    bCheckpointLoadRequested = true;
+}
+
 KH_Canvas& KH_Editor::GetCanvas()
 {
     return Canvas;
@@ -237,11 +339,46 @@ GLFWwindow* KH_Editor::GLFWwindow() const
 
 void KH_Editor::BeginRender()
 {
+    KH_Profiler::Instance().BeginFrame();
+    KH_PROFILE_SCOPE("BeginRender");
+
     bSceneRebuildRequested = false;
+    bObjectRebuildRequested = false;
     bFrameResetRequested = false;
+    KH_GLState::Instance().BeginFrame();
+    KH_RenderTargetPool::Instance().BeginFrame();
+    KH_FrameCapture::Instance().Update();
     Window.BeginRender();
     BeginImgui();
     RenderDockSpace();
+
+    // 后台任务提交的 GL 工作（纹理上传等）
+    {
+        KH_PROFILE_GPU_SCOPE("MainThreadJobs");
+        KH_JobSystem::Instance().RunMainThreadJobs(MainThreadJobBudget);
+    }
+
+    if (KH_ExampleTextures::Instance().Update())
+    {
+        RequestFrameReset();
+    }
+
+    {
+        KH_PROFILE_GPU_SCOPE("SceneStreaming");
+        if (SceneLoader.Update(SceneStreamingBudget))
+        {
+            RequestFrameReset();
+        }
+    }
+
+    Scene.BeginFrame();
+
+    CurrentViewProj = Camera.GetProjMatrix() * Camera.GetViewMatrix();
+    const bool bCameraChanged = CurrentViewProj != LastRenderedViewProj;
+
+    bIdleFrame = bIdleSkipEnabled &&
+        !bFrameResetRequested && !bCameraChanged &&
+        AccumulatedFrames >= SampleTarget;
 }
 
 void KH_Editor::Render()
@@ -251,33 +388,60 @@ void KH_Editor::Render()
 
 void KH_Editor::EndRender()
 {
-    Canvas.Render();
-    DrawCanvasContextMenu();
-    DrawAddBuiltinSphereDialog();
-    UpdateSelectedObjectID();
+    {
+        KH_PROFILE_SCOPE("EditorUI");
+
+        Canvas.Render();
+        DrawCanvasContextMenu();
+        DrawAddBuiltinSphereDialog();
+        UpdateSelectedObjectID();
+
+        Console.Render();
+        SceneTree.Render();
+        Inspector.Render();
+        MaterialsEditor.Render();
+        GlobalInfo.Render();
+        RenderPipeline.Render();
+        Profiler.Render();
+    }
+
+    if (!bIdleFrame && bRecordingFrames)
+    {
+        const std::string Path = std::format("{}/frame_{:05}.png", RecordDirectory, RecordedFrames++);
+        KH_FrameCapture::Instance().Capture(Canvas.GetPresentFramebuffer(), Path);
+    }
+
+    if (!bIdleFrame)
+    {
+        Canvas.SwapFramebuffer();
 
-    Console.Render();
-    SceneTree.Render();
-    Inspector.Render();
-    MaterialsEditor.Render();
-    GlobalInfo.Render();
-    RenderPipeline.Render();
+        FrameCounter += 1;
+        AccumulatedFrames = (CurrentViewProj == LastRenderedViewProj) ? AccumulatedFrames + 1 : 1;
+        LastRenderedViewProj = CurrentViewProj;
+    }
 
-    Canvas.SwapFramebuffer();
     EndImgui();
-    Window.EndRender();
 
-    FrameCounter += 1;
+    {
+        KH_PROFILE_SCOPE("SwapBuffers");
+        Window.EndRender();
+    }
 
     if (bSceneRebuildRequested)
     {
         Scene.BindAndBuild();
     }
+    else if (bObjectRebuildRequested)
+    {
+        Scene.RebuildDirtyObjects();
+    }
 
     if (bFrameResetRequested)
     {
         ResetFrameCounter();
     }
+
+    UpdateCheckpoint();
 }
 
 void KH_Editor::UpdateCanvasExtent(uint32_t Width, uint32_t Height)
@@ -302,11 +466,31 @@ void KH_Editor::UnbindCanvasFramebuffer()
     Canvas.UnbindSceneFramebuffer();
 }
 
+const KH_Camera& KH_Editor::GetCamera() const
+{
+    return Camera;
+}
+
+KH_Framebuffer& KH_Editor::GetSceneFramebuffer()
+{
+    return Canvas.GetSceneFramebuffer();
+}
+
 const KH_Framebuffer& KH_Editor::GetLastFramebuffer()
 {
     return Canvas.GetLastFramebuffer();
 }
 
+void KH_Editor::SetPresentFramebuffer(const KH_Framebuffer* framebuffer)
+{
+    Canvas.SetPresentFramebuffer(framebuffer);
+}
+
+glm::uvec2 KH_Editor::GetRenderExtent() const
+{
+    return glm::uvec2(CanvasWidth, CanvasHeight);
+}
+
 int KH_Editor::GetSelectedObjectID() const
 {
     return SelectedObjectID;
@@ -320,18 +504,126 @@ int KH_Editor::GetSelectedObjectMeshID() const
 void KH_Editor::ResetFrameCounter()
 {
     FrameCounter = 0;
+    AccumulatedFrames = 0;
+    SampleTarget = SampleLimit;
+}
+
+void KH_Editor::UpdateCheckpoint()
+{
+    if (bCheckpointLoadRequested)
+    {
+        bCheckpointLoadRequested = false;
+        bCheckpointSaveRequested = false;
+        LoadCheckpoint();
+        return;
+    }
+
+    const bool bPeriodic = bCheckpointEnabled && !bIdleFrame && !bFrameResetRequested &&
+        AccumulatedFrames > 0 && AccumulatedFrames % CheckpointInterval == 0;
+
+    if (bCheckpointSaveRequested || bPeriodic)
+    {
+        bCheckpointSaveRequested = false;
+        SaveCheckpoint();
+    }
+}
+
+void KH_Editor::SaveCheckpoint()
+{
+    if (AccumulatedFrames == 0)
+    {
+        LOG_W("Nothing accumulated yet, checkpoint skipped");
+        return;
+    }
+
+    if (PendingCheckpointWrite.valid())
+    {
+        if (PendingCheckpointWrite.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            LOG_W("Previous checkpoint is still being written, checkpoint skipped");
+            return;
+        }
+        PendingCheckpointWrite.get();
+    }
+
+    // 交换之后，本帧的累积结果位于历史目标
+    auto Checkpoint = std::make_shared<KH_AccumulationCheckpoint>();
+    const uint64_t SceneHash = KH_AccumulationCheckpoint::ComputeSceneHash(Scene, GetRenderExtent());
+    if (!Checkpoint->Capture(Canvas.GetLastFramebuffer(), Camera, FrameCounter, AccumulatedFrames, SceneHash))
+    {
+        LOG_E("Failed to read back the accumulation buffer for a checkpoint");
+        return;
+    }
+
+    const std::string Path = GetCheckpointPath();
+    PendingCheckpointWrite = KH_JobSystem::Instance().Async([Checkpoint, Path]()
+    {
+        if (!Checkpoint->SaveToFile(Path))
+            return false;
+
+        LOG_D(std::format("Accumulation checkpoint saved: {} ({} spp)", Path, Checkpoint->AccumulatedFrames));
+        return true;
+    });
+}
+
+bool KH_Editor::LoadCheckpoint()
+{
+    const std::string Path = GetCheckpointPath();
+
+    KH_AccumulationCheckpoint Checkpoint;
+    if (!Checkpoint.LoadFromFile(Path))
+    {
+        LOG_W(std::format("No usable accumulation checkpoint at {}", Path));
+        return false;
+    }
+
+    const glm::uvec2 Extent = GetRenderExtent();
+    if (Checkpoint.Width != Extent.x || Checkpoint.Height != Extent.y)
+    {
+        LOG_W(std::format("Checkpoint is {}x{} but the canvas is {}x{}",
+            Checkpoint.Width, Checkpoint.Height, Extent.x, Extent.y));
+        return false;
+    }
+
+    if (Checkpoint.SceneHash != KH_AccumulationCheckpoint::ComputeSceneHash(Scene, Extent))
+    {
+        LOG_W("Checkpoint was saved for different geometry, materials or shader settings");
+        return false;
+    }
+
+    if (!Checkpoint.Restore(Canvas.GetLastFramebuffer(), Camera))
+    {
+        LOG_E("Failed to restore the accumulation buffer from a checkpoint");
+        return false;
+    }
+
+    Scene.ResetCameraHistory();
+
+    FrameCounter = Checkpoint.FrameCounter;
+    AccumulatedFrames = Checkpoint.AccumulatedFrames;
+    LastRenderedViewProj = Camera.GetProjMatrix() * Camera.GetViewMatrix();
+
+    // 至少再渲染一帧，画布才会显示恢复后的累积结果
+    SampleTarget = std::max(SampleTarget, AccumulatedFrames + 1);
+
+    LOG_D(std::format("Resumed accumulation from {} at {} spp", Path, AccumulatedFrames));
+    return true;
 }
 
 KH_Editor::KH_Editor()
     :Camera(CanvasWidth, CanvasHeight), Window(EditorWidth, EditorHeight, Title)
 {
     Window.SetCamera(&Camera);
+    KH_RenderContext::SetCurrent(this);
     Initialize();
 }
 
 KH_Editor::~KH_Editor()
 {
     DeInitialize();
+
+    if (KH_RenderContext::HasCurrent() && &KH_RenderContext::Current() == this)
+        KH_RenderContext::SetCurrent(nullptr);
 }
 
 void KH_Editor::Initialize()
@@ -344,6 +636,15 @@ void KH_Editor::Initialize()
 
 void KH_Editor::DeInitialize()
 {
+    SceneLoader.Cancel();
+
+    // 作业系统的 future 析构时不会等待，退出前确保检查点写完
+    if (PendingCheckpointWrite.valid())
+        PendingCheckpointWrite.wait();
+
+    // 窗口（GL 上下文）随后才销毁
+    KH_FrameCapture::Instance().Shutdown();
+    KH_Profiler::Instance().Shutdown();
 }
 
 void KH_Editor::RenderDockSpace()
@@ -382,8 +683,13 @@ void KH_Editor::BeginImgui()
 
 void KH_Editor::EndImgui()
 {
+    KH_PROFILE_GPU_SCOPE("ImGui");
+
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+    // ImGui 后端绕过状态缓存直接绑定对象
+    KH_GLState::Instance().Invalidate();
 }
 
 void KH_Editor::UpdateSelectedObjectID()
@@ -584,6 +890,16 @@ void KH_Editor::DrawMainMenuBar()
             ExportCurrentFramebufferAsImage();
         }
 
+        if (ImGui::MenuItem("Record Frames", nullptr, bRecordingFrames))
+        {
+            SetRecordingFrames(!bRecordingFrames);
+        }
+
+        if (ImGui::MenuItem("Export Profiler Trace...", nullptr, false, !KH_Profiler::Instance().GetHistory().empty()))
+        {
+            ExportProfilerTrace();
+        }
+
         ImGui::Separator();
 
         ImGui::TextDisabled(
@@ -636,7 +952,7 @@ void KH_Editor::OpenImportSceneDialog()
 
 bool KH_Editor::ImportSceneFromFile(const std::string& filePath)
 {
-    if (!Scene.LoadFromXml(filePath))
+    if (!SceneLoader.Begin(Scene, filePath))
     {
         return false;
     }
@@ -686,12 +1002,12 @@ void KH_Editor::DrawViewManipulator()
     if (viewChanged)
     {
         ApplyViewManipulatorToCamera(view, pivot, distance);
-        RequestFrameReset();
+        RequestHistoryReprojection();
     }
 
     if (bViewManipulatorUsing)
     {
-        RequestFrameReset();
+        RequestHistoryReprojection();
     }
 }
 
@@ -785,8 +1101,7 @@ void KH_Editor::DrawObjectGizmo()
         if (ExtractTRS(newModel, position, rotationQuat, scale))
         {
             object->SetTransform(position, rotationQuat, scale);
-            RequestSceneRebuild();
-            RequestFrameReset();
+            RequestObjectRebuild(SelectedObjectID);
         }
     }
 }
@@ -833,25 +1148,84 @@ bool KH_Editor::ExportCurrentFramebufferAsImage()
     std::string path = pfd::save_file(
         "Export As Image",
         ".",
-        { "PNG Files", "*.png", "All Files", "*" }
+        { "PNG Files", "*.png", "Radiance HDR Files", "*.hdr", "OpenEXR Files", "*.exr", "All Files", "*" }
     ).result();
 
     path = EnsurePngExtension(path);
     if (path.empty())
         return false;
 
-    const bool bSuccess = Canvas.GetLastPostProcessFramebuffer().SaveColorAttachmentToPNG(path, 0);
+    // PNG 导出后处理后的画面；HDR/EXR 导出上一帧交换后的线性累积结果，不做色调映射
+    const bool bLinear = KH_FrameCapture::FormatFromPath(path) != KH_CaptureFormat::PNG;
+    const KH_Framebuffer& Source = bLinear ? Canvas.GetLastFramebuffer() : Canvas.GetPresentFramebuffer();
+
+    const bool bSuccess = KH_FrameCapture::Instance().Capture(Source, path, 0);
 
     if (bSuccess)
-        LOG_D(std::format("Framebuffer exported to '{}'", path));
+        LOG_D(std::format("Framebuffer export to '{}' queued", path));
     else
         LOG_E(std::format("Failed to export framebuffer to '{}'", path));
 
     return bSuccess;
 }
 
+bool KH_Editor::ExportProfilerTrace()
+{
+    std::string path = pfd::save_file(
+        "Export Profiler Trace",
+        ".",
+        { "Chrome Trace Files", "*.json", "All Files", "*" }
+    ).result();
+
+    if (path.empty())
+        return false;
+
+    std::filesystem::path p(path);
+    if (!p.has_extension())
+        p.replace_extension(".json");
+
+    return KH_Profiler::Instance().ExportChromeTrace(p.string());
+}
+
+const KH_SceneLoader& KH_Editor::GetSceneLoader() const
+{
+    return SceneLoader;
+}
+
+bool KH_Editor::IsRecordingFrames() const
+{
+    return bRecordingFrames;
+}
+
+void KH_Editor::SetRecordingFrames(bool bRecording)
+{
+    if (bRecording == bRecordingFrames)
+        return;
+
+    if (bRecording)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(RecordDirectory, error);
+        if (error)
+        {
+            LOG_E(std::format("Failed to create capture directory '{}': {}", RecordDirectory, error.message()));
+            return;
+        }
+
+        RecordedFrames = 0;
+        LOG_D(std::format("Recording frames to '{}'", RecordDirectory));
+    }
+    else
+    {
+        LOG_D(std::format("Recorded {} frames to '{}'", RecordedFrames, RecordDirectory));
+    }
+
+    bRecordingFrames = bRecording;
+}
+
 void KH_Editor::NewScene()
 {
+    SceneLoader.Cancel();
     Scene.Clear();
     EnsureDefaultMaterialsForAllShaderFeatures();
     Scene.BindAndBuild();
@@ -865,12 +1239,7 @@ void KH_Editor::NewScene()
 
 void KH_Editor::EnsureDefaultMaterialsForAllShaderFeatures()
 {
-    for (size_t i = 0; i < KH_ShaderFeatureTypeCount; ++i)
-    {
-        KH_ShaderFeatureType type = static_cast<KH_ShaderFeatureType>(i);
-        AddDefaultMaterialToFeature(Scene.GetShaderFeature(type));
-    }
-
+    Scene.EnsureDefaultMaterials();
     Scene.UpdateMaterialSSBO();
 }
 
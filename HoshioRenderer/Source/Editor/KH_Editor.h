@@ -4,6 +4,8 @@
 #include "KH_Canvas.h"
 #include "KH_MaterialEditor.h"
 #include "Scene/KH_Scene.h"
+#include "Scene/KH_SceneLoader.h"
+#include "Pipeline/KH_RenderContext.h"
 
 class KH_SceneBase;
 
@@ -20,7 +22,7 @@ enum class KH_GizmoMode
     World
 };
 
-class KH_Editor
+class KH_Editor : public KH_RenderContext
 {
 public:
     static KH_Editor& Instance();
@@ -36,18 +38,65 @@ public:
     void BindCanvasFramebuffer();
     void UnbindCanvasFramebuffer();
 
-    const KH_Framebuffer& GetLastFramebuffer();
+    const KH_Camera& GetCamera() const override;
+    KH_Framebuffer& GetSceneFramebuffer() override;
+    const KH_Framebuffer& GetLastFramebuffer() override;
+    void SetPresentFramebuffer(const KH_Framebuffer* framebuffer) override;
+    glm::uvec2 GetRenderExtent() const override;
 
     int GetSelectedObjectID() const;
     int GetSelectedObjectMeshID() const;
 
-    uint32_t GetFrameCounter() const;
+    uint32_t GetFrameCounter() const override;
 
     void RequestSceneRebuild();
+    // 只有该物体的图元变化（变换、材质），按脏范围上传后重建 BVH
+    void RequestObjectRebuild(int ObjectID);
     void RequestFrameReset();
+    void RequestHistoryReprojection();
+
+    bool IsTemporalReprojectionEnabled() const override;
+    void SetTemporalReprojectionEnabled(bool bEnabled);
+    float GetHistoryClamp() const override;
+    void SetHistoryClamp(float Clamp);
+
+    // 累积已达到样本上限且场景、相机未变时，本帧跳过路径追踪与后处理，画布沿用缓存的最终图像
+    bool IsIdleFrame() const;
+    bool IsIdleSkipEnabled() const;
+    void SetIdleSkipEnabled(bool bEnabled);
+
+    uint32_t GetSampleLimit() const;
+    void SetSampleLimit(uint32_t Limit);
+    uint32_t GetSampleTarget() const override;
+    uint32_t GetAccumulatedFrames() const;
+    // 在当前累积的基础上再追加 Count 个样本
+    void RenderMoreSamples(uint32_t Count);
+
+    // 累积断点：开启后每 CheckpointInterval 个样本把累积缓冲写到检查点文件，载入后从保存时的样本数继续
+    bool IsCheckpointEnabled() const;
+    void SetCheckpointEnabled(bool bEnabled);
+    uint32_t GetCheckpointInterval() const;
+    void SetCheckpointInterval(uint32_t Interval);
+    // 未指定时使用场景 XML 同名的 .khck 文件
+    std::string GetCheckpointPath() const;
+    void SetCheckpointPath(std::string Path);
+    bool IsCheckpointWritePending() const;
+    // 均在帧末处理，保证读写的是本帧交换后的历史目标
+    void RequestCheckpointSave();
+    void RequestCheckpointLoad();
+
+    // 录制时每个渲染帧的最终画面都经异步读回写到 RecordDirectory
+    bool IsRecordingFrames() const;
+    void SetRecordingFrames(bool bRecording);
 
     KH_Canvas& GetCanvas();
 
+    // 把分析器保留的最近若干帧导出为 Chrome trace JSON
+    bool ExportProfilerTrace();
+
+    // 场景中的资产模型在后台导入，渲染线程每帧最多花 SceneStreamingBudget 毫秒上传
+    const KH_SceneLoader& GetSceneLoader() const;
+
     static void SetEditorWidth(uint32_t Width);
     static void SetEditorHeight(uint32_t Height);
     static void SetCanvasWidth(uint32_t Width);
@@ -96,8 +145,38 @@ private:
     int SelectedObjectMeshID = -1;
 
     bool bSceneRebuildRequested = false;
+    bool bObjectRebuildRequested = false;
     bool bFrameResetRequested = false;
 
+    bool bEnableTemporalReprojection = false;
+    float HistoryClamp = 32.0f;
+
+    // 重投影时相机移动不会清零 FrameCounter，收敛判断改用相机静止后累积的帧数
+    uint32_t SampleLimit = 4096;
+    uint32_t SampleTarget = 4096;
+    uint32_t AccumulatedFrames = 0;
+    glm::mat4 CurrentViewProj = glm::mat4(1.0f);
+    glm::mat4 LastRenderedViewProj = glm::mat4(0.0f);
+    bool bIdleSkipEnabled = true;
+    bool bIdleFrame = false;
+
+    bool bCheckpointEnabled = false;
+    uint32_t CheckpointInterval = 1024;
+    std::string CheckpointPath;
+    bool bCheckpointSaveRequested = false;
+    bool bCheckpointLoadRequested = false;
+    // 像素读回在主线程完成，写盘交给工作线程
+    std::future<bool> PendingCheckpointWrite;
+
+    bool bRecordingFrames = false;
+    uint32_t RecordedFrames = 0;
+    std::string RecordDirectory = "Captures";
+
+    KH_SceneLoader SceneLoader;
+    float SceneStreamingBudget = 4.0f;
+    // 每帧执行主线程任务的时间上限（毫秒），超出的留到下一帧
+    float MainThreadJobBudget = 2.0f;
+
     bool bGizmoOver = false;
     bool bGizmoUsing = false;
 
@@ -123,6 +202,7 @@ private:
     KH_SceneTree SceneTree;
     KH_MaterialEditor MaterialsEditor;
     KH_RenderPipeline RenderPipeline;
+    KH_ProfilerPanel Profiler;
 
     std::string CurrentSceneXmlPath;
 
@@ -134,7 +214,7 @@ private:
     int PendingBuiltinSphereStackCount = 32;
 
     KH_Editor();
-    ~KH_Editor();
+    ~KH_Editor() override;
 
     void Initialize();
     void DeInitialize();
@@ -146,6 +226,10 @@ private:
 
     void ResetFrameCounter();
 
+    void UpdateCheckpoint();
+    void SaveCheckpoint();
+    bool LoadCheckpoint();
+
     void UpdateSelectedObjectID();
 
     void DrawObjectGizmo();
@@ -174,7 +174,7 @@ void KH_MaterialEditor::RenderDisneyBRDFEditor(KH_DisneyBRDF& Feature, KH_Editor
 
     if (materialChanged)
     {
-        Scene.UpdateMaterialSSBO();
+        Scene.UpdateMaterialSSBO(SelectedMaterialID);
         Editor.RequestFrameReset();
     }
 }
@@ -278,7 +278,7 @@ void KH_MaterialEditor::RenderBSSRDFEditor(KH_BSSRDF& Feature, KH_Editor& Editor
 
     if (materialChanged)
     {
-        Scene.UpdateMaterialSSBO();
+        Scene.UpdateMaterialSSBO(SelectedMaterialID);
         Editor.RequestFrameReset();
     }
 }
@@ -398,7 +398,7 @@ void KH_MaterialEditor::RenderDisneyBSDFEditor(KH_DisneyBSDF& Feature, KH_Editor
 
     if (materialChanged)
     {
-        Scene.UpdateMaterialSSBO();
+        Scene.UpdateMaterialSSBO(SelectedMaterialID);
         Editor.RequestFrameReset();
     }
 }
@@ -1,7 +1,13 @@
 #include "KH_Panel.h"
 #include "KH_Editor.h"
 #include "Scene/KH_Scene.h"
+#include "Pipeline/KH_GLState.h"
+#include "Pipeline/KH_RenderTargetPool.h"
+#include "Pipeline/RenderGraph/KH_PostProcessGraph.h"
 #include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+
+#include <map>
 
 namespace
 {
@@ -15,6 +21,21 @@ namespace
         default:                               return "Unknown";
         }
     }
+
+    float ComputeRMSE(const std::vector<glm::vec4>& Image, const std::vector<glm::vec4>& Reference)
+    {
+        if (Image.empty() || Image.size() != Reference.size())
+            return -1.0f;
+
+        double SquaredError = 0.0;
+        for (size_t i = 0; i < Image.size(); ++i)
+        {
+            const glm::vec3 Diff = glm::vec3(Image[i]) - glm::vec3(Reference[i]);
+            SquaredError += static_cast<double>(glm::dot(Diff, Diff));
+        }
+
+        return static_cast<float>(std::sqrt(SquaredError / (3.0 * static_cast<double>(Image.size()))));
+    }
 }
 
 
@@ -98,9 +119,21 @@ void KH_Insepctor::Render()
         if (Object)
         {
             KH_InspectorEditResult EditResult = Object->DrawInspector();
-            if (EditResult.CommitType == KH_InspectorCommitType::RebuildBVH)
+            switch (EditResult.CommitType)
             {
-                Editor.RequestSceneRebuild();
+            case KH_InspectorCommitType::RebuildBVH:
+                Editor.RequestObjectRebuild(selected);
+                break;
+            case KH_InspectorCommitType::UpdateMaterial:
+                Editor.Scene.UpdatePrimitiveSSBO(static_cast<size_t>(selected));
+                Editor.RequestFrameReset();
+                break;
+            case KH_InspectorCommitType::ReuploadSceneData:
+                Editor.Scene.UpdatePrimitiveSSBO();
+                Editor.RequestFrameReset();
+                break;
+            default:
+                break;
             }
         }
     }
@@ -139,6 +172,35 @@ void KH_GlobalInfo::Render()
         if (ImGui::CollapsingHeader("Renderer", ImGuiTreeNodeFlags_DefaultOpen)) {
             ImGui::Indent(20.0f);
             ImGui::BulletText("GPU: %s", glGetString(GL_RENDERER));
+
+            const KH_ShaderLoadStats& ShaderStats = KH_ShaderManager::Instance().GetLoadStats();
+            ImGui::BulletText("Shaders compiled: %u (%.1f ms)", ShaderStats.ProgramsCompiled, ShaderStats.CompileMilliseconds);
+            ImGui::BulletText("Shaders from cache: %u (%.1f ms)", ShaderStats.ProgramsFromCache, ShaderStats.CacheLoadMilliseconds);
+            ImGui::BulletText("Last primitive upload: %.1f KB", KH_Editor::Instance().Scene.GetLastPrimitiveUploadBytes() / 1024.0);
+
+            KH_GLState& GLState = KH_GLState::Instance();
+            const KH_GLCallStats& CallStats = GLState.GetLastFrameStats();
+            ImGui::BulletText("GL state calls: %u (skipped %u)", CallStats.StateCalls, CallStats.SkippedCalls);
+            ImGui::BulletText("FBO %u / Program %u / Texture %u / Buffer %u / VAO %u / Viewport %u",
+                CallStats.FramebufferBinds, CallStats.ProgramBinds, CallStats.TextureBinds,
+                CallStats.BufferBinds, CallStats.VertexArrayBinds, CallStats.ViewportChanges);
+
+            bool bStateCache = GLState.IsCacheEnabled();
+            if (ImGui::Checkbox("GL State Cache", &bStateCache))
+                GLState.SetCacheEnabled(bStateCache);
+
+            const KH_RenderTargetPoolStats PoolStats = KH_RenderTargetPool::Instance().GetStats();
+            ImGui::BulletText("Render targets: %u (in use %u, %.1f MB)", PoolStats.TargetCount, PoolStats.InUseCount, PoolStats.Bytes / (1024.0 * 1024.0));
+            ImGui::BulletText("Target allocations: %u / reuses: %u", PoolStats.Allocations, PoolStats.Reuses);
+
+            KH_PostProcessGraph& Graph = KH_PostProcessHelper::Instance().SingleGammaCorrectionGraph;
+            ImGui::BulletText("Post-process passes: %u (culled %u, fused %u)", Graph.GetLastExecutedPassCount(),
+                Graph.GetLastCulledPassCount(), Graph.GetLastFusedPassCount());
+            ImGui::BulletText("Post-process GPU: %.3f ms", Graph.GetLastGpuMilliseconds());
+
+            bool bFusion = Graph.IsFusionEnabled();
+            if (ImGui::Checkbox("Fuse Post-Process Passes", &bFusion))
+                Graph.SetFusionEnabled(bFusion);
             ImGui::Unindent(20.0f);
         }
 
@@ -171,6 +233,218 @@ void KH_GlobalInfo::Render()
     ImGui::PopStyleVar();
 }
 
+void KH_ProfilerPanel::Render()
+{
+    ImGui::Begin("Profiler");
+
+    KH_Profiler& Profiler = KH_Profiler::Instance();
+
+    bool bEnabled = Profiler.IsEnabled();
+    if (ImGui::Checkbox("Record", &bEnabled))
+        Profiler.SetEnabled(bEnabled);
+
+    ImGui::SameLine();
+    bool bPaused = Profiler.IsPaused();
+    if (ImGui::Checkbox("Pause", &bPaused))
+        Profiler.SetPaused(bPaused);
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Workers", &bShowWorkerThreads);
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(Profiler.GetHistory().empty());
+    if (ImGui::Button("Export Chrome Trace..."))
+        KH_Editor::Instance().ExportProfilerTrace();
+    ImGui::EndDisabled();
+
+    ImGui::SetNextItemWidth(160.0f);
+    ImGui::SliderFloat("Zoom", &TimelineZoom, 1.0f, 32.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+    const KH_ProfileFrame* Frame = Profiler.GetLatestFrame();
+    if (!Frame)
+    {
+        ImGui::TextDisabled(Profiler.IsEnabled() ? "Waiting for GPU timestamps..." : "Enable Record to capture CPU and GPU scopes");
+    }
+    else
+    {
+        double GpuMilliseconds = 0.0;
+        for (const KH_ProfileEvent& Event : Frame->GpuEvents)
+        {
+            if (Event.Depth == 0)
+                GpuMilliseconds += Event.GetMilliseconds();
+        }
+
+        ImGui::Text("Frame %llu: CPU %.2f ms, GPU %.2f ms, %zu history frames",
+            static_cast<unsigned long long>(Frame->FrameIndex), Frame->GetMilliseconds(), GpuMilliseconds, Profiler.GetHistory().size());
+
+        DrawTimeline(*Frame);
+
+        if (ImGui::CollapsingHeader("Scopes", ImGuiTreeNodeFlags_DefaultOpen))
+            DrawScopeTable(*Frame);
+    }
+
+    bIsFocused = ImGui::IsWindowFocused();
+    bIsHovered = ImGui::IsWindowHovered();
+
+    ImGui::End();
+}
+
+void KH_ProfilerPanel::DrawTimeline(const KH_ProfileFrame& Frame)
+{
+    KH_Profiler& Profiler = KH_Profiler::Instance();
+    const uint32_t RenderThread = Profiler.GetRenderThreadIndex();
+    const std::vector<std::string> ThreadNames = Profiler.GetThreadNames();
+
+    struct KH_TimelineTrack
+    {
+        std::string Label;
+        std::vector<const KH_ProfileEvent*> Events;
+        uint32_t Rows = 1;
+    };
+
+    // 渲染线程在最上，其后是其他线程，GPU 在最下
+    std::map<uint32_t, KH_TimelineTrack> Tracks;
+    double Begin = Frame.BeginMicroseconds;
+    double End = Frame.EndMicroseconds;
+
+    auto AddEvent = [&](const KH_ProfileEvent& Event, uint32_t Order)
+    {
+        KH_TimelineTrack& Track = Tracks[Order];
+        Track.Events.push_back(&Event);
+        Track.Rows = std::max(Track.Rows, Event.Depth + 1);
+        Begin = std::min(Begin, Event.BeginMicroseconds);
+        End = std::max(End, Event.EndMicroseconds);
+    };
+
+    for (const KH_ProfileEvent& Event : Frame.CpuEvents)
+    {
+        if (Event.ThreadIndex == RenderThread)
+            AddEvent(Event, 0);
+        else if (bShowWorkerThreads)
+            AddEvent(Event, Event.ThreadIndex + 1);
+    }
+    for (const KH_ProfileEvent& Event : Frame.GpuEvents)
+        AddEvent(Event, KH_Profiler::GpuThreadIndex + 1);
+
+    for (auto& [Order, Track] : Tracks)
+    {
+        if (Order == KH_Profiler::GpuThreadIndex + 1)
+            Track.Label = "GPU";
+        else
+        {
+            const uint32_t Thread = Order == 0 ? RenderThread : Order - 1;
+            Track.Label = Thread < ThreadNames.size() ? ThreadNames[Thread] : std::format("Thread {}", Thread);
+        }
+    }
+
+    const float RowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const float TrackSpacing = 6.0f;
+    const float LabelWidth = 90.0f;
+
+    float ContentHeight = 0.0f;
+    for (const auto& [Order, Track] : Tracks)
+        ContentHeight += Track.Rows * RowHeight + TrackSpacing;
+
+    const float ChildHeight = std::min(ContentHeight + ImGui::GetStyle().ScrollbarSize + 8.0f, 320.0f);
+    if (!ImGui::BeginChild("ProfilerTimeline", ImVec2(0.0f, ChildHeight), true, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    const float TimelineWidth = std::max(ImGui::GetContentRegionAvail().x - LabelWidth, 100.0f) * TimelineZoom;
+    const double Scale = TimelineWidth / std::max(End - Begin, 1.0);
+
+    ImDrawList* DrawList = ImGui::GetWindowDrawList();
+    const ImVec2 Origin = ImGui::GetCursorScreenPos();
+    const ImU32 TextColor = ImGui::GetColorU32(ImGuiCol_Text);
+
+    float Y = Origin.y;
+    for (const auto& [Order, Track] : Tracks)
+    {
+        DrawList->AddText(ImVec2(Origin.x, Y + 2.0f), TextColor, Track.Label.c_str());
+
+        for (const KH_ProfileEvent* Event : Track.Events)
+        {
+            const float X0 = Origin.x + LabelWidth + static_cast<float>((Event->BeginMicroseconds - Begin) * Scale);
+            const float X1 = std::max(X0 + 1.0f, Origin.x + LabelWidth + static_cast<float>((Event->EndMicroseconds - Begin) * Scale));
+            const float Y0 = Y + Event->Depth * RowHeight;
+            const float Y1 = Y0 + RowHeight - 1.0f;
+
+            // 同名作用域颜色固定，便于跨帧对照
+            const float Hue = static_cast<float>(std::hash<std::string_view>{}(Event->Name) % 360) / 360.0f;
+            DrawList->AddRectFilled(ImVec2(X0, Y0), ImVec2(X1, Y1), ImColor::HSV(Hue, 0.45f, 0.75f));
+
+            if (X1 - X0 > 24.0f)
+            {
+                DrawList->PushClipRect(ImVec2(X0, Y0), ImVec2(X1, Y1), true);
+                DrawList->AddText(ImVec2(X0 + 3.0f, Y0 + 2.0f), IM_COL32(10, 10, 10, 255), Event->Name);
+                DrawList->PopClipRect();
+            }
+
+            if (ImGui::IsMouseHoveringRect(ImVec2(X0, Y0), ImVec2(X1, Y1)))
+                ImGui::SetTooltip("%s\n%.3f ms", Event->Name, Event->GetMilliseconds());
+        }
+
+        Y += Track.Rows * RowHeight + TrackSpacing;
+    }
+
+    ImGui::Dummy(ImVec2(LabelWidth + TimelineWidth, Y - Origin.y));
+    ImGui::EndChild();
+}
+
+void KH_ProfilerPanel::DrawScopeTable(const KH_ProfileFrame& Frame)
+{
+    const uint32_t RenderThread = KH_Profiler::Instance().GetRenderThreadIndex();
+
+    // 作用域在结束时记录，子作用域先于父作用域，按开始时间还原层级顺序
+    std::vector<const KH_ProfileEvent*> CpuEvents;
+    for (const KH_ProfileEvent& Event : Frame.CpuEvents)
+    {
+        if (Event.ThreadIndex == RenderThread)
+            CpuEvents.push_back(&Event);
+    }
+    std::sort(CpuEvents.begin(), CpuEvents.end(), [](const KH_ProfileEvent* A, const KH_ProfileEvent* B)
+    {
+        return A->BeginMicroseconds < B->BeginMicroseconds;
+    });
+
+    // GPU 作用域与同名的 CPU 作用域成对记录，名称指针相同
+    std::unordered_map<const char*, double> GpuMilliseconds;
+    for (const KH_ProfileEvent& Event : Frame.GpuEvents)
+        GpuMilliseconds[Event.Name] += Event.GetMilliseconds();
+
+    const ImGuiTableFlags Flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("ProfilerScopes", 3, Flags))
+        return;
+
+    ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+    ImGui::TableSetupColumn("CPU ms", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+    ImGui::TableSetupColumn("GPU ms", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+    ImGui::TableHeadersRow();
+
+    for (const KH_ProfileEvent* Event : CpuEvents)
+    {
+        ImGui::TableNextRow();
+
+        ImGui::TableSetColumnIndex(0);
+        ImGui::Indent(Event->Depth * 12.0f + 1.0f);
+        ImGui::TextUnformatted(Event->Name);
+        ImGui::Unindent(Event->Depth * 12.0f + 1.0f);
+
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Text("%.3f", Event->GetMilliseconds());
+
+        ImGui::TableSetColumnIndex(2);
+        if (auto It = GpuMilliseconds.find(Event->Name); It != GpuMilliseconds.end())
+            ImGui::Text("%.3f", It->second);
+        else
+            ImGui::TextDisabled("-");
+    }
+
+    ImGui::EndTable();
+}
+
 void KH_SceneTree::Render()
 {
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
@@ -192,6 +466,14 @@ void KH_SceneTree::Render()
     ImGui::TextDisabled("| Active: %s", ShaderFeatureDisplayName(ActiveType));
     ImGui::SameLine();
     ImGui::TextDisabled("| Materials: %d", ActiveMaterialCount);
+
+    const KH_SceneLoader& Loader = Editor.GetSceneLoader();
+    if (Loader.IsLoading())
+    {
+        const KH_SceneLoadProgress& Progress = Loader.GetProgress();
+        ImGui::ProgressBar(Progress.GetFraction(), ImVec2(-1.0f, 0.0f),
+            std::format("Loading {}/{} models", Progress.LoadedModels + Progress.FailedModels, Progress.TotalModels).c_str());
+    }
     ImGui::Unindent(10.0f);
 
     ImGui::Separator();
@@ -268,6 +550,15 @@ void KH_SceneTree::Render()
     ImGui::PopStyleVar();
 }
 
+KH_RenderPipeline::~KH_RenderPipeline()
+{
+    if (PendingCpuReference.valid())
+    {
+        CpuTracer.Cancel();
+        PendingCpuReference.wait();
+    }
+}
+
 void KH_RenderPipeline::Render()
 {
     KH_Editor& Editor = KH_Editor::Instance();
@@ -327,6 +618,61 @@ void KH_RenderPipeline::Render()
 
         ImGui::PopItemWidth();
 
+        bool bSpecialize = KH_ShaderFeatureBase::IsSpecializationEnabled();
+        if (ImGui::Checkbox("Specialize Shader Permutations", &bSpecialize))
+        {
+            KH_ShaderFeatureBase::SetSpecializationEnabled(bSpecialize);
+            Editor.RequestFrameReset();
+        }
+        ImGui::TextDisabled("Compile feature toggles into the shader; each combination is built on first use.");
+
+        ImGui::SeparatorText("Accumulation");
+
+        bool bEnableReprojection = Editor.IsTemporalReprojectionEnabled();
+        if (ImGui::Checkbox("Temporal Reprojection", &bEnableReprojection))
+        {
+            Editor.SetTemporalReprojectionEnabled(bEnableReprojection);
+            Editor.RequestFrameReset();
+        }
+
+        if (bEnableReprojection)
+        {
+            ImGui::Indent(20.0f);
+            float HistoryClamp = Editor.GetHistoryClamp();
+            if (ImGui::SliderFloat("History Clamp", &HistoryClamp, 1.0f, 256.0f, "%.0f spp"))
+            {
+                Editor.SetHistoryClamp(HistoryClamp);
+            }
+            ImGui::TextDisabled("Max samples kept from reprojected history after a camera move.");
+            ImGui::Unindent(20.0f);
+        }
+
+        int SampleLimit = static_cast<int>(Editor.GetSampleLimit());
+        if (ImGui::InputInt("Sample Limit", &SampleLimit, 256, 1024))
+        {
+            Editor.SetSampleLimit(static_cast<uint32_t>(std::max(SampleLimit, 1)));
+        }
+
+        static int MoreSamples = 1024;
+        ImGui::InputInt("##MoreSamples", &MoreSamples, 256, 1024);
+        MoreSamples = std::max(MoreSamples, 1);
+        ImGui::SameLine();
+        if (ImGui::Button("Render More Samples"))
+        {
+            Editor.RenderMoreSamples(static_cast<uint32_t>(MoreSamples));
+        }
+
+        bool bIdleSkip = Editor.IsIdleSkipEnabled();
+        if (ImGui::Checkbox("Pause When Converged", &bIdleSkip))
+        {
+            Editor.SetIdleSkipEnabled(bIdleSkip);
+        }
+
+        ImGui::Text("Samples: %u / %u%s", Editor.GetAccumulatedFrames(), Editor.GetSampleTarget(),
+            Editor.IsIdleFrame() ? " (idle)" : "");
+
+        DrawCheckpointPanel();
+
         ImGui::Separator();
 
         if (KH_ShaderFeatureBase* ActiveFeature = Scene.GetActiveShaderFeature())
@@ -335,6 +681,8 @@ void KH_RenderPipeline::Render()
             ImGui::Spacing();
             ActiveFeature->DrawControlPanel();
         }
+
+        DrawConvergencePanel();
     }
 
     bIsFocused = ImGui::IsWindowFocused();
@@ -343,3 +691,171 @@ void KH_RenderPipeline::Render()
     ImGui::End();
     ImGui::PopStyleVar();
 }
+
+void KH_RenderPipeline::DrawCheckpointPanel()
+{
+    KH_Editor& Editor = KH_Editor::Instance();
+
+    ImGui::SeparatorText("Checkpoint");
+    ImGui::Indent(20.0f);
+
+    bool bAutoCheckpoint = Editor.IsCheckpointEnabled();
+    if (ImGui::Checkbox("Auto Checkpoint", &bAutoCheckpoint))
+    {
+        Editor.SetCheckpointEnabled(bAutoCheckpoint);
+    }
+
+    if (bAutoCheckpoint)
+    {
+        int Interval = static_cast<int>(Editor.GetCheckpointInterval());
+        if (ImGui::InputInt("Every N Samples", &Interval, 256, 1024))
+        {
+            Editor.SetCheckpointInterval(static_cast<uint32_t>(std::max(Interval, 1)));
+        }
+    }
+
+    ImGui::BeginDisabled(Editor.IsCheckpointWritePending());
+    if (ImGui::Button("Save Checkpoint"))
+    {
+        Editor.RequestCheckpointSave();
+    }
+    ImGui::EndDisabled();
+
+    ImGui::SameLine();
+    if (ImGui::Button("Resume From Checkpoint"))
+    {
+        Editor.RequestCheckpointLoad();
+    }
+
+    ImGui::TextDisabled("%s", Editor.GetCheckpointPath().c_str());
+    ImGui::Unindent(20.0f);
+}
+
+void KH_RenderPipeline::DrawConvergencePanel()
+{
+    KH_Editor& Editor = KH_Editor::Instance();
+
+    ImGui::SeparatorText("Convergence");
+    ImGui::Indent(20.0f);
+
+    // 本帧的累积结果已写入当前 Scene Framebuffer
+    const KH_Framebuffer& Framebuffer = Editor.GetCanvas().GetSceneFramebuffer();
+    const glm::uvec2 Extent(Framebuffer.GetWidth(), Framebuffer.GetHeight());
+    const uint32_t Samples = Editor.GetFrameCounter() + 1;
+
+    if (ImGui::Button("Capture Reference"))
+    {
+        if (Framebuffer.ReadColorAttachment(ReferenceImage, 0))
+        {
+            ReferenceExtent = Extent;
+            ReferenceSamples = Samples;
+            LastRMSE = -1.0f;
+            LOG_D(std::format("Captured convergence reference at {} spp", ReferenceSamples));
+        }
+    }
+
+    const bool bHasReference = !ReferenceImage.empty() && ReferenceExtent == Extent;
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!bHasReference);
+    if (ImGui::Button("Compute RMSE"))
+    {
+        std::vector<glm::vec4> Image;
+        if (Framebuffer.ReadColorAttachment(Image, 0))
+        {
+            LastRMSE = ComputeRMSE(Image, ReferenceImage);
+            LastRMSESamples = Samples;
+            LOG_D(std::format("RMSE at {} spp against {} spp reference: {:.6f}", LastRMSESamples, ReferenceSamples, LastRMSE));
+        }
+    }
+    ImGui::EndDisabled();
+
+    DrawCpuReference(Extent);
+
+    if (!ReferenceImage.empty())
+    {
+        if (bHasReference)
+            ImGui::Text("Reference: %u spp", ReferenceSamples);
+        else
+            ImGui::TextDisabled("Reference extent differs from canvas, capture again");
+    }
+
+    if (LastRMSE >= 0.0f)
+    {
+        ImGui::Text("RMSE: %.6f @ %u spp", LastRMSE, LastRMSESamples);
+    }
+
+    ImGui::Unindent(20.0f);
+}
+
+void KH_RenderPipeline::DrawCpuReference(glm::uvec2 Extent)
+{
+    KH_Editor& Editor = KH_Editor::Instance();
+
+    if (PendingCpuReference.valid())
+    {
+        if (PendingCpuReference.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            const float Progress = CpuTracer.GetProgress();
+            ImGui::ProgressBar(Progress, ImVec2(-1.0f, 0.0f), std::format("CPU Reference {:.0f}%", Progress * 100.0f).c_str());
+            if (ImGui::Button("Cancel CPU Reference"))
+            {
+                CpuTracer.Cancel();
+            }
+            return;
+        }
+
+        if (PendingCpuReference.get())
+        {
+            const KH_CpuRenderSettings& Settings = CpuTracer.GetSettings();
+            ReferenceImage = std::move(CpuReferencePixels);
+            ReferenceExtent = glm::uvec2(Settings.Width, Settings.Height);
+            ReferenceSamples = Settings.SamplesPerPixel;
+            LastRMSE = -1.0f;
+        }
+        CpuReferencePixels.clear();
+    }
+
+    const KH_DisneyBSDF* Feature = Editor.Scene.GetShaderFeatureAs<KH_DisneyBSDF>(KH_ShaderFeatureType::DisneyBSDF);
+    const bool bCanRender = Feature && Editor.Scene.GetActiveShaderFeatureType() == KH_ShaderFeatureType::DisneyBSDF;
+
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::InputInt("##CpuReferenceSamples", &CpuReferenceSamples, 64, 256);
+    CpuReferenceSamples = std::max(CpuReferenceSamples, 1);
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!bCanRender);
+    if (ImGui::Button("Render CPU Reference"))
+    {
+        KH_CpuRenderSettings Settings;
+        Settings.Width = Extent.x;
+        Settings.Height = Extent.y;
+        Settings.SamplesPerPixel = static_cast<uint32_t>(CpuReferenceSamples);
+        Settings.bEnableSkybox = Feature->IsSkyboxEnabled();
+        Settings.bEnableVNDF = Feature->IsVNDFEnabled();
+        Settings.bEnableSobol = Feature->IsSobolEnabled();
+
+        // 场景快照在主线程完成，工作线程只访问 CpuTracer 内部数据
+        if (CpuTracer.Prepare(Editor.Scene, Editor.Camera, Settings))
+        {
+            PendingCpuReference = KH_JobSystem::Instance().Async([this]()
+            {
+                return CpuTracer.Render(CpuReferencePixels);
+            });
+        }
+    }
+    ImGui::EndDisabled();
+
+    if (!bCanRender)
+    {
+        ImGui::TextDisabled("CPU reference requires the DisneyBSDF feature");
+    }
+    else if (CpuTracer.IsPrepared())
+    {
+        const KH_CpuRenderStats& Stats = CpuTracer.GetStats();
+        if (Stats.RenderMilliseconds > 0.0f)
+        {
+            ImGui::Text("CPU: %u tris, %d threads, %.1f s", Stats.TriangleCount, Stats.ThreadCount, Stats.RenderMilliseconds / 1000.0f);
+        }
+    }
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Pipeline/KH_Framebuffer.h"
+#include "Pipeline/KH_CpuPathTracer.h"
 #include "Utils/KH_Timer.h"
+#include "Utils/KH_Profiler.h"
 
 struct KH_LOG_MESSAGE;
 
@@ -56,12 +58,48 @@ public:
     void Render() override;
 };
 
+// 最近一帧完整数据的 CPU / GPU 时间线与各阶段耗时
+class KH_ProfilerPanel : public KH_Panel
+{
+public:
+    KH_ProfilerPanel() = default;
+    ~KH_ProfilerPanel() override = default;
+
+    void Render() override;
+
+private:
+    void DrawTimeline(const KH_ProfileFrame& Frame);
+    void DrawScopeTable(const KH_ProfileFrame& Frame);
+
+    float TimelineZoom = 1.0f;
+    bool bShowWorkerThreads = true;
+};
+
 // 保留类名兼容现有调用；UI 窗口标题改为更清晰的 “Render Pipeline”
 class KH_RenderPipeline : public KH_Panel
 {
 public:
     KH_RenderPipeline() = default;
-    ~KH_RenderPipeline() override = default;
+    ~KH_RenderPipeline() override;
 
     void Render() override;
+
+private:
+    void DrawCheckpointPanel();
+    void DrawConvergencePanel();
+    void DrawCpuReference(glm::uvec2 Extent);
+
+    // 收敛对比：先累积一张高 spp 参考图，再在相同 spp 下比较不同采样器的 RMSE
+    std::vector<glm::vec4> ReferenceImage;
+    glm::uvec2 ReferenceExtent = glm::uvec2(0);
+    uint32_t ReferenceSamples = 0;
+
+    float LastRMSE = -1.0f;
+    uint32_t LastRMSESamples = 0;
+
+    // CPU 参考图在工作线程渲染，完成后替换 ReferenceImage
+    KH_CpuPathTracer CpuTracer;
+    std::future<bool> PendingCpuReference;
+    std::vector<glm::vec4> CpuReferencePixels;
+    int CpuReferenceSamples = 256;
 };
@@ -2,6 +2,7 @@
 #include "KH_Camera.h"
 
 #include "KH_Editor.h"
+#include "Pipeline/KH_GLState.h"
 
 KH_Camera* KH_Window::Camera = nullptr;
 
@@ -81,7 +82,7 @@ void KH_Window::Initialize()
         return;
     }
 
-    glViewport(0, 0, KH_Editor::GetCanvasWidth(), KH_Editor::GetCanvasHeight());
+    KH_GLState::Instance().Viewport(0, 0, KH_Editor::GetCanvasWidth(), KH_Editor::GetCanvasHeight());
     glfwSetWindowUserPointer(Window, this);
     glfwSetFramebufferSizeCallback(Window, FramebufferSizeCallback);
     glfwSetCursorPosCallback(Window, MouseMovementCallback);
@@ -0,0 +1,487 @@
+#include "KH_HeadlessRenderer.h"
+#include "KH_OffscreenContext.h"
+#include "Scene/KH_Scene.h"
+#include "Scene/KH_SceneLoader.h"
+#include "Pipeline/KH_Texture.h"
+#include "Pipeline/KH_GLState.h"
+#include "Pipeline/KH_RenderTargetPool.h"
+#include "Pipeline/KH_AccumulationCheckpoint.h"
+#include "Pipeline/KH_CpuPathTracer.h"
+#include "Pipeline/KH_FrameCapture.h"
+#include "Pipeline/RenderGraph/KH_PostProcessGraph.h"
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+#include "Utils/KH_Profiler.h"
+
+namespace
+{
+    bool ParseUInt(const char* text, uint32_t& outValue)
+    {
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(text, &end, 10);
+        if (end == text || *end != '\0' || value == 0)
+            return false;
+
+        outValue = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    bool ParseFloat(const char* text, float& outValue)
+    {
+        char* end = nullptr;
+        const float value = std::strtof(text, &end);
+        if (end == text || *end != '\0' || !std::isfinite(value))
+            return false;
+
+        outValue = value;
+        return true;
+    }
+
+    // 逗号分隔的三个分量，如 "0,1.5,-3"
+    bool ParseVec3(const char* text, glm::vec3& outValue)
+    {
+        glm::vec3 value;
+        const char* cursor = text;
+        for (int i = 0; i < 3; ++i)
+        {
+            char* end = nullptr;
+            value[i] = std::strtof(cursor, &end);
+            if (end == cursor || !std::isfinite(value[i]))
+                return false;
+
+            const char expected = (i < 2) ? ',' : '\0';
+            if (*end != expected)
+                return false;
+            cursor = end + 1;
+        }
+
+        outValue = value;
+        return true;
+    }
+
+    bool ParseToggle(const char* text, bool& outValue)
+    {
+        const std::string value = text;
+        if (value == "on" || value == "1" || value == "true")
+            outValue = true;
+        else if (value == "off" || value == "0" || value == "false")
+            outValue = false;
+        else
+            return false;
+
+        return true;
+    }
+}
+
+KH_HeadlessRenderer::~KH_HeadlessRenderer()
+{
+    Scene.reset();
+
+    // 离屏上下文是单例，此时仍然有效
+    KH_FrameCapture::Instance().Shutdown();
+    KH_Profiler::Instance().Shutdown();
+
+    if (KH_RenderContext::HasCurrent() && &KH_RenderContext::Current() == this)
+        KH_RenderContext::SetCurrent(nullptr);
+}
+
+bool KH_HeadlessRenderer::IsHeadlessRequested(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+            return true;
+    }
+
+    return false;
+}
+
+bool KH_HeadlessRenderer::ParseArguments(int argc, char** argv, KH_HeadlessSettings& outSettings)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--headless")
+            continue;
+
+        if (i + 1 >= argc)
+        {
+            LOG_E(std::format("Headless: missing value for {}", arg));
+            return false;
+        }
+
+        const char* value = argv[++i];
+        bool bValid = true;
+
+        if (arg == "--scene")
+            outSettings.ScenePath = value;
+        else if (arg == "--output")
+            outSettings.OutputPath = value;
+        else if (arg == "--width")
+            bValid = ParseUInt(value, outSettings.Width);
+        else if (arg == "--height")
+            bValid = ParseUInt(value, outSettings.Height);
+        else if (arg == "--samples")
+            bValid = ParseUInt(value, outSettings.Samples);
+        else if (arg == "--camera-position")
+            bValid = ParseVec3(value, outSettings.CameraPosition);
+        else if (arg == "--camera-yaw")
+            bValid = ParseFloat(value, outSettings.CameraYaw);
+        else if (arg == "--camera-pitch")
+            bValid = ParseFloat(value, outSettings.CameraPitch) && std::abs(outSettings.CameraPitch) < 90.0f;
+        else if (arg == "--fov")
+            bValid = ParseFloat(value, outSettings.CameraFovy) && outSettings.CameraFovy > 0.0f && outSettings.CameraFovy < 180.0f;
+        else if (arg == "--skybox")
+            bValid = ParseToggle(value, outSettings.Toggles.bEnableSkybox);
+        else if (arg == "--vndf")
+            bValid = ParseToggle(value, outSettings.Toggles.bEnableVNDF);
+        else if (arg == "--sobol")
+            bValid = ParseToggle(value, outSettings.Toggles.bEnableSobol);
+        else if (arg == "--checkpoint")
+            outSettings.CheckpointPath = value;
+        else if (arg == "--checkpoint-interval")
+            bValid = ParseUInt(value, outSettings.CheckpointInterval);
+        else if (arg == "--threads")
+            bValid = ParseUInt(value, outSettings.Threads);
+        else if (arg == "--profile")
+            outSettings.ProfilePath = value;
+        else if (arg == "--capture-rays")
+            outSettings.RayCapturePath = value;
+        else if (arg == "--capture-samples")
+            bValid = ParseUInt(value, outSettings.RayCaptureSamples);
+        else
+        {
+            LOG_E(std::format("Headless: unknown argument {}", arg));
+            return false;
+        }
+
+        if (!bValid)
+        {
+            LOG_E(std::format("Headless: invalid value '{}' for {}", value, arg));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool KH_HeadlessRenderer::Run(const KH_HeadlessSettings& settings)
+{
+    Settings = settings;
+
+    if (!KH_OffscreenContext::Instance().Create(Settings.Width, Settings.Height))
+        return false;
+
+    KH_RenderContext::SetCurrent(this);
+
+    glEnable(GL_DEPTH_TEST);
+    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+    KH_Profiler& profiler = KH_Profiler::Instance();
+    const bool bProfile = !Settings.ProfilePath.empty();
+    if (bProfile)
+    {
+        // 场景构建算作第 0 帧
+        profiler.SetWaitForGpuResults(true);
+        profiler.SetEnabled(true);
+        profiler.BeginFrame();
+    }
+
+    if (!InitializeTargets() || !LoadScene())
+        return false;
+
+    // CPU 追踪器自己解码环境贴图，不必等待 GPU 天空盒上传
+    if (!Settings.RayCapturePath.empty())
+        return CaptureRays();
+
+    if (Settings.Toggles.bEnableSkybox)
+        WaitForSkybox();
+
+    uint32_t firstSample = 0;
+    if (!ResumeFromCheckpoint(firstSample))
+        return false;
+
+    LOG_D(std::format("Headless: rendering {} ({}x{}, {} spp)",
+        Settings.ScenePath, Settings.Width, Settings.Height, Settings.Samples));
+
+    const auto start = std::chrono::steady_clock::now();
+    const uint32_t reportInterval = std::max(Settings.Samples / 10u, 1u);
+    const bool bCheckpoint = !Settings.CheckpointPath.empty();
+
+    for (uint32_t sample = firstSample; sample < Settings.Samples; ++sample)
+    {
+        RenderSample();
+
+        const uint32_t accumulated = sample + 1;
+        const bool bLastSample = accumulated == Settings.Samples;
+
+        if (bCheckpoint && (bLastSample || accumulated % Settings.CheckpointInterval == 0))
+            SaveCheckpoint(accumulated);
+
+        if (bLastSample)
+            break;
+
+        FrameBufferHandle = (FrameBufferHandle + 1) % 2;
+        FrameCounter++;
+
+        if (accumulated % reportInterval == 0)
+            LOG_D(std::format("Headless: {}/{} samples", accumulated, Settings.Samples));
+    }
+
+    // 检查点已达到目标样本数时不再渲染，恢复的累积位于历史目标，交换后直接做后处理
+    if (firstSample >= Settings.Samples)
+        FrameBufferHandle = (FrameBufferHandle + 1) % 2;
+
+    // 后处理只需作用于最终累积结果
+    KH_PostProcessHelper::Instance().SingleGammaCorrectionGraph.Execute();
+
+    glFinish();
+    const float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+    if (bProfile)
+    {
+        // GPU 已空闲，收尾最后一帧后所有查询都可取回
+        profiler.SetEnabled(false);
+        profiler.BeginFrame();
+        profiler.ExportChromeTrace(Settings.ProfilePath);
+    }
+
+    // PNG 写后处理结果；HDR/EXR 写线性累积，不做色调映射
+    const bool bLinear = KH_FrameCapture::FormatFromPath(Settings.OutputPath) != KH_CaptureFormat::PNG;
+    const KH_Framebuffer& output = (PresentFramebuffer && !bLinear) ? *PresentFramebuffer : GetSceneFramebuffer();
+
+    KH_FrameCapture& capture = KH_FrameCapture::Instance();
+    const uint32_t failedBefore = capture.GetStats().FailedCaptures;
+    if (!capture.Capture(output, Settings.OutputPath))
+    {
+        LOG_E(std::format("Headless: failed to write {}", Settings.OutputPath));
+        return false;
+    }
+
+    capture.Flush();
+    if (capture.GetStats().FailedCaptures != failedBefore)
+        return false;
+
+    LOG_D(std::format("Headless: wrote {} in {:.2f} s", Settings.OutputPath, seconds));
+    return true;
+}
+
+bool KH_HeadlessRenderer::InitializeTargets()
+{
+    Camera = KH_Camera(Settings.Width, Settings.Height, Settings.CameraPosition, glm::vec3(0.0f, 1.0f, 0.0f),
+        Settings.CameraYaw, Settings.CameraPitch);
+    Camera.Fovy = Settings.CameraFovy;
+    Camera.UpdateAspect();
+
+    // 与画布的场景目标一致，着色器按相同布局写入颜色与 GBuffer
+    KH_FramebufferDescription sceneDesc;
+    sceneDesc.Width = Settings.Width;
+    sceneDesc.Height = Settings.Height;
+    sceneDesc.Attachments = {
+        KH_FramebufferTextureFormat::RGBA32F,      // Scene Color (a: sample count)
+        KH_FramebufferTextureFormat::RGBA32F,      // GBuffer (xyz: normal, w: view depth)
+        KH_FramebufferTextureFormat::DEPTH32F      // Depth
+    };
+
+    SceneFramebuffer[0].Create(sceneDesc);
+    SceneFramebuffer[1].Create(sceneDesc);
+
+    for (const KH_Framebuffer& framebuffer : SceneFramebuffer)
+    {
+        framebuffer.Bind();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        framebuffer.Unbind();
+    }
+
+    return true;
+}
+
+bool KH_HeadlessRenderer::LoadScene()
+{
+    Scene = std::make_unique<KH_GpuLBVHScene>();
+
+    // 资产模型并发导入，全部到齐后只构建一次 BVH
+    KH_SceneLoader loader;
+    if (!loader.Begin(*Scene, Settings.ScenePath))
+    {
+        LOG_E(std::format("Headless: failed to load scene {}", Settings.ScenePath));
+        return false;
+    }
+    loader.Wait();
+
+    Scene->EnsureDefaultMaterials();
+    Scene->UpdateMaterialSSBO();
+    Scene->BindAndBuild();
+
+    for (size_t i = 0; i < KH_ShaderFeatureTypeCount; ++i)
+    {
+        if (KH_ShaderFeatureBase* feature = Scene->GetShaderFeature(static_cast<KH_ShaderFeatureType>(i)))
+            feature->SetToggles(Settings.Toggles);
+    }
+    return true;
+}
+
+bool KH_HeadlessRenderer::CaptureRays()
+{
+    KH_CpuRenderSettings cpuSettings;
+    cpuSettings.Width = Settings.Width;
+    cpuSettings.Height = Settings.Height;
+    cpuSettings.SamplesPerPixel = Settings.RayCaptureSamples;
+    cpuSettings.RayCapturePath = Settings.RayCapturePath;
+    cpuSettings.RayCaptureSamples = Settings.RayCaptureSamples;
+    cpuSettings.RayCaptureSceneName = Settings.ScenePath;
+
+    // 与 GPU 渲染使用相同的开关，录下的光线分布与 GPU 路径一致
+    cpuSettings.bEnableSkybox = Settings.Toggles.bEnableSkybox;
+    cpuSettings.bEnableVNDF = Settings.Toggles.bEnableVNDF;
+    cpuSettings.bEnableSobol = Settings.Toggles.bEnableSobol;
+
+    KH_CpuPathTracer tracer;
+    if (!tracer.Prepare(*Scene, Camera, cpuSettings))
+        return false;
+
+    LOG_D(std::format("Headless: capturing rays of {} ({}x{}, {} spp)",
+        Settings.ScenePath, Settings.Width, Settings.Height, Settings.RayCaptureSamples));
+
+    std::vector<glm::vec4> pixels;
+    if (!tracer.Render(pixels))
+    {
+        LOG_E(std::format("Headless: failed to capture rays to {}", Settings.RayCapturePath));
+        return false;
+    }
+
+    LOG_D(std::format("Headless: wrote ray set {}", Settings.RayCapturePath));
+    return true;
+}
+
+void KH_HeadlessRenderer::WaitForSkybox()
+{
+    // 编辑器逐帧执行天空盒的上传任务；离线渲染须在第一帧之前等它上传完成
+    KH_ExampleTextures& textures = KH_ExampleTextures::Instance();
+    while (textures.IsSkyboxPending())
+    {
+        if (KH_JobSystem::Instance().RunMainThreadJobs() == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        textures.Update();
+    }
+}
+
+bool KH_HeadlessRenderer::ResumeFromCheckpoint(uint32_t& outFirstSample)
+{
+    outFirstSample = 0;
+    if (Settings.CheckpointPath.empty())
+        return true;
+
+    // 相机来自命令行，检查点不能覆盖它，因此并入兼容性哈希
+    const uint64_t sceneHash = KH_AccumulationCheckpoint::ComputeSceneHash(*Scene, GetRenderExtent());
+    SceneHash = KH_AccumulationCheckpoint::ComputeCameraHash(Camera, sceneHash);
+
+    KH_AccumulationCheckpoint checkpoint;
+    if (!std::filesystem::exists(Settings.CheckpointPath) || !checkpoint.LoadFromFile(Settings.CheckpointPath))
+        return true;
+
+    if (checkpoint.SceneHash == checkpoint.ComputeCameraHash(sceneHash) &&
+        checkpoint.ComputeCameraHash(0) != KH_AccumulationCheckpoint::ComputeCameraHash(Camera, 0))
+    {
+        // 继续渲染会用新相机的结果覆盖旧检查点
+        LOG_E(std::format("Headless: checkpoint {} was saved with a different camera; "
+            "pass the same --camera-position/--camera-yaw/--camera-pitch/--fov or remove the checkpoint",
+            Settings.CheckpointPath));
+        return false;
+    }
+
+    if (checkpoint.SceneHash != SceneHash)
+    {
+        LOG_W(std::format("Headless: checkpoint {} does not match the scene or resolution, starting over",
+            Settings.CheckpointPath));
+        return true;
+    }
+
+    if (!checkpoint.RestoreAccumulation(SceneFramebuffer[(FrameBufferHandle + 1) % 2]))
+        return true;
+
+    FrameCounter = checkpoint.FrameCounter;
+
+    LOG_D(std::format("Headless: resumed {} at {} spp", Settings.CheckpointPath, checkpoint.AccumulatedFrames));
+    outFirstSample = checkpoint.AccumulatedFrames;
+    return true;
+}
+
+void KH_HeadlessRenderer::SaveCheckpoint(uint32_t accumulatedFrames) const
+{
+    // 当前目标刚写入第 accumulatedFrames 个样本，下一帧的帧计数为 FrameCounter + 1
+    KH_AccumulationCheckpoint checkpoint;
+    if (!checkpoint.Capture(SceneFramebuffer[FrameBufferHandle], Camera, FrameCounter + 1, accumulatedFrames, SceneHash))
+    {
+        LOG_W("Headless: failed to read back the accumulation buffer for a checkpoint");
+        return;
+    }
+
+    if (checkpoint.SaveToFile(Settings.CheckpointPath))
+        LOG_D(std::format("Headless: checkpoint saved at {} spp", accumulatedFrames));
+}
+
+void KH_HeadlessRenderer::RenderSample()
+{
+    KH_Profiler::Instance().BeginFrame();
+    KH_PROFILE_SCOPE("RenderSample");
+
+    KH_GLState::Instance().BeginFrame();
+    KH_RenderTargetPool::Instance().BeginFrame();
+
+    KH_Framebuffer& framebuffer = GetSceneFramebuffer();
+    framebuffer.Bind();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    Scene->BeginFrame();
+    Scene->Render();
+
+    framebuffer.Unbind();
+}
+
+const KH_Camera& KH_HeadlessRenderer::GetCamera() const
+{
+    return Camera;
+}
+
+KH_Framebuffer& KH_HeadlessRenderer::GetSceneFramebuffer()
+{
+    return SceneFramebuffer[FrameBufferHandle];
+}
+
+const KH_Framebuffer& KH_HeadlessRenderer::GetLastFramebuffer()
+{
+    return SceneFramebuffer[(FrameBufferHandle + 1) % 2];
+}
+
+void KH_HeadlessRenderer::SetPresentFramebuffer(const KH_Framebuffer* framebuffer)
+{
+    PresentFramebuffer = framebuffer;
+}
+
+glm::uvec2 KH_HeadlessRenderer::GetRenderExtent() const
+{
+    return { Settings.Width, Settings.Height };
+}
+
+uint32_t KH_HeadlessRenderer::GetFrameCounter() const
+{
+    return FrameCounter;
+}
+
+uint32_t KH_HeadlessRenderer::GetSampleTarget() const
+{
+    return Settings.Samples;
+}
+
+bool KH_HeadlessRenderer::IsTemporalReprojectionEnabled() const
+{
+    // 相机固定，累积历史始终有效
+    return false;
+}
+
+float KH_HeadlessRenderer::GetHistoryClamp() const
+{
+    return 0.0f;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "Editor/KH_Camera.h"
+#include "Pipeline/KH_Framebuffer.h"
+#include "Pipeline/KH_RenderContext.h"
+#include "Pipeline/KH_ShaderFeature.h"
+
+class KH_GpuLBVHScene;
+
+struct KH_HeadlessSettings
+{
+    std::string ScenePath = "Assert/Scenes/Bunny.xml";
+    std::string OutputPath = "HeadlessOutput.png";
+    uint32_t Width = 1280;
+    uint32_t Height = 720;
+    uint32_t Samples = 256;
+
+    // 默认与编辑器启动时的相机一致
+    glm::vec3 CameraPosition = glm::vec3(2.0f, 2.0f, 2.0f);
+    float CameraYaw = -140.0f;
+    float CameraPitch = -35.0f;
+    float CameraFovy = 45.0f;
+
+    // 应用到场景的全部着色特性，默认与编辑器面板一致（全部关闭）
+    KH_ShaderFeatureToggles Toggles;
+
+    // 非空时先尝试从该检查点续算，并每 CheckpointInterval 个样本及结束时写回
+    std::string CheckpointPath;
+    uint32_t CheckpointInterval = 256;
+
+    // 作业系统的工作线程数，0 表示按硬件线程数自动选择
+    uint32_t Threads = 0;
+
+    // 非空时记录每个样本的 CPU/GPU 作用域，结束后写出 Chrome trace
+    std::string ProfilePath;
+
+    // 非空时不渲染图像，改用 CPU 参考路径追踪器以 RayCaptureSamples spp 渲染一遍，
+    // 把追踪的光线与三角形写入该文件，供 --benchmark --rays 回放
+    std::string RayCapturePath;
+    uint32_t RayCaptureSamples = 1;
+};
+
+// 无窗口、无 ImGui 的离线渲染：创建离屏上下文，载入场景，累积 Samples 帧后执行后处理并写出图像
+// （按输出扩展名选择 PNG / HDR / EXR）。
+// 自己持有相机与乒乓累积目标，作为当前 KH_RenderContext 驱动场景与后处理图
+class KH_HeadlessRenderer : public KH_RenderContext
+{
+public:
+    KH_HeadlessRenderer() = default;
+    ~KH_HeadlessRenderer() override;
+
+    KH_HeadlessRenderer(const KH_HeadlessRenderer&) = delete;
+    KH_HeadlessRenderer& operator=(const KH_HeadlessRenderer&) = delete;
+
+    // 解析 --headless 之后的参数：--scene、--output、--width、--height、--samples、
+    // --camera-position x,y,z、--camera-yaw、--camera-pitch、--fov、--skybox/--vndf/--sobol on|off、
+    // --checkpoint、--checkpoint-interval、--threads、--profile、--capture-rays、--capture-samples
+    static bool ParseArguments(int argc, char** argv, KH_HeadlessSettings& outSettings);
+    static bool IsHeadlessRequested(int argc, char** argv);
+
+    bool Run(const KH_HeadlessSettings& settings);
+
+    const KH_Camera& GetCamera() const override;
+    KH_Framebuffer& GetSceneFramebuffer() override;
+    const KH_Framebuffer& GetLastFramebuffer() override;
+    void SetPresentFramebuffer(const KH_Framebuffer* framebuffer) override;
+    glm::uvec2 GetRenderExtent() const override;
+    uint32_t GetFrameCounter() const override;
+    uint32_t GetSampleTarget() const override;
+    bool IsTemporalReprojectionEnabled() const override;
+    float GetHistoryClamp() const override;
+
+private:
+    KH_HeadlessSettings Settings;
+
+    KH_Camera Camera;
+    KH_Framebuffer SceneFramebuffer[2];
+    const KH_Framebuffer* PresentFramebuffer = nullptr;
+    uint32_t FrameBufferHandle = 0;
+    uint32_t FrameCounter = 0;
+
+    std::unique_ptr<KH_GpuLBVHScene> Scene;
+    uint64_t SceneHash = 0;
+
+    bool InitializeTargets();
+    bool LoadScene();
+    void WaitForSkybox();
+    void RenderSample();
+    bool CaptureRays();
+
+    // outFirstSample 为恢复出的样本数，没有可用检查点时为 0；
+    // 检查点与命令行给出的相机不一致时返回 false，不覆盖旧检查点
+    bool ResumeFromCheckpoint(uint32_t& outFirstSample);
+    void SaveCheckpoint(uint32_t accumulatedFrames) const;
+};
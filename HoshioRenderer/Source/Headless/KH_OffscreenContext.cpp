@@ -0,0 +1,250 @@
+#include "KH_OffscreenContext.h"
+#include "Utils/KH_DebugUtils.h"
+
+#if !defined(KH_HEADLESS_EGL) && !defined(KH_HEADLESS_OSMESA) && defined(__linux__)
+#define KH_HEADLESS_EGL
+#endif
+
+#if defined(KH_HEADLESS_EGL)
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#elif defined(KH_HEADLESS_OSMESA)
+#include <GL/osmesa.h>
+#endif
+
+namespace
+{
+#if defined(KH_HEADLESS_EGL)
+    EGLDisplay OpenEGLDisplay()
+    {
+        // 优先使用 Mesa surfaceless 平台，不依赖 X11 或 GBM 设备
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay)
+        {
+            EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    void* LoadGLProc(const char* name)
+    {
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+#elif defined(KH_HEADLESS_OSMESA)
+    void* LoadGLProc(const char* name)
+    {
+        return reinterpret_cast<void*>(OSMesaGetProcAddress(name));
+    }
+#else
+    void* LoadGLProc(const char* name)
+    {
+        return reinterpret_cast<void*>(glfwGetProcAddress(name));
+    }
+#endif
+}
+
+KH_OffscreenContext::~KH_OffscreenContext()
+{
+    DestroyBackend();
+}
+
+bool KH_OffscreenContext::Create(uint32_t width, uint32_t height)
+{
+    if (bValid)
+        return true;
+
+    if (!CreateBackend(width, height))
+    {
+        DestroyBackend();
+        return false;
+    }
+
+    if (!gladLoadGLLoader(static_cast<GLADloadproc>(LoadGLProc)))
+    {
+        LOG_E(std::format("{}: failed to load OpenGL functions", GetBackendName()));
+        DestroyBackend();
+        return false;
+    }
+
+    bValid = true;
+
+    LOG_D(std::format("Headless context ({}): {} / {}", GetBackendName(),
+        reinterpret_cast<const char*>(glGetString(GL_VERSION)),
+        reinterpret_cast<const char*>(glGetString(GL_RENDERER))));
+    return true;
+}
+
+bool KH_OffscreenContext::IsValid() const
+{
+    return bValid;
+}
+
+const char* KH_OffscreenContext::GetBackendName() const
+{
+#if defined(KH_HEADLESS_EGL)
+    return "EGL";
+#elif defined(KH_HEADLESS_OSMESA)
+    return "OSMesa";
+#else
+    return "GLFW (hidden)";
+#endif
+}
+
+#if defined(KH_HEADLESS_EGL)
+
+bool KH_OffscreenContext::CreateBackend(uint32_t width, uint32_t height)
+{
+    // surfaceless 上下文不需要默认帧缓冲，尺寸只由渲染器自己的 FBO 决定
+    (void)width;
+    (void)height;
+
+    EGLDisplay display = OpenEGLDisplay();
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+    {
+        LOG_E("EGL: failed to initialize a display");
+        return false;
+    }
+    Display = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        LOG_E("EGL: desktop OpenGL API is not available");
+        return false;
+    }
+
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0)
+        config = EGL_NO_CONFIG_KHR;
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 6,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+    {
+        LOG_E(std::format("EGL {}.{}: failed to create an OpenGL 4.6 core context (0x{:x})",
+            major, minor, eglGetError()));
+        return false;
+    }
+    Context = context;
+
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        LOG_E("EGL: surfaceless make-current failed");
+        return false;
+    }
+
+    return true;
+}
+
+void KH_OffscreenContext::DestroyBackend()
+{
+    if (Display)
+    {
+        eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (Context)
+            eglDestroyContext(Display, Context);
+        eglTerminate(Display);
+    }
+
+    Display = nullptr;
+    Context = nullptr;
+    bValid = false;
+}
+
+#elif defined(KH_HEADLESS_OSMESA)
+
+bool KH_OffscreenContext::CreateBackend(uint32_t width, uint32_t height)
+{
+    const int attribs[] = {
+        OSMESA_FORMAT, OSMESA_RGBA,
+        OSMESA_DEPTH_BITS, 24,
+        OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+        OSMESA_CONTEXT_MAJOR_VERSION, 4,
+        OSMESA_CONTEXT_MINOR_VERSION, 6,
+        0
+    };
+
+    OSMesaContext context = OSMesaCreateContextAttribs(attribs, nullptr);
+    if (!context)
+    {
+        LOG_E("OSMesa: failed to create an OpenGL 4.6 core context");
+        return false;
+    }
+    Context = context;
+
+    // OSMesa 要求绑定一块颜色缓冲，实际输出仍写入渲染器自己的 FBO
+    ColorBuffer.resize(static_cast<size_t>(width) * height * 4);
+    if (!OSMesaMakeCurrent(context, ColorBuffer.data(), GL_UNSIGNED_BYTE, width, height))
+    {
+        LOG_E("OSMesa: make-current failed");
+        return false;
+    }
+
+    return true;
+}
+
+void KH_OffscreenContext::DestroyBackend()
+{
+    if (Context)
+        OSMesaDestroyContext(static_cast<OSMesaContext>(Context));
+
+    Context = nullptr;
+    ColorBuffer.clear();
+    bValid = false;
+}
+
+#else
+
+bool KH_OffscreenContext::CreateBackend(uint32_t width, uint32_t height)
+{
+    if (!glfwInit())
+    {
+        LOG_E("GLFW: initialization failed");
+        return false;
+    }
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow* window = glfwCreateWindow(static_cast<int>(width), static_cast<int>(height),
+        "KH_Renderer Headless", nullptr, nullptr);
+    if (!window)
+    {
+        LOG_E("GLFW: failed to create a hidden window");
+        glfwTerminate();
+        return false;
+    }
+
+    Context = window;
+    glfwMakeContextCurrent(window);
+    return true;
+}
+
+void KH_OffscreenContext::DestroyBackend()
+{
+    if (Context)
+    {
+        glfwDestroyWindow(static_cast<GLFWwindow*>(Context));
+        glfwTerminate();
+    }
+
+    Context = nullptr;
+    bValid = false;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "KH_Common.h"
+
+// 无窗口的 GL 4.6 core 上下文。后端在编译期选择：
+// KH_HEADLESS_EGL    EGL surfaceless（Linux 默认，可跑在 Mesa llvmpipe 上）
+// KH_HEADLESS_OSMESA OSMesa 软件渲染
+// 两者都未定义时退回隐藏的 GLFW 窗口，仍不创建 ImGui
+// 作为单例存活到进程退出，保证其余单例析构时上下文仍有效
+class KH_OffscreenContext : public KH_Singleton<KH_OffscreenContext>
+{
+    friend class KH_Singleton<KH_OffscreenContext>;
+
+public:
+    bool Create(uint32_t width, uint32_t height);
+    bool IsValid() const;
+
+    const char* GetBackendName() const;
+
+private:
+    KH_OffscreenContext() = default;
+    ~KH_OffscreenContext() override;
+
+    KH_OffscreenContext(const KH_OffscreenContext&) = delete;
+    KH_OffscreenContext& operator=(const KH_OffscreenContext&) = delete;
+
+    bool CreateBackend(uint32_t width, uint32_t height);
+    void DestroyBackend();
+
+    bool bValid = false;
+
+    void* Display = nullptr;
+    void* Context = nullptr;
+    std::vector<unsigned char> ColorBuffer;
+};
@@ -68,14 +68,34 @@ float KH_AABB::ComputeSurfaceArea(glm::vec3 MinPos, glm::vec3 MaxPos)
 }
 
 
-KH_AABBHitInfo KH_AABB::Hit(const KH_Ray& Ray) const
+glm::vec3 KH_AABB::GetSafeInvDirection(const glm::vec3& Direction)
 {
-	glm::vec3 SafeDir = Ray.Direction;
+	glm::vec3 SafeDir = Direction;
 	SafeDir.x = (std::abs(SafeDir.x) < EPS) ? (SafeDir.x > 0 ? EPS : -EPS) : SafeDir.x;
 	SafeDir.y = (std::abs(SafeDir.y) < EPS) ? (SafeDir.y > 0 ? EPS : -EPS) : SafeDir.y;
 	SafeDir.z = (std::abs(SafeDir.z) < EPS) ? (SafeDir.z > 0 ? EPS : -EPS) : SafeDir.z;
 
-	glm::vec3 invdir = 1.0f / SafeDir;
+	return 1.0f / SafeDir;
+}
+
+bool KH_AABB::Hit(const glm::vec3& Start, const glm::vec3& InvDir, float TMax, float& outEnterTime) const
+{
+	glm::vec3 tMinSlab = (MinPos - Start) * InvDir;
+	glm::vec3 tMaxSlab = (MaxPos - Start) * InvDir;
+
+	glm::vec3 tMin = glm::min(tMinSlab, tMaxSlab);
+	glm::vec3 tMax = glm::max(tMinSlab, tMaxSlab);
+
+	float t0 = std::fmax(std::fmax(tMin.x, std::fmax(tMin.y, tMin.z)), 0.0f);
+	float t1 = std::fmin(tMax.x, std::fmin(tMax.y, tMax.z));
+
+	outEnterTime = t0;
+	return t0 <= t1 && t0 < TMax;
+}
+
+KH_AABBHitInfo KH_AABB::Hit(const KH_Ray& Ray) const
+{
+	glm::vec3 invdir = GetSafeInvDirection(Ray.Direction);
 
 	glm::vec3 tMinSlab = (MinPos - Ray.Start) * invdir;
 	glm::vec3 tMaxSlab = (MaxPos - Ray.Start) * invdir;
@@ -21,6 +21,11 @@ public:
 
 	KH_AABBHitInfo Hit(const KH_Ray& Ray) const;
 
+	// InvDir 由 GetSafeInvDirection 得到；命中且进入距离（起点在盒内时为 0）小于 TMax 时返回 true
+	bool Hit(const glm::vec3& Start, const glm::vec3& InvDir, float TMax, float& outEnterTime) const;
+
+	static glm::vec3 GetSafeInvDirection(const glm::vec3& Direction);
+
 	bool CheckOverlap(KH_AABB& Other);
 
 	void Merge(const KH_AABB& Other);
@@ -6,6 +6,47 @@
 
 #include "Utils/KH_DebugUtils.h"
 
+namespace
+{
+	struct KH_BVHNodeAccessor
+	{
+		const KH_AABB* GetAABB(const KH_BVHNode* Node) const { return Node ? &Node->AABB : nullptr; }
+		bool IsLeaf(const KH_BVHNode* Node) const { return Node->bIsLeaf; }
+		glm::uvec2 GetLeafRange(const KH_BVHNode* Node) const { return glm::uvec2(Node->Offset, Node->Offset + Node->Size); }
+		const KH_BVHNode* GetLeft(const KH_BVHNode* Node) const { return Node->Left.get(); }
+		const KH_BVHNode* GetRight(const KH_BVHNode* Node) const { return Node->Right.get(); }
+	};
+
+	struct KH_FlatBVHNodeAccessor
+	{
+		const std::vector<KH_FlatBVHNode>& Nodes;
+
+		const KH_AABB* GetAABB(int NodeID) const { return NodeID != KH_FLAT_BVH_NULL_NODE ? &Nodes[NodeID].AABB : nullptr; }
+		bool IsLeaf(int NodeID) const { return Nodes[NodeID].bIsLeaf; }
+		glm::uvec2 GetLeafRange(int NodeID) const { return glm::uvec2(Nodes[NodeID].Offset, Nodes[NodeID].Offset + Nodes[NodeID].Size); }
+		int GetLeft(int NodeID) const { return Nodes[NodeID].Left; }
+		int GetRight(int NodeID) const { return Nodes[NodeID].Right; }
+	};
+}
+
+bool KH_IBVH::IntersectLeaf(const KH_Ray& Ray, uint32_t BeginIndex, uint32_t EndIndex, const uint32_t* Order, bool bAnyHit, float& ioClosest) const
+{
+	bool bHit = false;
+	for (uint32_t i = BeginIndex; i < EndIndex; i++)
+	{
+		const uint32_t Index = Order ? Order[i] : i;
+		const KH_HitResult HitResult = Primitives[Index]->Hit(Ray);
+		if (!HitResult.bIsHit || HitResult.Distance >= ioClosest)
+			continue;
+
+		ioClosest = HitResult.Distance;
+		bHit = true;
+		if (bAnyHit)
+			return true;
+	}
+	return bHit;
+}
+
 
 void KH_IBVH::RenderAABB(KH_Shader& Shader, glm::vec3 Color) const
 {
@@ -22,14 +63,13 @@ void KH_IBVH::RenderAABB(KH_Shader& Shader, glm::vec3 Color) const
 
 	ModelMats_SSBO.Bind();
 
-	glBindVertexArray(KH_DefaultModels::Instance().EmptyCube.GetVAO());
+	KH_GLState::Instance().BindVertexArray(KH_DefaultModels::Instance().EmptyCube.GetVAO());
 	glDrawElementsInstanced(
 	    GL_LINES,
 		KH_DefaultModels::Instance().Cube.GetNumIndices(),
 		GL_UNSIGNED_INT,
 		0,
 		MatCount	);
-	glBindVertexArray(0);
 
 	ModelMats_SSBO.Unbind();
 	KH_Editor::Instance().UnbindCanvasFramebuffer();
@@ -258,6 +298,15 @@ void KH_BVH::BindAndBuild(std::vector<KH_SceneObject>& Objects)
 	//LOG_D(DebugMessage);
 }
 
+void KH_BVH::BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives)
+{
+	Primitives = std::move(InPrimitives);
+	PrimitiveCount = Primitives.size();
+
+	Root = std::make_unique<KH_BVHNode>();
+	BuildBVH();
+}
+
 std::vector<KH_BVHHitInfo> KH_BVH::Hit(KH_Ray& Ray)
 {
 	std::vector<KH_BVHHitInfo> HitInfos;
@@ -266,6 +315,10 @@ std::vector<KH_BVHHitInfo> KH_BVH::Hit(KH_Ray& Ray)
 	return HitInfos;
 }
 
+bool KH_BVH::Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const
+{
+	return IntersectNodes<const KH_BVHNode*>(Ray, Root.get(), KH_BVHNodeAccessor{}, nullptr, TMax, bAnyHit, outDistance);
+}
 
 void KH_BVH::FillModelMatrices(uint32_t TargetDepth)
 {
@@ -459,6 +512,17 @@ void KH_FlatBVH::BindAndBuild(std::vector<KH_SceneObject>& Objects)
 	//LOG_D(DebugMessage);
 }
 
+void KH_FlatBVH::BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives)
+{
+	Primitives = std::move(InPrimitives);
+	PrimitiveCount = Primitives.size();
+
+	Root = KH_FLAT_BVH_NULL_NODE;
+	BVHNodes.clear();
+
+	BuildBVH();
+}
+
 std::vector<KH_BVHHitInfo> KH_FlatBVH::Hit(KH_Ray& Ray)
 {
 	std::vector<KH_BVHHitInfo> HitInfos;
@@ -467,6 +531,11 @@ std::vector<KH_BVHHitInfo> KH_FlatBVH::Hit(KH_Ray& Ray)
 	return HitInfos;
 }
 
+bool KH_FlatBVH::Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const
+{
+	return IntersectNodes(Ray, Root, KH_FlatBVHNodeAccessor{ BVHNodes }, nullptr, TMax, bAnyHit, outDistance);
+}
+
 void KH_FlatBVH::FillModelMatrices(uint32_t TargetDepth)
 {
 	ModelMats.clear();
@@ -83,11 +83,30 @@ public:
 
 	virtual void BindAndBuild(std::vector<KH_SceneObject>& Objects) = 0;
 
+	// 直接从世界空间图元构建，不生成 AABB 可视化矩阵，无需 GL 上下文（用于光线回放）
+	virtual void BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives) = 0;
+
 	virtual std::vector<KH_BVHHitInfo> Hit(KH_Ray& Ray) = 0;
 
+	// 求 (0, TMax) 内的最近交点：近的孩子先访问，并用当前最近距离裁剪节点，不分配内存。
+	// bAnyHit 时找到任一交点即返回（阴影光线），此时 outDistance 不一定最近
+	virtual bool Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const = 0;
+
 protected:
 	virtual void FillModelMatrices(uint32_t TargetDepth) = 0;
 
+	// 测试 [BeginIndex, EndIndex) 内的图元，Order 非空时先经它映射回图元下标；命中更近的交点时更新 ioClosest
+	bool IntersectLeaf(const KH_Ray& Ray, uint32_t BeginIndex, uint32_t EndIndex, const uint32_t* Order, bool bAnyHit, float& ioClosest) const;
+
+	// 各 BVH 共用的 Intersect 遍历，Nodes 提供节点访问：
+	//   const KH_AABB* GetAABB(NodeRef)    空节点返回 nullptr
+	//   bool IsLeaf(NodeRef)
+	//   glm::uvec2 GetLeafRange(NodeRef)   叶节点的 [Begin, End)
+	//   NodeRef GetLeft(NodeRef) / GetRight(NodeRef)
+	template<typename NodeRef, typename Accessor>
+	bool IntersectNodes(const KH_Ray& Ray, NodeRef Root, const Accessor& Nodes, const uint32_t* Order,
+		float TMax, bool bAnyHit, float& outDistance) const;
+
 	void CollectPrimitives(std::vector<KH_SceneObject>& Objects);
 
 	void UpdateModelMatsSSBO();
@@ -96,6 +115,85 @@ protected:
 
 };
 
+template<typename NodeRef, typename Accessor>
+bool KH_IBVH::IntersectNodes(const KH_Ray& Ray, NodeRef Root, const Accessor& Nodes, const uint32_t* Order,
+	float TMax, bool bAnyHit, float& outDistance) const
+{
+	const glm::vec3 InvDir = KH_AABB::GetSafeInvDirection(Ray.Direction);
+	float Closest = TMax;
+	bool bHit = false;
+
+	auto HitNode = [&](NodeRef Node, float& outEnterTime)
+	{
+		const KH_AABB* NodeAABB = Nodes.GetAABB(Node);
+		return NodeAABB && NodeAABB->Hit(Ray.Start, InvDir, Closest, outEnterTime);
+	};
+
+	float RootEnter;
+	if (!HitNode(Root, RootEnter))
+		return false;
+
+	// 遍历栈按线程复用，容量增长后不再分配
+	thread_local std::vector<std::pair<NodeRef, float>> Stack;
+	Stack.clear();
+	Stack.emplace_back(Root, RootEnter);
+
+	while (!Stack.empty())
+	{
+		const auto [Node, EnterTime] = Stack.back();
+		Stack.pop_back();
+
+		// 入栈后找到了更近的交点
+		if (EnterTime >= Closest)
+			continue;
+
+		if (Nodes.IsLeaf(Node))
+		{
+			const glm::uvec2 Range = Nodes.GetLeafRange(Node);
+			if (IntersectLeaf(Ray, Range.x, Range.y, Order, bAnyHit, Closest))
+			{
+				bHit = true;
+				if (bAnyHit)
+					break;
+			}
+			continue;
+		}
+
+		const NodeRef Left = Nodes.GetLeft(Node);
+		const NodeRef Right = Nodes.GetRight(Node);
+
+		float LeftEnter, RightEnter;
+		const bool bLeft = HitNode(Left, LeftEnter);
+		const bool bRight = HitNode(Right, RightEnter);
+
+		if (bLeft && bRight)
+		{
+			// 远的先入栈，近的先出栈
+			if (LeftEnter <= RightEnter)
+			{
+				Stack.emplace_back(Right, RightEnter);
+				Stack.emplace_back(Left, LeftEnter);
+			}
+			else
+			{
+				Stack.emplace_back(Left, LeftEnter);
+				Stack.emplace_back(Right, RightEnter);
+			}
+		}
+		else if (bLeft)
+		{
+			Stack.emplace_back(Left, LeftEnter);
+		}
+		else if (bRight)
+		{
+			Stack.emplace_back(Right, RightEnter);
+		}
+	}
+
+	outDistance = Closest;
+	return bHit;
+}
+
 #pragma endregion
 
 #pragma region BVH
@@ -124,8 +222,12 @@ public:
 
 	void BindAndBuild(std::vector<KH_SceneObject>& Objects) override;
 
+	void BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives) override;
+
 	std::vector<KH_BVHHitInfo> Hit(KH_Ray& Ray) override;
 
+	bool Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const override;
+
 private:
 	void FillModelMatrices(uint32_t TargetDepth) override;
 
@@ -163,7 +265,9 @@ public:
 	~KH_FlatBVH() override = default;
 
 	void BindAndBuild(std::vector<KH_SceneObject>& Objects) override;
+	void BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives) override;
 	std::vector<KH_BVHHitInfo> Hit(KH_Ray& Ray) override;
+	bool Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const override;
 
 private:
 	void FillModelMatrices(uint32_t TargetDepth) override;
@@ -2,6 +2,7 @@
 #include "Scene/KH_Model.h"
 #include "Utils/KH_DebugUtils.h"
 #include "Utils/KH_Algorithms.h"
+#include "Utils/KH_Profiler.h"
 #include "Scene/KH_Scene.h"
 #include "Editor/KH_Editor.h"
 
@@ -60,6 +61,25 @@ void KH_LBVH::BindAndBuild(std::vector<KH_SceneObject>& Objects, KH_AABB AABB)
 	//FillModelMatrices(MaxBVHDepth);
 }
 
+void KH_LBVH::BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives)
+{
+	Primitives = std::move(InPrimitives);
+
+	AABB.Reset();
+	for (const auto& Primitive : Primitives)
+		AABB.Merge(Primitive->GetMinPos(), Primitive->GetMaxPos());
+
+	if (!IsAllDataReady())
+		return;
+
+	PrimitiveCount = Primitives.size();
+
+	SortPrimitiveIndices();
+	FillDeltaBuffer();
+	InitLBVHNodes();
+	BuildBVH();
+}
+
 std::vector<KH_BVHHitInfo> KH_LBVH::Hit(KH_Ray& Ray)
 {
 	std::vector<KH_BVHHitInfo> HitInfos;
@@ -68,6 +88,25 @@ std::vector<KH_BVHHitInfo> KH_LBVH::Hit(KH_Ray& Ray)
 	return HitInfos;
 }
 
+bool KH_LBVH::Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const
+{
+	if (PrimitiveCount == 0)
+		return false;
+
+	struct KH_LBVHNodeAccessor
+	{
+		const KH_LBVH& BVH;
+
+		const KH_AABB* GetAABB(int NodeID) const { return NodeID != KH_LBVH_NULL_NODE ? &BVH.BVHNodes[NodeID].AABB : nullptr; }
+		bool IsLeaf(int NodeID) const { return BVH.IsLeafNode(NodeID); }
+		glm::uvec2 GetLeafRange(int NodeID) const { return glm::uvec2(BVH.BVHNodes[NodeID].Range.x, BVH.BVHNodes[NodeID].Range.y + 1); }
+		int GetLeft(int NodeID) const { return BVH.BVHNodes[NodeID].Left; }
+		int GetRight(int NodeID) const { return BVH.BVHNodes[NodeID].Right; }
+	};
+
+	return IntersectNodes(Ray, Root, KH_LBVHNodeAccessor{ *this }, SortedIndices.data(), TMax, bAnyHit, outDistance);
+}
+
 void KH_LBVH::SortPrimitiveIndices()
 {
 	PrimitiveMorton3Ds.resize(PrimitiveCount);
@@ -268,13 +307,9 @@ void KH_GpuLBVH::SetSSBOs()
 {
 	SetSSBOBindings();
 
-	std::vector<glm::vec4> Centers;
-	Centers.reserve(ElementCount);
-	std::vector<KH_SceneObject>& Objects = pScene->Objects;
-	for (auto& Object : Objects)
-		Object->CollectPrimitiveAABBCenters(Centers);
-
-	CentersSSBO.SetData(Centers, GL_DYNAMIC_DRAW);
+	// 中心由 RunComputeCenters 从 Primitive_SSBO 生成，这里只在数量变化时重新分配
+	if (CentersSSBO.GetCount() != ElementCount)
+		CentersSSBO.SetData(nullptr, ElementCount, GL_DYNAMIC_DRAW);
 
 	if (Morton3DSSBO.GetCount() != ElementCount)
 		Morton3DSSBO.SetData(nullptr, ElementCount, GL_DYNAMIC_DRAW);
@@ -297,8 +332,15 @@ void KH_GpuLBVH::SetSSBOs()
 	if (LBVHNodeSSBO.GetCount() != LBVHNodeCount)
 		LBVHNodeSSBO.SetData(nullptr, LBVHNodeCount, GL_DYNAMIC_DRAW);
 
-	std::vector<int> AtomicFlags(ElementCount - 1 >= 0 ? ElementCount - 1: 0, -1);
-	AtomicFlagSSBO.SetData(AtomicFlags, GL_DYNAMIC_DRAW);
+	const int AtomicFlagCount = std::max(ElementCount - 1, 0);
+	if (AtomicFlagSSBO.GetCount() != AtomicFlagCount)
+		AtomicFlagSSBO.SetData(nullptr, AtomicFlagCount, GL_DYNAMIC_DRAW);
+
+	if (AtomicFlagCount > 0)
+	{
+		const int InitialFlag = -1;
+		glClearNamedBufferData(AtomicFlagSSBO.GetID(), GL_R32I, GL_RED_INTEGER, GL_INT, &InitialFlag);
+	}
 }
 
 void KH_GpuLBVH::SetSSBOBindings()
@@ -322,6 +364,7 @@ void KH_GpuLBVH::CreateShaders()
 {
 	auto& ShaderManager = KH_ShaderManager::Instance();
 
+	ComputeCenters_Shader = ShaderManager.LoadComputeShader("Assert/Shaders/ComputeShaders/LBVHBuilder/ComputeCenters.comp");
 	GenerateMorton3D_Shader = ShaderManager.LoadComputeShader("Assert/Shaders/ComputeShaders/LBVHBuilder/GenerateMorton3D.comp");
 	RadixSort_Pass1_Shader = ShaderManager.LoadComputeShader("Assert/Shaders/ComputeShaders/LBVHBuilder/RadixSort_Pass1.comp");
 	RadixSort_Pass2_Shader = ShaderManager.LoadComputeShader("Assert/Shaders/ComputeShaders/LBVHBuilder/RadixSort_Pass2.comp");
@@ -345,8 +388,23 @@ void KH_GpuLBVH::FillModelMatrices()
 	ModelMats_SSBO.SetData(ModelMats, GL_STATIC_DRAW);
 }
 
+void KH_GpuLBVH::RunComputeCenters() const
+{
+	KH_PROFILE_GPU_SCOPE("LBVH.ComputeCenters");
+
+	// Primitive_SSBO 占用 0 号绑定点，中心临时绑到 1 号，RunGenerateMorton3D 会换回 0 号
+	pScene->Primitive_SSBO.Bind();
+	KH_GLState::Instance().BindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, CentersSSBO.GetID());
+	ComputeCenters_Shader.Use();
+	ComputeCenters_Shader.SetInt("uElementCount", ElementCount);
+	glDispatchCompute(LBVHBuilder_NumBlocks, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
 void KH_GpuLBVH::RunGenerateMorton3D() const
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.GenerateMorton3D");
+
 	CentersSSBO.Bind();
 	Morton3DSSBO.Bind();
 	GenerateMorton3D_Shader.Use();
@@ -360,6 +418,8 @@ void KH_GpuLBVH::RunGenerateMorton3D() const
 
 void KH_GpuLBVH::RunRadixSort2uiv() const
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.RadixSort");
+
 	Morton3DSSBO.Bind();
 	RadixSort_LocalShuffleSSBO.Bind();
 	RadixSort_BlockSumSSBO.Bind();
@@ -375,6 +435,8 @@ void KH_GpuLBVH::RunRadixSort2uiv() const
 
 void KH_GpuLBVH::RunPrecomputeDelta() const
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.PrecomputeDelta");
+
 	Morton3DSSBO.Bind();
 	AuxiliarySSBO.Bind();
 	PrecomputeDelta_Shader.Use();
@@ -385,6 +447,8 @@ void KH_GpuLBVH::RunPrecomputeDelta() const
 
 void KH_GpuLBVH::RunBuildLBVH() const
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.BuildNodes");
+
 	pScene->Primitive_SSBO.Bind();
 	Morton3DSSBO.Bind();
 	LBVHNodeSSBO.Bind();
@@ -398,6 +462,9 @@ void KH_GpuLBVH::RunBuildLBVH() const
 
 void KH_GpuLBVH::BuildLBVH()
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.Build");
+
+	RunComputeCenters();
 	RunGenerateMorton3D();
 	RunRadixSort2uiv();
 	RunPrecomputeDelta();
@@ -421,14 +488,13 @@ void KH_GpuLBVH::RenderAABB(const KH_Shader& Shader, glm::vec3 Color) const
 
 	ModelMats_SSBO.Bind();
 
-	glBindVertexArray(KH_DefaultModels::Instance().EmptyCube.GetVAO());
+	KH_GLState::Instance().BindVertexArray(KH_DefaultModels::Instance().EmptyCube.GetVAO());
 	glDrawElementsInstanced(
 		GL_LINES,
 		KH_DefaultModels::Instance().Cube.GetNumIndices(),
 		GL_UNSIGNED_INT,
 		0,
 		LBVHNodeCount);
-	glBindVertexArray(0);
 
 	ModelMats_SSBO.Unbind();
 
@@ -453,6 +519,8 @@ KH_GpuLBVH::KH_GpuLBVH()
 
 void KH_GpuLBVH::BindAndBuild(KH_GpuLBVHScene* Scene)
 {
+	KH_PROFILE_GPU_SCOPE("LBVH.BindAndBuild");
+
 	this->pScene = Scene;
 	Initialize();
 	BuildLBVH();
@@ -46,12 +46,18 @@ public:
 
 	void BindAndBuild(std::vector<KH_SceneObject>& Objects, KH_AABB AABB);
 
+	// 包围盒由图元自身计算
+	void BuildFromPrimitives(std::vector<KH_ScenePrimitive>&& InPrimitives) override;
+
 	bool IsLeafNode(int NodeID) const;
 
 	int GetPrimitiveIndices(int NodeID) const;
 
 	std::vector<KH_BVHHitInfo> Hit(KH_Ray& Ray) override;
 
+	// 叶节点范围是排序后的位置，经 SortedIndices 映射回图元
+	bool Intersect(const KH_Ray& Ray, float TMax, bool bAnyHit, float& outDistance) const override;
+
 private:
 	void SortPrimitiveIndices();
 
@@ -94,6 +100,8 @@ public:
 
 	void Initialize();
 
+	void RunComputeCenters() const;
+
 	void RunGenerateMorton3D() const;
 
 	void RunRadixSort2uiv() const;
@@ -139,6 +147,7 @@ private:
 	KH_SSBO<KH_LBVHNodeEncoded> LBVHNodeSSBO;
 	KH_SSBO<int> AtomicFlagSSBO;
 
+	KH_Shader ComputeCenters_Shader;
 	KH_Shader GenerateMorton3D_Shader;
 	KH_Shader RadixSort_Pass1_Shader;
 	KH_Shader RadixSort_Pass2_Shader;
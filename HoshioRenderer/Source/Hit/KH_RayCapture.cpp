@@ -0,0 +1,129 @@
+#include "KH_RayCapture.h"
+
+#include "Utils/KH_DebugUtils.h"
+
+#include <bit>
+
+namespace
+{
+	constexpr uint32_t kRaySetMagic = 0x5352484B; // "KHRS"
+	constexpr uint32_t kRaySetVersion = 1;
+
+	struct KH_RaySetHeader
+	{
+		uint32_t Magic = kRaySetMagic;
+		uint32_t Version = kRaySetVersion;
+		uint32_t TriangleCount = 0;
+		uint32_t RayCount = 0;
+		uint32_t SceneNameLength = 0;
+		uint32_t Padding[3] = {};
+	};
+}
+
+KH_CapturedRay::KH_CapturedRay(const glm::vec3& Start, const glm::vec3& Direction, float TMax, KH_CapturedRayType Type)
+	: StartAndTMax(Start, TMax)
+	, DirectionAndType(Direction, std::bit_cast<float>(static_cast<uint32_t>(Type)))
+{
+}
+
+KH_CapturedRayType KH_CapturedRay::GetType() const
+{
+	return static_cast<KH_CapturedRayType>(std::bit_cast<uint32_t>(DirectionAndType.w));
+}
+
+uint32_t KH_RaySet::CountRays(KH_CapturedRayType Type) const
+{
+	return static_cast<uint32_t>(std::count_if(Rays.begin(), Rays.end(),
+		[Type](const KH_CapturedRay& Ray) { return Ray.GetType() == Type; }));
+}
+
+std::vector<KH_CapturedRay> KH_RaySet::GetRays(KH_CapturedRayType Type) const
+{
+	std::vector<KH_CapturedRay> Result;
+	Result.reserve(CountRays(Type));
+	std::copy_if(Rays.begin(), Rays.end(), std::back_inserter(Result),
+		[Type](const KH_CapturedRay& Ray) { return Ray.GetType() == Type; });
+	return Result;
+}
+
+bool KH_RaySet::SaveToFile(const std::string& Path) const
+{
+	if (Path.empty() || TrianglePositions.size() % 3 != 0)
+		return false;
+
+	KH_RaySetHeader Header;
+	Header.TriangleCount = GetTriangleCount();
+	Header.RayCount = static_cast<uint32_t>(Rays.size());
+	Header.SceneNameLength = static_cast<uint32_t>(SceneName.size());
+
+	// 录制一次可能持续数分钟，先写临时文件，避免中断时留下半个文件
+	const std::string TempPath = Path + ".tmp";
+	{
+		std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+		if (!File.is_open())
+		{
+			LOG_E(std::format("Failed to write ray set: {}", TempPath));
+			return false;
+		}
+
+		File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		File.write(SceneName.data(), static_cast<std::streamsize>(SceneName.size()));
+		File.write(reinterpret_cast<const char*>(TrianglePositions.data()), TrianglePositions.size() * sizeof(glm::vec3));
+		File.write(reinterpret_cast<const char*>(Rays.data()), Rays.size() * sizeof(KH_CapturedRay));
+
+		if (!File)
+		{
+			LOG_E(std::format("Failed to write ray set: {}", TempPath));
+			return false;
+		}
+	}
+
+	std::error_code Error;
+	std::filesystem::rename(TempPath, Path, Error);
+	if (Error)
+	{
+		LOG_E(std::format("Failed to replace ray set {}: {}", Path, Error.message()));
+		return false;
+	}
+
+	LOG_D(std::format("Wrote ray set {} ({} triangles, {} primary, {} bounce, {} shadow rays)",
+		Path, Header.TriangleCount,
+		CountRays(KH_CapturedRayType::Primary), CountRays(KH_CapturedRayType::Bounce), CountRays(KH_CapturedRayType::Shadow)));
+	return true;
+}
+
+bool KH_RaySet::LoadFromFile(const std::string& Path)
+{
+	std::ifstream File(Path, std::ios::binary);
+	if (!File.is_open())
+	{
+		LOG_E(std::format("Failed to open ray set: {}", Path));
+		return false;
+	}
+
+	KH_RaySetHeader Header;
+	File.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+
+	if (!File || Header.Magic != kRaySetMagic || Header.Version != kRaySetVersion)
+	{
+		LOG_E(std::format("Not a valid ray set: {}", Path));
+		return false;
+	}
+
+	SceneName.resize(Header.SceneNameLength);
+	TrianglePositions.resize(static_cast<size_t>(Header.TriangleCount) * 3);
+	Rays.resize(Header.RayCount);
+
+	File.read(SceneName.data(), static_cast<std::streamsize>(SceneName.size()));
+	File.read(reinterpret_cast<char*>(TrianglePositions.data()), TrianglePositions.size() * sizeof(glm::vec3));
+	File.read(reinterpret_cast<char*>(Rays.data()), Rays.size() * sizeof(KH_CapturedRay));
+
+	if (!File)
+	{
+		LOG_E(std::format("Ray set is truncated: {}", Path));
+		*this = KH_RaySet();
+		return false;
+	}
+
+	return true;
+}
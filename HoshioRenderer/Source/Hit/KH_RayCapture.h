@@ -0,0 +1,52 @@
+#pragma once
+
+#include "KH_Common.h"
+
+enum class KH_CapturedRayType : uint32_t
+{
+	// 相机光线，求最近交点
+	Primary = 0,
+	// BSDF 采样的后续弹射光线，求最近交点
+	Bounce = 1,
+	// 环境光 NEE 的阴影光线，只需判断是否被遮挡
+	Shadow = 2,
+
+	Count = 3
+};
+
+// 32 字节，与 TraceRays.comp 中的 std430 布局一致，可直接上传
+struct KH_CapturedRay
+{
+	glm::vec4 StartAndTMax;
+	// w 为 KH_CapturedRayType，按位存放
+	glm::vec4 DirectionAndType;
+
+	KH_CapturedRay() = default;
+	KH_CapturedRay(const glm::vec3& Start, const glm::vec3& Direction, float TMax, KH_CapturedRayType Type);
+
+	glm::vec3 GetStart() const { return glm::vec3(StartAndTMax); }
+	glm::vec3 GetDirection() const { return glm::vec3(DirectionAndType); }
+	float GetTMax() const { return StartAndTMax.w; }
+	KH_CapturedRayType GetType() const;
+};
+
+// 一次渲染录下的光线与当时的世界空间三角形，回放时不依赖场景文件与资产，
+// 不同提交之间可用同一份文件对比遍历性能
+struct KH_RaySet
+{
+	// 录制时的场景标识（通常为场景路径），回放结果按它分组
+	std::string SceneName;
+
+	// 每 3 个顶点一个三角形
+	std::vector<glm::vec3> TrianglePositions;
+	std::vector<KH_CapturedRay> Rays;
+
+	uint32_t GetTriangleCount() const { return static_cast<uint32_t>(TrianglePositions.size() / 3); }
+	uint32_t CountRays(KH_CapturedRayType Type) const;
+
+	// 按类型取出光线，保持录制顺序
+	std::vector<KH_CapturedRay> GetRays(KH_CapturedRayType Type) const;
+
+	bool SaveToFile(const std::string& Path) const;
+	bool LoadFromFile(const std::string& Path);
+};
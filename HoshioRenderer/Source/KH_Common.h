@@ -8,14 +8,21 @@
 #include <cmath>
 #include <functional>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
-#include <omp.h>
 #include <random>
 #include <chrono>
 #include <format>
 #include <mutex>
+#include <thread>
+#include <future>
+#include <atomic>
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <sstream>
 #include <filesystem>
@@ -0,0 +1,226 @@
+#include "KH_AccumulationCheckpoint.h"
+#include "KH_Framebuffer.h"
+#include "Editor/KH_Camera.h"
+#include "Scene/KH_Scene.h"
+
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Algorithms.h"
+
+namespace
+{
+    constexpr uint32_t kCheckpointMagic = 0x43414B48; // "HKAC"
+    constexpr uint32_t kCheckpointVersion = 1;
+
+    struct KH_CheckpointHeader
+    {
+        uint32_t Magic = kCheckpointMagic;
+        uint32_t Version = kCheckpointVersion;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t FrameCounter = 0;
+        uint32_t AccumulatedFrames = 0;
+        uint64_t SceneHash = 0;
+
+        float CameraPosition[3] = {};
+        float CameraFront[3] = {};
+        float CameraUp[3] = {};
+        float CameraRight[3] = {};
+        float CameraYaw = 0.0f;
+        float CameraPitch = 0.0f;
+        float CameraFovy = 0.0f;
+        uint32_t Padding = 0;
+    };
+
+    void StoreVec3(float (&dst)[3], const glm::vec3& src)
+    {
+        dst[0] = src.x;
+        dst[1] = src.y;
+        dst[2] = src.z;
+    }
+
+    glm::vec3 LoadVec3(const float (&src)[3])
+    {
+        return glm::vec3(src[0], src[1], src[2]);
+    }
+
+    // Right 由 Front 与 Up 决定，不参与哈希
+    uint64_t HashCamera(const glm::vec3& position, const glm::vec3& front, const glm::vec3& up, float fovy, uint64_t seed)
+    {
+        uint64_t hash = KH_Hash::FNV1a64(&position, sizeof(position), seed);
+        hash = KH_Hash::FNV1a64(&front, sizeof(front), hash);
+        hash = KH_Hash::FNV1a64(&up, sizeof(up), hash);
+        return KH_Hash::FNV1a64(&fovy, sizeof(fovy), hash);
+    }
+}
+
+uint64_t KH_AccumulationCheckpoint::ComputeSceneHash(const KH_SceneBase& scene, glm::uvec2 extent)
+{
+    uint64_t hash = KH_Hash::FNV1a64(&extent, sizeof(extent));
+
+    const KH_ShaderFeatureType type = scene.GetActiveShaderFeatureType();
+    hash = KH_Hash::FNV1a64(&type, sizeof(type), hash);
+
+    // 图元哈希由场景缓存，周期性保存不会每次都重编码整个场景
+    const uint64_t primitiveHash = scene.GetPrimitiveHash(type);
+    hash = KH_Hash::FNV1a64(&primitiveHash, sizeof(primitiveHash), hash);
+
+    if (const KH_ShaderFeatureBase* feature = scene.GetActiveShaderFeature())
+    {
+        const uint64_t materialHash = feature->ComputeMaterialHash();
+        hash = KH_Hash::FNV1a64(&materialHash, sizeof(materialHash), hash);
+
+        // 开关（含天空盒是否就绪）改变积分结果，同样不能续算
+        for (const std::string& define : feature->GetPermutationDefines())
+            hash = KH_Hash::FNV1a64(define.data(), define.size(), hash);
+    }
+
+    return hash;
+}
+
+uint64_t KH_AccumulationCheckpoint::ComputeCameraHash(const KH_Camera& camera, uint64_t seed)
+{
+    return HashCamera(camera.Position, camera.Front, camera.Up, camera.Fovy, seed);
+}
+
+uint64_t KH_AccumulationCheckpoint::ComputeCameraHash(uint64_t seed) const
+{
+    return HashCamera(CameraPosition, CameraFront, CameraUp, CameraFovy, seed);
+}
+
+bool KH_AccumulationCheckpoint::Capture(const KH_Framebuffer& framebuffer, const KH_Camera& camera,
+    uint32_t frameCounter, uint32_t accumulatedFrames, uint64_t sceneHash)
+{
+    if (!framebuffer.ReadColorAttachment(Pixels, 0))
+        return false;
+
+    Width = framebuffer.GetWidth();
+    Height = framebuffer.GetHeight();
+    FrameCounter = frameCounter;
+    AccumulatedFrames = accumulatedFrames;
+    SceneHash = sceneHash;
+
+    CameraPosition = camera.Position;
+    CameraFront = camera.Front;
+    CameraUp = camera.Up;
+    CameraRight = camera.Right;
+    CameraYaw = camera.Yaw;
+    CameraPitch = camera.Pitch;
+    CameraFovy = camera.Fovy;
+    return true;
+}
+
+bool KH_AccumulationCheckpoint::SaveToFile(const std::string& path) const
+{
+    if (path.empty() || Pixels.size() != static_cast<size_t>(Width) * Height || Pixels.empty())
+        return false;
+
+    KH_CheckpointHeader header;
+    header.Width = Width;
+    header.Height = Height;
+    header.FrameCounter = FrameCounter;
+    header.AccumulatedFrames = AccumulatedFrames;
+    header.SceneHash = SceneHash;
+    StoreVec3(header.CameraPosition, CameraPosition);
+    StoreVec3(header.CameraFront, CameraFront);
+    StoreVec3(header.CameraUp, CameraUp);
+    StoreVec3(header.CameraRight, CameraRight);
+    header.CameraYaw = CameraYaw;
+    header.CameraPitch = CameraPitch;
+    header.CameraFovy = CameraFovy;
+
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_W(std::format("Failed to write accumulation checkpoint: {}", tempPath));
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(Pixels.data()), Pixels.size() * sizeof(glm::vec4));
+
+        if (!file)
+        {
+            LOG_W(std::format("Failed to write accumulation checkpoint: {}", tempPath));
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        LOG_W(std::format("Failed to replace accumulation checkpoint {}: {}", path, error.message()));
+        return false;
+    }
+
+    return true;
+}
+
+bool KH_AccumulationCheckpoint::LoadFromFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    KH_CheckpointHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file
+        || header.Magic != kCheckpointMagic
+        || header.Version != kCheckpointVersion
+        || header.Width == 0 || header.Height == 0)
+    {
+        LOG_W(std::format("Not a valid accumulation checkpoint: {}", path));
+        return false;
+    }
+
+    Pixels.resize(static_cast<size_t>(header.Width) * header.Height);
+    file.read(reinterpret_cast<char*>(Pixels.data()), Pixels.size() * sizeof(glm::vec4));
+
+    if (!file)
+    {
+        LOG_W(std::format("Accumulation checkpoint is truncated: {}", path));
+        Pixels.clear();
+        return false;
+    }
+
+    Width = header.Width;
+    Height = header.Height;
+    FrameCounter = header.FrameCounter;
+    AccumulatedFrames = header.AccumulatedFrames;
+    SceneHash = header.SceneHash;
+    CameraPosition = LoadVec3(header.CameraPosition);
+    CameraFront = LoadVec3(header.CameraFront);
+    CameraUp = LoadVec3(header.CameraUp);
+    CameraRight = LoadVec3(header.CameraRight);
+    CameraYaw = header.CameraYaw;
+    CameraPitch = header.CameraPitch;
+    CameraFovy = header.CameraFovy;
+    return true;
+}
+
+bool KH_AccumulationCheckpoint::Restore(KH_Framebuffer& framebuffer, KH_Camera& camera) const
+{
+    if (!RestoreAccumulation(framebuffer))
+        return false;
+
+    // 直接写回基向量，保证视图矩阵与保存时逐位一致
+    camera.Position = CameraPosition;
+    camera.Front = CameraFront;
+    camera.Up = CameraUp;
+    camera.Right = CameraRight;
+    camera.Yaw = CameraYaw;
+    camera.Pitch = CameraPitch;
+    camera.Fovy = CameraFovy;
+    return true;
+}
+
+bool KH_AccumulationCheckpoint::RestoreAccumulation(KH_Framebuffer& framebuffer) const
+{
+    if (framebuffer.GetWidth() != Width || framebuffer.GetHeight() != Height)
+        return false;
+
+    return framebuffer.WriteColorAttachment(Pixels, 0);
+}
\ No newline at end of file
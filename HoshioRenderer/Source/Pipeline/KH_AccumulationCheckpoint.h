@@ -0,0 +1,50 @@
+#pragma once
+
+#include "KH_Common.h"
+
+class KH_SceneBase;
+class KH_Camera;
+class KH_Framebuffer;
+
+// 长时间累积的断点：RGBA32F 累积缓冲（alpha 为每像素样本数）、帧计数、相机位姿与场景哈希，
+// 以原始 float 写盘。场景哈希一致时载入即可从保存时的样本数继续累积
+struct KH_AccumulationCheckpoint
+{
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    // 下一帧使用的帧计数，决定随机数与 Sobol 序号
+    uint32_t FrameCounter = 0;
+    uint32_t AccumulatedFrames = 0;
+    uint64_t SceneHash = 0;
+
+    glm::vec3 CameraPosition = glm::vec3(0.0f);
+    glm::vec3 CameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    glm::vec3 CameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    glm::vec3 CameraRight = glm::vec3(1.0f, 0.0f, 0.0f);
+    float CameraYaw = 0.0f;
+    float CameraPitch = 0.0f;
+    float CameraFovy = 45.0f;
+
+    std::vector<glm::vec4> Pixels;
+
+    // 几何、材质、着色开关与分辨率都参与哈希；相机单独保存并在载入时恢复
+    static uint64_t ComputeSceneHash(const KH_SceneBase& scene, glm::uvec2 extent);
+
+    // 相机位姿与视场角的哈希，以 seed 续接；相机由外部指定、不能被检查点覆盖时（离线渲染）并入兼容性哈希
+    static uint64_t ComputeCameraHash(const KH_Camera& camera, uint64_t seed);
+    // 检查点中保存的相机，与上面对同一相机的结果一致
+    uint64_t ComputeCameraHash(uint64_t seed) const;
+
+    // 主线程调用：读回累积目标并记录状态
+    bool Capture(const KH_Framebuffer& framebuffer, const KH_Camera& camera,
+        uint32_t frameCounter, uint32_t accumulatedFrames, uint64_t sceneHash);
+
+    // 只访问内存数据，可放到工作线程。先写临时文件再替换，写到一半崩溃不会破坏旧的检查点
+    bool SaveToFile(const std::string& path) const;
+    bool LoadFromFile(const std::string& path);
+
+    // 主线程调用：把累积写回 framebuffer（应为下一帧读取的历史目标）并恢复相机
+    bool Restore(KH_Framebuffer& framebuffer, KH_Camera& camera) const;
+    // 只写回累积，保留调用方的相机
+    bool RestoreAccumulation(KH_Framebuffer& framebuffer) const;
+};
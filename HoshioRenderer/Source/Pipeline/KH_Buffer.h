@@ -1,6 +1,9 @@
 #pragma once
 
 #include "KH_Common.h"
+#include "KH_GLState.h"
+
+#include <cassert>
 
 template <typename T, GLenum Target = GL_SHADER_STORAGE_BUFFER>
 class KH_Buffer {
@@ -13,7 +16,10 @@ public:
     }
 
     ~KH_Buffer() {
-        if (ID != 0) glDeleteBuffers(1, &ID);
+        if (ID != 0) {
+            KH_GLState::Instance().OnBufferDeleted(ID);
+            glDeleteBuffers(1, &ID);
+        }
     }
 
     KH_Buffer(const KH_Buffer&) = delete;
@@ -33,20 +39,17 @@ public:
 
     void GetData(std::vector<T>& outData) const {
         outData.resize(Size);
-        glBindBuffer(Target, ID);
-        glGetBufferSubData(Target, 0, Size * sizeof(T), outData.data());
-        glBindBuffer(Target, 0);
+        if (ID == 0 || Size == 0) return;
+
+        glGetNamedBufferSubData(ID, 0, Size * sizeof(T), outData.data());
     }
 
     void Clear() const {
         if (ID == 0 || Size == 0) return;
 
-        glBindBuffer(Target, ID);
-
         GLenum format = (sizeof(T) % 4 == 0) ? GL_R32UI : GL_R8UI;
 
-        glClearBufferData(Target, format, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
-        glBindBuffer(Target, 0);
+        glClearNamedBufferData(ID, format, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
     }
 
     void SetBindPoint(unsigned int BindPoint) {
@@ -55,15 +58,15 @@ public:
 
     void Bind(unsigned int BindPoint) {
         SetBindPoint(BindPoint);
-        glBindBufferBase(Target, BindPoint, ID);
+        Bind();
     }
 
     void Bind() const {
-        glBindBufferBase(Target, BindPoint, ID);
+        KH_GLState::Instance().BindBufferBase(Target, BindPoint, ID);
     }
 
     void Unbind() const {
-        glBindBufferBase(Target, BindPoint, 0);
+        KH_GLState::Instance().BindBufferBase(Target, BindPoint, 0);
     }
 
     unsigned int GetID() const { return ID; }
@@ -76,20 +79,16 @@ private:
 
     void UpdateBuffer(const T* data, size_t count, GLenum usage) {
         if (ID == 0) {
-            glGenBuffers(1, &ID);
+            glCreateBuffers(1, &ID);
         }
 
-        glBindBuffer(Target, ID);
-
         if (count != Size) {
-            glBufferData(Target, count * sizeof(T), data, usage);
+            glNamedBufferData(ID, count * sizeof(T), data, usage);
             Size = count;
         }
-        else {
-            glBufferSubData(Target, 0, count * sizeof(T), data);
+        else if (data && count > 0) {
+            glNamedBufferSubData(ID, 0, count * sizeof(T), data);
         }
-
-        glBindBuffer(Target, 0);
     }
 };
 
@@ -98,3 +97,275 @@ using KH_SSBO = KH_Buffer<T, GL_SHADER_STORAGE_BUFFER>;
 
 template <typename T>
 using KH_UBO = KH_Buffer<T, GL_UNIFORM_BUFFER>;
+
+// 每帧更新的数据使用的环形区段数量
+constexpr uint32_t KH_BUFFER_FRAMES_IN_FLIGHT = 3;
+
+// glBufferStorage + 持久一致映射，容量按倍数增长
+// FrameCount > 1 时按区段环形多缓冲，每次写入换到下一个区段并等待其 fence，避免覆盖 GPU 仍在读取的数据；
+// 每帧都会改写的缓冲应使用 KH_BUFFER_FRAMES_IN_FLIGHT 个区段
+// FrameCount == 1 时每次写入都要等待此前提交的全部 GPU 工作完成（CPU 与 GPU 串行），只适合很少改动的缓冲
+// 映射只可写，任何时候都不从 Mapped 读回
+template <typename T, GLenum Target = GL_SHADER_STORAGE_BUFFER>
+class KH_PersistentBuffer {
+public:
+    KH_PersistentBuffer(unsigned int bindPoint = 0, uint32_t frameCount = 1)
+        : BindPoint(bindPoint), FrameCount(std::max(frameCount, 1u)), Fences(FrameCount, nullptr), RegionDirty(FrameCount) {}
+
+    ~KH_PersistentBuffer() {
+        Release();
+    }
+
+    KH_PersistentBuffer(const KH_PersistentBuffer&) = delete;
+    KH_PersistentBuffer& operator=(const KH_PersistentBuffer&) = delete;
+
+    void SetData(const std::vector<T>& data) {
+        SetData(data.data(), data.size());
+    }
+
+    void SetData(const T* data, size_t count) {
+        Reserve(count);
+        if (FrameCount > 1) {
+            Shadow.assign(data, data + count);
+            MarkRegionsDirty(0, count);
+        }
+
+        T* dst = BeginWrite();
+        if (count > 0) std::memcpy(dst, data, count * sizeof(T));
+        Size = count;
+        if (FrameCount > 1) RegionDirty[CurrentRegion] = {};
+    }
+
+    void SetSingleData(const T& data) {
+        SetData(&data, 1);
+    }
+
+    // 只改写 [offset, offset + count)；多缓冲时新区段只补写它落后于 CPU 副本的范围
+    void Update(size_t offset, const T* data, size_t count) {
+        if (count == 0) return;
+
+        if (offset + count > Size) {
+            if (FrameCount > 1) {
+                std::vector<T> merged(offset + count);
+                std::copy(Shadow.begin(), Shadow.end(), merged.begin());
+                std::memcpy(merged.data() + offset, data, count * sizeof(T));
+                SetData(merged);
+                return;
+            }
+
+            // 扩容时旧内容在 GPU 上拷贝，[Size, offset) 的空隙补零
+            const size_t oldSize = Size;
+            Reserve(offset + count);
+            WaitForGPU(0);
+            if (offset > oldSize) std::memset(Mapped + oldSize, 0, (offset - oldSize) * sizeof(T));
+            std::memcpy(Mapped + offset, data, count * sizeof(T));
+            Size = offset + count;
+            return;
+        }
+
+        if (FrameCount > 1) {
+            std::memcpy(Shadow.data() + offset, data, count * sizeof(T));
+            MarkRegionsDirty(offset, offset + count);
+
+            T* dst = BeginWrite();
+            const KH_DirtyRange dirty = RegionDirty[CurrentRegion];
+            std::memcpy(dst + dirty.Begin, Shadow.data() + dirty.Begin, (dirty.End - dirty.Begin) * sizeof(T));
+            RegionDirty[CurrentRegion] = {};
+            return;
+        }
+
+        WaitForGPU(0);
+        std::memcpy(Mapped + offset, data, count * sizeof(T));
+    }
+
+    void Update(size_t offset, const std::vector<T>& data) {
+        Update(offset, data.data(), data.size());
+    }
+
+    void Reserve(size_t count, bool bPreserve = true) {
+        if (count <= Capacity && ID != 0) return;
+
+        size_t newCapacity = std::max<size_t>(Capacity, 1);
+        while (newCapacity < count) newCapacity *= 2;
+
+        Allocate(newCapacity, bPreserve);
+    }
+
+    // 以下两个接口只用于单缓冲：等待 GPU 后直接返回映射内存，调用方（可多线程）原地写入，没有中间拷贝。
+    // 多缓冲需要 CPU 副本才能补写其他区段，请使用 SetData / Update
+
+    // 整体改写为 count 个元素
+    T* MapForWrite(size_t count) {
+        assert(FrameCount == 1);
+        Reserve(count, false);
+        Size = count;
+
+        WaitForGPU(0);
+        return Mapped;
+    }
+
+    // 返回 [offset, offset + count) 的可写指针，范围需在当前 Size 之内
+    T* MapRange(size_t offset, size_t count) {
+        assert(FrameCount == 1);
+        if (offset + count > Size) return nullptr;
+
+        WaitForGPU(0);
+        return Mapped + offset;
+    }
+
+    void SetBindPoint(unsigned int BindPoint) {
+        this->BindPoint = BindPoint;
+    }
+
+    void Bind(unsigned int BindPoint) {
+        SetBindPoint(BindPoint);
+        Bind();
+    }
+
+    void Bind() const {
+        if (ID == 0) return;
+        KH_GLState::Instance().BindBufferRange(Target, BindPoint, ID, static_cast<GLintptr>(CurrentRegion * RegionStride),
+            static_cast<GLsizeiptr>(std::max<size_t>(Size, 1) * sizeof(T)));
+    }
+
+    void Unbind() const {
+        KH_GLState::Instance().BindBufferBase(Target, BindPoint, 0);
+    }
+
+    unsigned int GetID() const { return ID; }
+    size_t GetCount() const { return Size; }
+    size_t GetCapacity() const { return Capacity; }
+
+private:
+    unsigned int ID = 0;
+    unsigned int BindPoint = 0;
+    uint32_t FrameCount = 1;
+    uint32_t CurrentRegion = 0;
+
+    size_t Size = 0;
+    size_t Capacity = 0;
+    size_t RegionStride = 0;
+
+    T* Mapped = nullptr;
+    std::vector<GLsync> Fences;
+
+    struct KH_DirtyRange {
+        size_t Begin = 0;
+        size_t End = 0;
+    };
+
+    // 多缓冲时保存最新内容，并记录每个区段尚未同步的范围
+    std::vector<T> Shadow;
+    std::vector<KH_DirtyRange> RegionDirty;
+
+    void MarkRegionsDirty(size_t begin, size_t end) {
+        for (KH_DirtyRange& range : RegionDirty) {
+            if (range.Begin == range.End) range = { begin, end };
+            else range = { std::min(range.Begin, begin), std::max(range.End, end) };
+        }
+    }
+
+    T* RegionPointer(uint32_t region) const {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(Mapped) + region * RegionStride);
+    }
+
+    // 单缓冲直接等待之前的 GPU 工作；多缓冲先为当前区段打 fence，再切到下一个区段
+    T* BeginWrite() {
+        if (FrameCount == 1) {
+            WaitForGPU(0);
+            return Mapped;
+        }
+
+        if (Fences[CurrentRegion]) glDeleteSync(Fences[CurrentRegion]);
+        Fences[CurrentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        CurrentRegion = (CurrentRegion + 1) % FrameCount;
+        WaitFence(CurrentRegion);
+        return RegionPointer(CurrentRegion);
+    }
+
+    void WaitForGPU(uint32_t region) {
+        if (Fences[region]) glDeleteSync(Fences[region]);
+        Fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        WaitFence(region);
+    }
+
+    void WaitFence(uint32_t region) {
+        GLsync fence = Fences[region];
+        if (!fence) return;
+
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+
+        glDeleteSync(fence);
+        Fences[region] = nullptr;
+    }
+
+    void Allocate(size_t capacity, bool bPreserve = true) {
+        const size_t preservedSize = (bPreserve && ID != 0) ? Size : 0;
+
+        GLint alignment = 1;
+        glGetIntegerv(Target == GL_UNIFORM_BUFFER ? GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT : GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        alignment = std::max(alignment, 1);
+
+        const size_t regionStride = (capacity * sizeof(T) + alignment - 1) / alignment * alignment;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        unsigned int newID = 0;
+        glCreateBuffers(1, &newID);
+        glNamedBufferStorage(newID, static_cast<GLsizeiptr>(regionStride * FrameCount), nullptr, flags);
+
+        // 单缓冲没有 CPU 副本，旧内容在 GPU 上拷贝；之后的写入都会先 WaitForGPU，不会与拷贝冲突
+        if (FrameCount == 1 && preservedSize > 0) {
+            glCopyNamedBufferSubData(ID, newID, static_cast<GLintptr>(CurrentRegion * RegionStride), 0,
+                static_cast<GLsizeiptr>(preservedSize * sizeof(T)));
+        }
+
+        std::vector<T> shadow = std::move(Shadow);
+        Release();
+        Shadow = std::move(shadow);
+
+        ID = newID;
+        Capacity = capacity;
+        RegionStride = regionStride;
+        Mapped = static_cast<T*>(glMapNamedBufferRange(ID, 0, static_cast<GLsizeiptr>(RegionStride * FrameCount), flags));
+
+        CurrentRegion = 0;
+        Size = preservedSize;
+        if (FrameCount > 1 && preservedSize > 0)
+            std::memcpy(Mapped, Shadow.data(), std::min(preservedSize, Shadow.size()) * sizeof(T));
+
+        // 新分配的其余区段内容未定义，下次轮到时整段补写
+        if (FrameCount > 1) {
+            std::fill(RegionDirty.begin(), RegionDirty.end(), KH_DirtyRange{ 0, Size });
+            RegionDirty[0] = {};
+        }
+    }
+
+    void Release() {
+        for (GLsync& fence : Fences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        if (ID != 0) {
+            if (Mapped) glUnmapNamedBuffer(ID);
+            KH_GLState::Instance().OnBufferDeleted(ID);
+            glDeleteBuffers(1, &ID);
+        }
+
+        ID = 0;
+        Mapped = nullptr;
+        Capacity = 0;
+        RegionStride = 0;
+        Size = 0;
+    }
+};
+
+template <typename T>
+using KH_PersistentSSBO = KH_PersistentBuffer<T, GL_SHADER_STORAGE_BUFFER>;
+
+template <typename T>
+using KH_PersistentUBO = KH_PersistentBuffer<T, GL_UNIFORM_BUFFER>;
@@ -0,0 +1,1630 @@
+#include "KH_CpuPathTracer.h"
+#include "Editor/KH_Camera.h"
+#include "Scene/KH_Scene.h"
+#include "Pipeline/KH_Texture.h"
+#include "Pipeline/KH_SobolSampler.h"
+#include "Hit/KH_AABB.h"
+#include "Utils/KH_SobolTable.h"
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+
+namespace
+{
+    constexpr float INF = 1e30f;
+    constexpr float HitEPS = 1e-8f;
+    constexpr float Pi = glm::pi<float>();
+
+    const glm::vec3 SkyColor = glm::vec3(0.05f);
+
+    constexpr uint32_t MaxLeafTriangles = 4;
+    constexpr uint32_t MaxBVHDepth = 48;
+    constexpr uint32_t SAHBinCount = 12;
+    constexpr int TraversalStackSize = 64;
+
+    using KH_Triangle = KH_CpuPathTracer::KH_Triangle;
+    using KH_Node = KH_CpuPathTracer::KH_Node;
+    using KH_Environment = KH_CpuPathTracer::KH_Environment;
+
+    // ---------------- 采样器，与 DisneyBSDF_6.frag 的 rand / SobolOwen 相同 ----------------
+    // 维度分配：0-1 相机抖动，之后每次弹射固定占用 SOBOL_DIMS_PER_BOUNCE 维
+    constexpr uint32_t SOBOL_DIM_CAMERA_JITTER = 0u;
+    constexpr uint32_t SOBOL_DIM_BOUNCE_BASE = 2u;
+    constexpr uint32_t SOBOL_DIMS_PER_BOUNCE = KH_SOBOL_DIMS_PER_BOUNCE;
+
+    constexpr uint32_t SOBOL_DIM_BSDF_SELECT = 0u;
+    constexpr uint32_t SOBOL_DIM_BSDF_LOBE = 1u;
+    constexpr uint32_t SOBOL_DIM_BSDF_DIR = 2u;
+    constexpr uint32_t SOBOL_DIM_ENV_NEE = 4u;
+    constexpr uint32_t SOBOL_DIM_RR = 6u;
+
+    constexpr uint32_t SobolDimensionCount = std::min(KH_SOBOL_MAX_DIMENSIONS, KH_SOBOL_TABLE_DIMENSIONS);
+
+    uint32_t WangHash(uint32_t seed)
+    {
+        seed = (seed ^ 61u) ^ (seed >> 16u);
+        seed *= 9u;
+        seed = seed ^ (seed >> 4u);
+        seed *= 0x27d4eb2du;
+        seed = seed ^ (seed >> 15u);
+        return seed;
+    }
+
+    uint32_t ReverseBits(uint32_t x)
+    {
+        x = ((x >> 1u) & 0x55555555u) | ((x & 0x55555555u) << 1u);
+        x = ((x >> 2u) & 0x33333333u) | ((x & 0x33333333u) << 2u);
+        x = ((x >> 4u) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4u);
+        x = ((x >> 8u) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8u);
+        return (x >> 16u) | (x << 16u);
+    }
+
+    uint32_t LaineKarrasPermutation(uint32_t x, uint32_t seed)
+    {
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return x;
+    }
+
+    uint32_t NestedUniformScramble(uint32_t x, uint32_t seed)
+    {
+        return ReverseBits(LaineKarrasPermutation(ReverseBits(x), seed));
+    }
+
+    uint32_t SobolSample(uint32_t index, uint32_t dim)
+    {
+        uint32_t result = 0u;
+        const uint32_t* directions = KH_SobolDirectionTable + dim * 32u;
+        for (uint32_t j = 0u; index != 0u; index >>= 1u, j++)
+        {
+            if ((index & 1u) != 0u)
+                result ^= directions[j];
+        }
+        return result;
+    }
+
+    struct KH_Sampler
+    {
+        uint32_t RngState = 0;
+        uint32_t PixelSeed = 0;
+        uint32_t FrameIndex = 0;
+        uint32_t BounceDimension = SOBOL_DIM_BOUNCE_BASE;
+        bool bSobol = true;
+
+        // 像素坐标取 gl_FragCoord 的整数部分，样本序号对应 uFrameCounter
+        void Begin(uint32_t x, uint32_t y, uint32_t frame, bool bEnableSobol)
+        {
+            RngState = x * 1973u + y * 9277u + frame * 26699u + 1u;
+            PixelSeed = WangHash((x * 1973u) ^ (y * 9277u) ^ 0x68bc21ebu);
+            FrameIndex = frame;
+            BounceDimension = SOBOL_DIM_BOUNCE_BASE;
+            bSobol = bEnableSobol;
+        }
+
+        float Rand()
+        {
+            RngState = WangHash(RngState);
+            return static_cast<float>(RngState) / 4294967296.0f;
+        }
+
+        float SobolOwen(uint32_t dim)
+        {
+            if (!bSobol || dim >= SobolDimensionCount)
+                return Rand();
+
+            const uint32_t index = NestedUniformScramble(FrameIndex, PixelSeed);
+            uint32_t x = SobolSample(index, dim);
+            x = NestedUniformScramble(x, WangHash(PixelSeed ^ (dim * 0x9e3779b9u)));
+            return static_cast<float>(x >> 8u) / 16777216.0f;
+        }
+
+        float SampleBounceDimension(uint32_t offset)
+        {
+            return SobolOwen(BounceDimension + offset);
+        }
+    };
+
+    // ---------------- 采样与几何工具 ----------------
+    float Sqr(float x) { return x * x; }
+
+    float ComputeGlassProbability(const KH_BSDFMaterial& Mat)
+    {
+        const float r_diffuse = (1.0f - Mat.Metallic) * (1.0f - Mat.Transmission);
+        const float r_specular = 1.0f - Mat.Transmission * (1.0f - Mat.Metallic);
+        const float r_glass = (1.0f - Mat.Metallic) * Mat.Transmission;
+        const float r_clearcoat = 0.25f * Mat.Clearcoat;
+        const float r_sum = std::max(r_diffuse + r_specular + r_glass + r_clearcoat, 1e-8f);
+
+        return r_glass / r_sum;
+    }
+
+    void BuildBasis(glm::vec3 N, glm::vec3& T, glm::vec3& B)
+    {
+        glm::vec3 helper(1.0f, 0.0f, 0.0f);
+        if (std::abs(N.x) > 0.999f) helper = glm::vec3(0.0f, 0.0f, 1.0f);
+        T = glm::normalize(glm::cross(N, helper));
+        B = glm::normalize(glm::cross(N, T));
+    }
+
+    glm::vec3 ToNormalHemisphere(glm::vec3 v, glm::vec3 N)
+    {
+        glm::vec3 T, B;
+        BuildBasis(glm::normalize(N), T, B);
+        return glm::normalize(v.x * T + v.y * B + v.z * glm::normalize(N));
+    }
+
+    glm::vec2 SampleSphericalMap(glm::vec3 v)
+    {
+        glm::vec2 uv(std::atan2(v.z, v.x), std::asin(glm::clamp(v.y, -1.0f, 1.0f)));
+        uv /= glm::vec2(2.0f * Pi, Pi);
+        return uv + 0.5f;
+    }
+
+    glm::vec3 SampleCosineHemisphere(float xi_1, float xi_2, glm::vec3 N)
+    {
+        const float r = std::sqrt(xi_1);
+        const float theta = xi_2 * 2.0f * Pi;
+        const float z = std::sqrt(std::max(0.0f, 1.0f - xi_1));
+
+        return ToNormalHemisphere(glm::vec3(r * std::cos(theta), r * std::sin(theta), z), N);
+    }
+
+    glm::vec3 SampleGTR2(float xi_1, float xi_2, glm::vec3 N, float alpha)
+    {
+        alpha = std::max(alpha, 1e-3f);
+        const float phi = 2.0f * Pi * xi_1;
+        const float cosTheta = std::sqrt((1.0f - xi_2) / (1.0f + (alpha * alpha - 1.0f) * xi_2));
+        const float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+
+        return ToNormalHemisphere(glm::vec3(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta), N);
+    }
+
+    glm::vec3 SampleGTR1(float xi_1, float xi_2, glm::vec3 N, float alpha)
+    {
+        alpha = std::max(alpha, 1e-3f);
+        const float alpha2 = alpha * alpha;
+        const float phi = 2.0f * Pi * xi_1;
+        const float cosTheta = std::sqrt((1.0f - std::pow(alpha2, 1.0f - xi_2)) / (1.0f - alpha2));
+        const float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+
+        return ToNormalHemisphere(glm::vec3(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta), N);
+    }
+
+    glm::vec3 SampleGGXVNDF(glm::vec3 Ve, float alpha_x, float alpha_y, float U1, float U2)
+    {
+        const glm::vec3 Vh = glm::normalize(glm::vec3(alpha_x * Ve.x, alpha_y * Ve.y, Ve.z));
+
+        const float lensq = Vh.x * Vh.x + Vh.y * Vh.y;
+        const glm::vec3 T1 = lensq > 0.0f ? glm::vec3(-Vh.y, Vh.x, 0.0f) / std::sqrt(lensq) : glm::vec3(1.0f, 0.0f, 0.0f);
+        const glm::vec3 T2 = glm::cross(Vh, T1);
+
+        const float r = std::sqrt(U1);
+        const float phi = 2.0f * Pi * U2;
+        const float t1 = r * std::cos(phi);
+        float t2 = r * std::sin(phi);
+        const float s = 0.5f * (1.0f + Vh.z);
+        t2 = (1.0f - s) * std::sqrt(1.0f - t1 * t1) + s * t2;
+
+        const glm::vec3 Nh = t1 * T1 + t2 * T2 + std::sqrt(std::max(0.0f, 1.0f - t1 * t1 - t2 * t2)) * Vh;
+
+        return glm::normalize(glm::vec3(alpha_x * Nh.x, alpha_y * Nh.y, std::max(0.0f, Nh.z)));
+    }
+
+    glm::vec3 SampleGGXVNDF_World(glm::vec3 Ve_world, glm::vec3 N, float alpha_x, float alpha_y, float U1, float U2)
+    {
+        N = glm::normalize(N);
+        glm::vec3 T, B;
+        BuildBasis(N, T, B);
+
+        glm::vec3 Ve_local(glm::dot(Ve_world, T), glm::dot(Ve_world, B), glm::dot(Ve_world, N));
+
+        const glm::vec3 Vh = glm::normalize(glm::vec3(alpha_x * Ve_local.x, alpha_y * Ve_local.y, Ve_local.z));
+        if (Vh.z < 0.0f) Ve_local = -Ve_local;
+
+        alpha_x = std::max(1e-3f, alpha_x);
+        alpha_y = std::max(1e-3f, alpha_y);
+        const glm::vec3 Ne_local = SampleGGXVNDF(Ve_local, alpha_x, alpha_y, U1, U2);
+        return Ne_local.x * T + Ne_local.y * B + Ne_local.z * N;
+    }
+
+    // ---------------- Disney BSDF ----------------
+    float SchlickFresnel(float u)
+    {
+        const float m = glm::clamp(1.0f - u, 0.0f, 1.0f);
+        const float m2 = m * m;
+        return m2 * m2 * m;
+    }
+
+    bool SameHemisphere(glm::vec3 a, glm::vec3 b, glm::vec3 N)
+    {
+        return glm::dot(a, N) * glm::dot(b, N) > 0.0f;
+    }
+
+    float AbsDot(glm::vec3 a, glm::vec3 b)
+    {
+        return std::abs(glm::dot(a, b));
+    }
+
+    float FrDielectric(float cosThetaI, float eta)
+    {
+        cosThetaI = glm::clamp(cosThetaI, -1.0f, 1.0f);
+
+        const float sin2ThetaI = std::max(0.0f, 1.0f - cosThetaI * cosThetaI);
+        const float sin2ThetaT = eta * eta * sin2ThetaI;
+
+        if (sin2ThetaT >= 1.0f)
+            return 1.0f;
+
+        const float cosThetaT = std::sqrt(std::max(0.0f, 1.0f - sin2ThetaT));
+        const float absCosI = std::abs(cosThetaI);
+
+        const float Rs = (absCosI - eta * cosThetaT) / std::max(absCosI + eta * cosThetaT, 1e-6f);
+        const float Rp = (eta * absCosI - cosThetaT) / std::max(eta * absCosI + cosThetaT, 1e-6f);
+
+        return 0.5f * (Rs * Rs + Rp * Rp);
+    }
+
+    glm::vec3 HalfVectorReflection(glm::vec3 wi, glm::vec3 wo)
+    {
+        const glm::vec3 h = wi + wo;
+        const float len2 = glm::dot(h, h);
+        if (len2 <= 1e-12f)
+            return glm::vec3(0.0f);
+        return h / std::sqrt(len2);
+    }
+
+    glm::vec3 HalfVectorTransmission(glm::vec3 wi, glm::vec3 wo, float eta_wi2wo)
+    {
+        const glm::vec3 h = wi * eta_wi2wo + wo;
+        const float len2 = glm::dot(h, h);
+        if (len2 <= 1e-12f)
+            return glm::vec3(0.0f);
+        return h / std::sqrt(len2);
+    }
+
+    float GTR1(float NdotH, float a)
+    {
+        a = std::max(a, 1e-3f);
+        if (a >= 1.0f) return 1.0f / Pi;
+        const float a2 = a * a;
+        const float t = 1.0f + (a2 - 1.0f) * NdotH * NdotH;
+        return (a2 - 1.0f) / (Pi * std::log(a2) * t);
+    }
+
+    float GTR2(float NdotH, float a)
+    {
+        a = std::max(a, 1e-3f);
+        const float a2 = a * a;
+        const float t = 1.0f + (a2 - 1.0f) * NdotH * NdotH;
+        return a2 / (Pi * t * t);
+    }
+
+    float SmithG_GGX(float NdotV, float alphaG)
+    {
+        const float a = alphaG * alphaG;
+        const float b = NdotV * NdotV;
+        return 1.0f / (NdotV + std::sqrt(a + b - a * b));
+    }
+
+    float SmithG1_GGX(float NdotV, float alpha)
+    {
+        NdotV = std::max(NdotV, 1e-6f);
+        alpha = std::max(alpha, 1e-3f);
+
+        const float a2 = alpha * alpha;
+        const float n2 = NdotV * NdotV;
+        return (2.0f * NdotV) / (NdotV + std::sqrt(a2 + (1.0f - a2) * n2));
+    }
+
+    float SmithG_GGX_Glass(float NdotL, float NdotV, float alpha)
+    {
+        return SmithG1_GGX(NdotL, alpha) * SmithG1_GGX(NdotV, alpha);
+    }
+
+    glm::vec3 EvalBRDF(glm::vec3 L, glm::vec3 V, glm::vec3 N, const KH_BSDFMaterial& Mat)
+    {
+        const float NdotL = std::max(glm::dot(N, L), 0.0f);
+        const float NdotV = std::max(glm::dot(N, V), 0.0f);
+        if (NdotL <= 0.0f || NdotV <= 0.0f) return glm::vec3(0.0f);
+
+        const glm::vec3 H = glm::normalize(L + V);
+        const float NdotH = std::max(glm::dot(N, H), 0.0f);
+        const float LdotH = std::max(glm::dot(L, H), 0.0f);
+
+        const glm::vec3 Cdlin = Mat.BaseColor;
+        const float Cdlum = 0.3f * Cdlin[0] + 0.6f * Cdlin[1] + 0.1f * Cdlin[2];
+
+        const glm::vec3 Ctint = Cdlum > 0.0f ? Cdlin / Cdlum : glm::vec3(1.0f);
+        const glm::vec3 Cspec0 = glm::mix(Mat.Specular * 0.08f * glm::mix(glm::vec3(1.0f), Ctint, Mat.SpecularTint), Cdlin, Mat.Metallic);
+        const glm::vec3 Csheen = glm::mix(glm::vec3(1.0f), Ctint, Mat.SheenTint);
+
+        const float FL = SchlickFresnel(NdotL), FV = SchlickFresnel(NdotV);
+        const float Fd90 = 0.5f + 2.0f * LdotH * LdotH * Mat.Roughness;
+        const float Fd = glm::mix(1.0f, Fd90, FL) * glm::mix(1.0f, Fd90, FV);
+
+        const float Fss90 = LdotH * LdotH * Mat.Roughness;
+        const float Fss = glm::mix(1.0f, Fss90, FL) * glm::mix(1.0f, Fss90, FV);
+        const float ss = 1.25f * (Fss * (1.0f / std::max(NdotL + NdotV, 1e-6f) - 0.5f) + 0.5f);
+
+        glm::vec3 diffuse = (1.0f / Pi) * glm::mix(Fd, ss, Mat.Subsurface) * Cdlin;
+
+        const float roughness = std::max(Mat.Roughness, 0.02f);
+        const float alpha = roughness * roughness;
+
+        const float Ds = GTR2(NdotH, alpha);
+        const float FH = SchlickFresnel(LdotH);
+        const glm::vec3 Fs = glm::mix(Cspec0, glm::vec3(1.0f), FH);
+        const float Gs = SmithG_GGX(NdotL, roughness) * SmithG_GGX(NdotV, roughness);
+
+        const glm::vec3 specular = Gs * Fs * Ds;
+
+        diffuse += FH * Mat.Sheen * Csheen;
+
+        const float Dr = GTR1(NdotH, glm::mix(0.1f, 0.001f, Mat.ClearcoatGloss));
+        const float Fr = glm::mix(0.04f, 1.0f, FH);
+        const float Gr = SmithG_GGX(NdotL, 0.25f) * SmithG_GGX(NdotV, 0.25f);
+
+        return diffuse * (1.0f - Mat.Metallic)
+             + specular
+             + glm::vec3(0.25f * Mat.Clearcoat * Gr * Fr * Dr);
+    }
+
+    glm::vec3 EvalGlassReflection(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, float eta, const KH_BSDFMaterial& Mat)
+    {
+        if (!SameHemisphere(wi, wo, Ns))
+            return glm::vec3(0.0f);
+
+        const float NdotL = AbsDot(Ns, wi);
+        const float NdotV = AbsDot(Ns, wo);
+        if (NdotL <= 1e-6f || NdotV <= 1e-6f)
+            return glm::vec3(0.0f);
+
+        const float roughness = std::max(Mat.Roughness, 0.01f);
+        const float alpha = roughness * roughness;
+
+        glm::vec3 H = HalfVectorReflection(wi, wo);
+        if (glm::dot(H, H) <= 0.0f)
+            return glm::vec3(0.0f);
+
+        if (glm::dot(H, Ns) < 0.0f)
+            H = -H;
+
+        const float NdotH = AbsDot(Ns, H);
+        const float VdotH = AbsDot(wo, H);
+        if (NdotH <= 1e-6f || VdotH <= 1e-6f)
+            return glm::vec3(0.0f);
+
+        const float Fg = FrDielectric(glm::dot(wi, H), eta);
+        const float Dg = GTR2(NdotH, alpha);
+        const float Gg = SmithG_GGX_Glass(NdotL, NdotV, alpha);
+
+        return Mat.BaseColor * Fg * Dg * Gg / (4.0f * NdotL * NdotV);
+    }
+
+    glm::vec3 EvalGlassTransmission(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, float eta_wi2wo, const KH_BSDFMaterial& Mat)
+    {
+        if (SameHemisphere(wi, wo, Ns))
+            return glm::vec3(0.0f);
+
+        const float NdotL = AbsDot(Ns, wi);
+        const float NdotV = AbsDot(Ns, wo);
+        if (NdotL <= 1e-6f || NdotV <= 1e-6f)
+            return glm::vec3(0.0f);
+
+        const float roughness = std::max(Mat.Roughness, 0.01f);
+        const float alpha = roughness * roughness;
+
+        glm::vec3 H = HalfVectorTransmission(wi, wo, eta_wi2wo);
+        if (glm::dot(H, H) <= 0.0f)
+            return glm::vec3(0.0f);
+
+        if (glm::dot(H, Ns) < 0.0f)
+            H = -H;
+
+        const float cosWi = glm::dot(Ns, wi);
+        const float cosWo = glm::dot(Ns, wo);
+        if (glm::dot(H, wi) * cosWi < 0.0f || glm::dot(H, wo) * cosWo < 0.0f)
+            return glm::vec3(0.0f);
+
+        const float NdotH = AbsDot(Ns, H);
+        const float VdotH = AbsDot(wo, H);
+        const float LdotH = AbsDot(wi, H);
+
+        if (NdotH <= 1e-6f || VdotH <= 1e-6f || LdotH <= 1e-6f)
+            return glm::vec3(0.0f);
+
+        const float Fg = FrDielectric(glm::dot(wi, H), eta_wi2wo);
+        const float Dg = GTR2(NdotH, alpha);
+        const float Gg = SmithG_GGX_Glass(NdotL, NdotV, alpha);
+
+        const float sqrtDenom = eta_wi2wo * LdotH + VdotH;
+        const float denom = std::max(NdotL * NdotV * sqrtDenom * sqrtDenom, 1e-6f);
+
+        const glm::vec3 tint = glm::sqrt(glm::max(Mat.BaseColor, glm::vec3(0.0f)));
+
+        return tint * std::abs((1.0f - Fg) * Dg * Gg * LdotH * VdotH / denom);
+    }
+
+    glm::vec3 BSDF(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, glm::vec3 Ng, float p_glass, bool bIsInside, const KH_BSDFMaterial& Mat)
+    {
+        const float eta_wi2wo = bIsInside ? (1.0f / std::max(Mat.IOR, 1.0001f)) : std::max(Mat.IOR, 1.0001f);
+        const bool sameSide = glm::dot(Ng, wi) * glm::dot(Ng, wo) > 0.0f;
+
+        glm::vec3 f = (1.0f - p_glass) * EvalBRDF(wi, wo, Ns, Mat);
+
+        if (sameSide)
+            f += p_glass * EvalGlassReflection(wi, wo, Ns, 1.0f / eta_wi2wo, Mat);
+        else
+            f += p_glass * EvalGlassTransmission(wi, wo, Ns, eta_wi2wo, Mat);
+
+        return f;
+    }
+
+    struct KH_BSDFSample
+    {
+        glm::vec3 wi = glm::vec3(0.0f);
+        float cosTheta = 0.0f;
+        float PDF = 0.0f;
+        float p_glass = 0.0f;
+    };
+
+    float PdfDiffuseIS(glm::vec3 wi, glm::vec3 Ns)
+    {
+        const float cosTheta = glm::dot(Ns, wi);
+        return (cosTheta > 0.0f) ? (cosTheta / Pi) : 0.0f;
+    }
+
+    // GTR1 / GTR2 半程向量采样换算到 wi 的 pdf
+    template<float (*D)(float, float)>
+    float PdfHalfVectorIS(glm::vec3 wi, glm::vec3 V, glm::vec3 Ns, float alpha)
+    {
+        if (glm::dot(Ns, wi) <= 0.0f || glm::dot(Ns, V) <= 0.0f)
+            return 0.0f;
+
+        glm::vec3 H = wi + V;
+        const float HLen2 = glm::dot(H, H);
+        if (HLen2 <= 1e-12f)
+            return 0.0f;
+        H /= std::sqrt(HLen2);
+
+        const float NdotH = glm::dot(Ns, H);
+        const float VdotH = glm::dot(V, H);
+
+        if (NdotH <= 0.0f || VdotH <= 1e-6f)
+            return 0.0f;
+
+        return D(NdotH, alpha) * NdotH / (4.0f * VdotH);
+    }
+
+    float PdfGlassReflectionIS(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, float eta_wo2wi, float alpha)
+    {
+        if (!SameHemisphere(wi, wo, Ns))
+            return 0.0f;
+
+        glm::vec3 H = HalfVectorReflection(wi, wo);
+        if (glm::dot(H, H) <= 0.0f)
+            return 0.0f;
+
+        if (glm::dot(H, Ns) < 0.0f)
+            H = -H;
+
+        const float NdotH = AbsDot(Ns, H);
+        const float VdotH = AbsDot(wo, H);
+
+        if (NdotH <= 1e-6f || VdotH <= 1e-6f)
+            return 0.0f;
+
+        const float pdfH = GTR2(NdotH, alpha) * NdotH;
+        const float Fg = FrDielectric(glm::dot(wo, H), eta_wo2wi);
+
+        return Fg * pdfH / std::max(4.0f * VdotH, 1e-6f);
+    }
+
+    float PdfGlassTransmissionIS(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, float eta_wo2wi, float alpha)
+    {
+        if (SameHemisphere(wi, wo, Ns))
+            return 0.0f;
+
+        glm::vec3 H = HalfVectorTransmission(wi, wo, 1.0f / eta_wo2wi);
+        if (glm::dot(H, H) <= 0.0f)
+            return 0.0f;
+
+        if (glm::dot(H, Ns) < 0.0f)
+            H = -H;
+
+        const float NdotH = AbsDot(Ns, H);
+        const float VdotH = AbsDot(wo, H);
+        const float LdotH = AbsDot(wi, H);
+
+        if (NdotH <= 1e-6f || VdotH <= 1e-6f || LdotH <= 1e-6f)
+            return 0.0f;
+
+        const float pdfH = GTR2(NdotH, alpha) * NdotH;
+        const float Fg = FrDielectric(glm::dot(wo, H), eta_wo2wi);
+
+        const float sqrtDenom = eta_wo2wi * VdotH + LdotH;
+        const float dwh_dwi = std::abs(LdotH / std::max(sqrtDenom * sqrtDenom, 1e-6f));
+
+        return (1.0f - Fg) * pdfH * dwh_dwi;
+    }
+
+    struct KH_BRDFLobes
+    {
+        float p_diffuse;
+        float p_specular;
+        float p_clearcoat;
+        float alpha_GTR1;
+        float alpha_GTR2;
+    };
+
+    KH_BRDFLobes ComputeBRDFLobes(const KH_BSDFMaterial& Mat)
+    {
+        const float r_diffuse = (1.0f - Mat.Metallic) * (1.0f - Mat.Transmission);
+        const float r_specular = 1.0f - Mat.Transmission * (1.0f - Mat.Metallic);
+        const float r_clearcoat = 0.25f * Mat.Clearcoat;
+        const float r_sum = std::max(r_diffuse + r_specular + r_clearcoat, 1e-8f);
+
+        return {
+            r_diffuse / r_sum,
+            r_specular / r_sum,
+            r_clearcoat / r_sum,
+            glm::mix(0.1f, 0.001f, Mat.ClearcoatGloss),
+            std::max(0.001f, Mat.Roughness * Mat.Roughness)
+        };
+    }
+
+    float BRDF_PDF_Eval(glm::vec3 wi, glm::vec3 V, glm::vec3 Ns, const KH_BSDFMaterial& Mat)
+    {
+        if (glm::dot(Ns, wi) <= 0.0f || glm::dot(Ns, V) <= 0.0f)
+            return 0.0f;
+
+        const KH_BRDFLobes Lobes = ComputeBRDFLobes(Mat);
+
+        return
+            Lobes.p_diffuse * PdfDiffuseIS(wi, Ns) +
+            Lobes.p_specular * PdfHalfVectorIS<GTR2>(wi, V, Ns, Lobes.alpha_GTR2) +
+            Lobes.p_clearcoat * PdfHalfVectorIS<GTR1>(wi, V, Ns, Lobes.alpha_GTR1);
+    }
+
+    float BSDF_Glass_PDF_Eval(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, bool bIsInside, const KH_BSDFMaterial& Mat)
+    {
+        const float roughness = std::max(Mat.Roughness, 0.01f);
+        const float alpha = roughness * roughness;
+        const float eta_wo2wi = bIsInside ? std::max(Mat.IOR, 1.0001f) : (1.0f / std::max(Mat.IOR, 1.0001f));
+
+        if (SameHemisphere(wi, wo, Ns))
+            return PdfGlassReflectionIS(wi, wo, Ns, eta_wo2wi, alpha);
+        return PdfGlassTransmissionIS(wi, wo, Ns, eta_wo2wi, alpha);
+    }
+
+    float BSDF_PDF_Eval(glm::vec3 wi, glm::vec3 wo, glm::vec3 Ns, float p_glass, bool bIsInside, const KH_BSDFMaterial& Mat)
+    {
+        return (1.0f - p_glass) * BRDF_PDF_Eval(wi, wo, Ns, Mat)
+             + p_glass * BSDF_Glass_PDF_Eval(wi, wo, Ns, bIsInside, Mat);
+    }
+
+    KH_BSDFSample SampleBRDF(glm::vec3 V, glm::vec3 Ns, const KH_BSDFMaterial& Mat, KH_Sampler& Sampler)
+    {
+        const KH_BRDFLobes Lobes = ComputeBRDFLobes(Mat);
+
+        const float xi_1 = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_DIR);
+        const float xi_2 = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_DIR + 1u);
+        const float xi_3 = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_LOBE);
+
+        KH_BSDFSample result;
+        glm::vec3 wi(0.0f);
+
+        if (xi_3 <= Lobes.p_diffuse)
+        {
+            wi = SampleCosineHemisphere(xi_1, xi_2, Ns);
+        }
+        else
+        {
+            glm::vec3 H = xi_3 <= Lobes.p_diffuse + Lobes.p_specular
+                ? SampleGTR2(xi_1, xi_2, Ns, Lobes.alpha_GTR2)
+                : SampleGTR1(xi_1, xi_2, Ns, Lobes.alpha_GTR1);
+            if (glm::dot(V, H) < 0.0f) H = -H;
+
+            if (glm::dot(V, H) <= 1e-6f)
+                return result;
+
+            wi = glm::reflect(-V, H);
+        }
+
+        const float cosTheta = glm::dot(Ns, wi);
+        if (cosTheta <= 0.0f)
+            return result;
+
+        result.wi = wi;
+        result.cosTheta = cosTheta;
+        result.PDF = std::max(BRDF_PDF_Eval(wi, V, Ns, Mat), 1e-8f);
+        return result;
+    }
+
+    KH_BSDFSample SampleBSDF_Glass(glm::vec3 wo, glm::vec3 Ns, bool bIsInside, bool bEnableVNDF, const KH_BSDFMaterial& Mat, KH_Sampler& Sampler)
+    {
+        const float roughness = std::max(Mat.Roughness, 0.01f);
+        const float alpha = roughness * roughness;
+        const float eta_wo2wi = bIsInside ? std::max(Mat.IOR, 1.0001f) : (1.0f / std::max(Mat.IOR, 1.0001f));
+
+        KH_BSDFSample result;
+
+        const float xi_1 = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_DIR);
+        const float xi_2 = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_DIR + 1u);
+
+        glm::vec3 H = bEnableVNDF
+            ? SampleGGXVNDF_World(wo, Ns, alpha, alpha, xi_1, xi_2)
+            : SampleGTR2(xi_1, xi_2, Ns, alpha);
+
+        if (glm::dot(wo, H) < 0.0f)
+            H = -H;
+
+        const float Fg = FrDielectric(glm::dot(wo, H), eta_wo2wi);
+
+        const glm::vec3 wi_reflect = glm::reflect(-wo, H);
+        const glm::vec3 wi_refract = glm::refract(-wo, H, eta_wo2wi);
+
+        const bool tir = glm::dot(wi_refract, wi_refract) <= 1e-12f;
+        const float xi = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_LOBE);
+
+        if (tir || xi < Fg)
+        {
+            if (glm::dot(Ns, wi_reflect) <= 0.0f)
+                return result;
+            result.wi = wi_reflect;
+        }
+        else
+        {
+            if (glm::dot(Ns, wi_refract) * glm::dot(Ns, wo) >= 0.0f)
+                return result;
+            result.wi = wi_refract;
+        }
+
+        result.cosTheta = AbsDot(Ns, result.wi);
+        return result;
+    }
+
+    KH_BSDFSample SampleBSDF(glm::vec3 wo, glm::vec3 Ns, bool bIsInside, bool bEnableVNDF, const KH_BSDFMaterial& Mat, KH_Sampler& Sampler)
+    {
+        const float p_glass = ComputeGlassProbability(Mat);
+
+        const float xi = Sampler.SampleBounceDimension(SOBOL_DIM_BSDF_SELECT);
+
+        KH_BSDFSample result = xi < p_glass
+            ? SampleBSDF_Glass(wo, Ns, bIsInside, bEnableVNDF, Mat, Sampler)
+            : SampleBRDF(wo, Ns, Mat, Sampler);
+
+        result.p_glass = p_glass;
+        if (glm::dot(result.wi, result.wi) <= 0.0f)
+            return result;
+
+        result.cosTheta = std::abs(glm::dot(Ns, result.wi));
+        result.PDF = std::max(BSDF_PDF_Eval(result.wi, wo, Ns, p_glass, bIsInside, Mat), 1e-8f);
+        return result;
+    }
+
+    float PowerHeuristic(float a, float b)
+    {
+        const float a2 = a * a;
+        const float b2 = b * b;
+        const float s = a2 + b2;
+        return (s > 1e-20f) ? (a2 / s) : 0.0f;
+    }
+
+    // ---------------- 环境光，对应 uSkybox（双线性、clamp to edge）与 uHDRCache ----------------
+    glm::vec3 FetchEnvironment(const KH_Environment& Env, int x, int y)
+    {
+        const size_t index = (static_cast<size_t>(y) * Env.Width + x) * Env.Channels;
+        return glm::vec3(Env.Pixels[index], Env.Pixels[index + 1], Env.Pixels[index + 2]);
+    }
+
+    glm::vec3 SampleEnvironment(const KH_Environment& Env, glm::vec2 uv)
+    {
+        const float fx = uv.x * static_cast<float>(Env.Width) - 0.5f;
+        const float fy = uv.y * static_cast<float>(Env.Height) - 0.5f;
+        const float x0f = std::floor(fx);
+        const float y0f = std::floor(fy);
+        const float tx = fx - x0f;
+        const float ty = fy - y0f;
+
+        const int x0 = glm::clamp(static_cast<int>(x0f), 0, Env.Width - 1);
+        const int y0 = glm::clamp(static_cast<int>(y0f), 0, Env.Height - 1);
+        const int x1 = glm::clamp(static_cast<int>(x0f) + 1, 0, Env.Width - 1);
+        const int y1 = glm::clamp(static_cast<int>(y0f) + 1, 0, Env.Height - 1);
+
+        const glm::vec3 bottom = glm::mix(FetchEnvironment(Env, x0, y0), FetchEnvironment(Env, x1, y0), tx);
+        const glm::vec3 top = glm::mix(FetchEnvironment(Env, x0, y1), FetchEnvironment(Env, x1, y1), tx);
+        return glm::mix(bottom, top, ty);
+    }
+
+    const glm::vec4& FetchHDRCacheTexel(const KH_Environment& Env, int x, int y)
+    {
+        return Env.ImportanceTable[static_cast<size_t>(y) * Env.Width + x];
+    }
+
+    // SampleSphericalMap 的逆映射
+    glm::vec3 EnvUVToDirection(glm::vec2 uv)
+    {
+        const float phi = 2.0f * Pi * (uv.x - 0.5f);
+        const float elev = Pi * (uv.y - 0.5f);
+
+        const float cosElev = std::cos(elev);
+        return glm::normalize(glm::vec3(cosElev * std::cos(phi), std::sin(elev), cosElev * std::sin(phi)));
+    }
+
+    // uv 空间的 pdf 换算到立体角
+    float EnvUVPdfToSolidAngle(float pdfUV, float v)
+    {
+        const float elev = Pi * (v - 0.5f);
+        const float sinThetaPolar = std::max(std::cos(elev), 1e-6f);
+
+        return pdfUV / (2.0f * Pi * Pi * sinThetaPolar);
+    }
+
+    float EnvPdf_Eval(const KH_Environment& Env, glm::vec3 wi)
+    {
+        const glm::vec2 uv = SampleSphericalMap(glm::normalize(wi));
+        const int px = std::min(static_cast<int>(uv.x * static_cast<float>(Env.Width)), Env.Width - 1);
+        const int py = std::min(static_cast<int>(uv.y * static_cast<float>(Env.Height)), Env.Height - 1);
+        // .z 为本 texel 的 pdf，.w 是 alias 的 pdf
+        const float pdfUV = FetchHDRCacheTexel(Env, std::max(px, 0), std::max(py, 0)).z;
+
+        return EnvUVPdfToSolidAngle(pdfUV, uv.y);
+    }
+
+    // 2D alias 表采样，布局见 KH_Texture.cpp BuildEnvAliasTable；返回 (u, v, pdf(u, v))
+    glm::vec3 FetchHDRCache(const KH_Environment& Env, float xi1, float xi2)
+    {
+        const float fv = xi2 * static_cast<float>(Env.Height);
+        int v = std::min(static_cast<int>(fv), Env.Height - 1);
+        float rv = fv - static_cast<float>(v);
+
+        const glm::vec4& marginal = FetchHDRCacheTexel(Env, v % Env.Width, Env.Height + v / Env.Width);
+        if (rv < marginal.x)
+        {
+            rv = rv / marginal.x;
+        }
+        else
+        {
+            v = static_cast<int>(marginal.y);
+            rv = (rv - marginal.x) / std::max(1.0f - marginal.x, 1e-6f);
+        }
+
+        const float fu = xi1 * static_cast<float>(Env.Width);
+        int u = std::min(static_cast<int>(fu), Env.Width - 1);
+        float ru = fu - static_cast<float>(u);
+
+        const glm::vec4& conditional = FetchHDRCacheTexel(Env, u, v);
+        float pdfUV = conditional.z;
+        if (ru < conditional.x)
+        {
+            ru = ru / conditional.x;
+        }
+        else
+        {
+            u = static_cast<int>(conditional.y);
+            ru = (ru - conditional.x) / std::max(1.0f - conditional.x, 1e-6f);
+            pdfUV = conditional.w;
+        }
+
+        const glm::vec2 uv = (glm::vec2(u, v) + glm::clamp(glm::vec2(ru, rv), 0.0f, 0.99999f))
+            / glm::vec2(Env.Width, Env.Height);
+        return glm::vec3(uv, pdfUV);
+    }
+
+    // 采样返回的 pdf 必须与 EnvPdf_Eval 对同一方向给出的 pdf 一致，否则 MIS 权重有偏。
+    // 抖动后的 uv 贴近 texel 边界时，方向往返可能落进相邻 texel，允许少量不一致
+    bool CheckEnvPdfConsistency(const KH_Environment& Env)
+    {
+        constexpr int GridSize = 64;
+        constexpr float Tolerance = 1e-3f;
+
+        int mismatches = 0;
+        float maxError = 0.0f;
+        for (int j = 0; j < GridSize; ++j)
+        {
+            for (int i = 0; i < GridSize; ++i)
+            {
+                const float xi1 = (static_cast<float>(i) + 0.5f) / GridSize;
+                const float xi2 = (static_cast<float>(j) + 0.5f) / GridSize;
+
+                const glm::vec3 values = FetchHDRCache(Env, xi1, xi2);
+                const glm::vec2 uv(values.x, values.y);
+
+                const float pdfSample = EnvUVPdfToSolidAngle(values.z, uv.y);
+                const float pdfEval = EnvPdf_Eval(Env, EnvUVToDirection(uv));
+
+                const float error = std::abs(pdfSample - pdfEval) / std::max(pdfSample, 1e-6f);
+                maxError = std::max(maxError, error);
+                if (error > Tolerance)
+                    ++mismatches;
+            }
+        }
+
+        if (mismatches * 100 > GridSize * GridSize)
+        {
+            LOG_W(std::format("CPU path tracer: environment sample pdf disagrees with EnvPdf_Eval for {}/{} directions (max relative error {:.3g})",
+                mismatches, GridSize * GridSize, maxError));
+            return false;
+        }
+        return true;
+    }
+
+    // ---------------- 求交 ----------------
+    struct KH_CpuRay
+    {
+        glm::vec3 Start;
+        glm::vec3 Direction;
+    };
+
+    struct KH_CpuHit
+    {
+        bool bIsHit = false;
+        bool bIsInside = false;
+        float Distance = INF;
+        glm::vec3 HitPoint = glm::vec3(0.0f);
+        glm::vec3 GeoNormal = glm::vec3(0.0f);
+        glm::vec3 ShadeNormal = glm::vec3(0.0f);
+        int MaterialSlot = -1;
+    };
+
+    bool IntersectTriangle(const KH_Triangle& Tri, const KH_CpuRay& ray, float tMax, float& t, float& u, float& v)
+    {
+        const glm::vec3 pvec = glm::cross(ray.Direction, Tri.Edge2);
+        const float det = glm::dot(Tri.Edge1, pvec);
+
+        if (std::abs(det) < HitEPS) return false;
+
+        const float invDet = 1.0f / det;
+
+        const glm::vec3 tvec = ray.Start - Tri.P1;
+        u = glm::dot(tvec, pvec) * invDet;
+        if (u < 0.0f || u > 1.0f) return false;
+
+        const glm::vec3 qvec = glm::cross(tvec, Tri.Edge1);
+        v = glm::dot(ray.Direction, qvec) * invDet;
+        if (v < 0.0f || u + v > 1.0f) return false;
+
+        t = glm::dot(Tri.Edge2, qvec) * invDet;
+        return t >= HitEPS && t < tMax;
+    }
+
+    float HitAABB(const KH_Node& Node, const KH_CpuRay& ray, glm::vec3 invDir, float tMax)
+    {
+        const glm::vec3 t0 = (Node.MinPos - ray.Start) * invDir;
+        const glm::vec3 t1 = (Node.MaxPos - ray.Start) * invDir;
+
+        const float tNear = std::max(glm::compMax(glm::min(t0, t1)), 0.0f);
+        const float tFar = glm::compMin(glm::max(t0, t1));
+
+        return (tNear <= tFar && tNear < tMax) ? tNear : INF;
+    }
+
+    // 最近交点；bAnyHit 时找到任一交点即返回，用于阴影射线
+    int TraverseBVH(const std::vector<KH_Node>& Nodes, const std::vector<KH_Triangle>& Triangles,
+        const KH_CpuRay& ray, bool bAnyHit, float tMax, float& tHit, float& uHit, float& vHit)
+    {
+        tHit = tMax;
+        if (Nodes.empty())
+            return -1;
+
+        const glm::vec3 invDir = 1.0f / ray.Direction;
+
+        int stack[TraversalStackSize];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        int best = -1;
+        while (stackSize > 0)
+        {
+            const KH_Node& Node = Nodes[stack[--stackSize]];
+            if (HitAABB(Node, ray, invDir, tHit) >= INF)
+                continue;
+
+            if (Node.Count > 0)
+            {
+                for (int i = Node.LeftOrFirst; i < Node.LeftOrFirst + Node.Count; i++)
+                {
+                    float t, u, v;
+                    if (!IntersectTriangle(Triangles[i], ray, tHit, t, u, v))
+                        continue;
+
+                    tHit = t;
+                    uHit = u;
+                    vHit = v;
+                    best = i;
+                    if (bAnyHit)
+                        return best;
+                }
+                continue;
+            }
+
+            // 先压远处的孩子，近处的先出栈
+            int nearChild = Node.LeftOrFirst;
+            int farChild = Node.LeftOrFirst + 1;
+            float nearT = HitAABB(Nodes[nearChild], ray, invDir, tHit);
+            float farT = HitAABB(Nodes[farChild], ray, invDir, tHit);
+            if (farT < nearT)
+            {
+                std::swap(nearChild, farChild);
+                std::swap(nearT, farT);
+            }
+
+            if (farT < INF && stackSize < TraversalStackSize)
+                stack[stackSize++] = farChild;
+            if (nearT < INF && stackSize < TraversalStackSize)
+                stack[stackSize++] = nearChild;
+        }
+
+        return best;
+    }
+
+    // ---------------- SAH 分箱 BVH ----------------
+    struct KH_BuildPrimitive
+    {
+        glm::vec3 MinPos;
+        glm::vec3 MaxPos;
+        glm::vec3 Centroid;
+    };
+
+    struct KH_BVHBuilder
+    {
+        std::vector<KH_Node>& Nodes;
+        std::vector<KH_BuildPrimitive> Primitives;
+        std::vector<uint32_t> Indices;
+
+        void Build(uint32_t nodeIndex, uint32_t begin, uint32_t end, uint32_t depth)
+        {
+            glm::vec3 boundsMin(std::numeric_limits<float>::max());
+            glm::vec3 boundsMax(-std::numeric_limits<float>::max());
+            glm::vec3 centroidMin = boundsMin;
+            glm::vec3 centroidMax = boundsMax;
+
+            for (uint32_t i = begin; i < end; i++)
+            {
+                const KH_BuildPrimitive& prim = Primitives[Indices[i]];
+                boundsMin = glm::min(boundsMin, prim.MinPos);
+                boundsMax = glm::max(boundsMax, prim.MaxPos);
+                centroidMin = glm::min(centroidMin, prim.Centroid);
+                centroidMax = glm::max(centroidMax, prim.Centroid);
+            }
+
+            Nodes[nodeIndex].MinPos = boundsMin;
+            Nodes[nodeIndex].MaxPos = boundsMax;
+
+            const uint32_t count = end - begin;
+            const auto MakeLeaf = [&]()
+            {
+                Nodes[nodeIndex].LeftOrFirst = static_cast<int>(begin);
+                Nodes[nodeIndex].Count = static_cast<int>(count);
+            };
+
+            if (count <= MaxLeafTriangles || depth >= MaxBVHDepth)
+            {
+                MakeLeaf();
+                return;
+            }
+
+            int bestAxis = -1;
+            uint32_t bestSplit = 0;
+            float bestCost = std::numeric_limits<float>::max();
+            const glm::vec3 centroidExtent = centroidMax - centroidMin;
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                if (centroidExtent[axis] <= 0.0f)
+                    continue;
+
+                std::array<uint32_t, SAHBinCount> binCounts{};
+                std::array<glm::vec3, SAHBinCount> binMin;
+                std::array<glm::vec3, SAHBinCount> binMax;
+                binMin.fill(glm::vec3(std::numeric_limits<float>::max()));
+                binMax.fill(glm::vec3(-std::numeric_limits<float>::max()));
+
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    const KH_BuildPrimitive& prim = Primitives[Indices[i]];
+                    const uint32_t bin = BinIndex(prim.Centroid[axis], centroidMin[axis], centroidExtent[axis]);
+                    binCounts[bin]++;
+                    binMin[bin] = glm::min(binMin[bin], prim.MinPos);
+                    binMax[bin] = glm::max(binMax[bin], prim.MaxPos);
+                }
+
+                // 从右向左累积右侧代价，再从左向右扫描
+                std::array<float, SAHBinCount> rightCost{};
+                glm::vec3 accMin(std::numeric_limits<float>::max());
+                glm::vec3 accMax(-std::numeric_limits<float>::max());
+                uint32_t accCount = 0;
+                for (uint32_t b = SAHBinCount - 1; b > 0; b--)
+                {
+                    accCount += binCounts[b];
+                    accMin = glm::min(accMin, binMin[b]);
+                    accMax = glm::max(accMax, binMax[b]);
+                    rightCost[b] = accCount > 0 ? accCount * KH_AABB::ComputeSurfaceArea(accMin, accMax) : 0.0f;
+                }
+
+                accMin = glm::vec3(std::numeric_limits<float>::max());
+                accMax = glm::vec3(-std::numeric_limits<float>::max());
+                accCount = 0;
+                for (uint32_t b = 0; b + 1 < SAHBinCount; b++)
+                {
+                    accCount += binCounts[b];
+                    accMin = glm::min(accMin, binMin[b]);
+                    accMax = glm::max(accMax, binMax[b]);
+
+                    if (accCount == 0 || accCount == count)
+                        continue;
+
+                    const float cost = accCount * KH_AABB::ComputeSurfaceArea(accMin, accMax) + rightCost[b + 1];
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = b;
+                    }
+                }
+            }
+
+            // 所有质心重合，无法划分
+            if (bestAxis < 0)
+            {
+                MakeLeaf();
+                return;
+            }
+
+            const float leafCost = count * KH_AABB::ComputeSurfaceArea(boundsMin, boundsMax);
+            if (bestCost >= leafCost && count <= 4 * MaxLeafTriangles)
+            {
+                MakeLeaf();
+                return;
+            }
+
+            const auto midIt = std::partition(Indices.begin() + begin, Indices.begin() + end, [&](uint32_t index)
+            {
+                return BinIndex(Primitives[index].Centroid[bestAxis], centroidMin[bestAxis], centroidExtent[bestAxis]) <= bestSplit;
+            });
+            const uint32_t mid = static_cast<uint32_t>(midIt - Indices.begin());
+
+            const uint32_t left = static_cast<uint32_t>(Nodes.size());
+            Nodes.emplace_back();
+            Nodes.emplace_back();
+            Nodes[nodeIndex].LeftOrFirst = static_cast<int>(left);
+            Nodes[nodeIndex].Count = 0;
+
+            Build(left, begin, mid, depth + 1);
+            Build(left + 1, mid, end, depth + 1);
+        }
+
+        static uint32_t BinIndex(float centroid, float minPos, float extent)
+        {
+            const uint32_t bin = static_cast<uint32_t>(SAHBinCount * ((centroid - minPos) / extent));
+            return std::min(bin, SAHBinCount - 1);
+        }
+    };
+
+    // ---------------- 路径积分，对应 SampleHDR / PathTracing ----------------
+    struct KH_PathIntegrator
+    {
+        const std::vector<KH_Triangle>& Triangles;
+        const std::vector<KH_Node>& Nodes;
+        const std::vector<KH_BSDFMaterial>& Materials;
+        const KH_Environment& Env;
+        const KH_CpuRenderSettings& Settings;
+
+        KH_BSDFMaterial FallbackMaterial;
+
+        const KH_BSDFMaterial& DecodeBSDFMaterial(int MaterialSlotID) const
+        {
+            if (MaterialSlotID < 0 || MaterialSlotID >= static_cast<int>(Materials.size()))
+                return FallbackMaterial;
+            return Materials[MaterialSlotID];
+        }
+
+        KH_CpuHit HitBVH(const KH_CpuRay& ray) const
+        {
+            KH_CpuHit hit_result;
+
+            float t, u, v;
+            const int index = TraverseBVH(Nodes, Triangles, ray, false, INF, t, u, v);
+            if (index < 0)
+                return hit_result;
+
+            const KH_Triangle& Tri = Triangles[index];
+
+            hit_result.bIsHit = true;
+            hit_result.Distance = t;
+            hit_result.HitPoint = ray.Start + t * ray.Direction;
+            hit_result.MaterialSlot = Tri.MaterialSlot;
+
+            const float w1 = 1.0f - u - v;
+            glm::vec3 Ns = glm::normalize(w1 * Tri.N1 + u * Tri.N2 + v * Tri.N3);
+            glm::vec3 Ng = Tri.Ng;
+
+            if (glm::dot(Ng, ray.Direction) > 0.0f)
+            {
+                hit_result.bIsInside = true;
+                Ng = -Ng;
+            }
+
+            if (glm::dot(Ns, Ng) < 0.0f)
+                Ns = -Ns;
+
+            hit_result.GeoNormal = Ng;
+            hit_result.ShadeNormal = Ns;
+            return hit_result;
+        }
+
+        bool IsOccluded(const KH_CpuRay& ray) const
+        {
+            float t, u, v;
+            return TraverseBVH(Nodes, Triangles, ray, true, INF, t, u, v) >= 0;
+        }
+
+        glm::vec3 SampleHDR(float xi_env1, float xi_env2, glm::vec3 V, float p_glass, const KH_CpuHit& hit_result,
+            std::vector<KH_CapturedRay>* capturedRays) const
+        {
+            const glm::vec3 values = FetchHDRCache(Env, xi_env1, xi_env2);
+
+            const glm::vec2 uv(values.x, values.y);
+            const float pdfUV = values.z;
+
+            const glm::vec3 wi = EnvUVToDirection(uv);
+
+            const glm::vec3 Ng = glm::normalize(hit_result.GeoNormal);
+            const glm::vec3 Ns = glm::normalize(hit_result.ShadeNormal);
+
+            const float cosTheta = AbsDot(Ns, wi);
+            if (cosTheta <= 1e-6f)
+                return glm::vec3(0.0f);
+
+            const KH_CpuRay shadowRay{ hit_result.HitPoint + glm::sign(glm::dot(wi, Ng)) * Ng * 1e-4f, wi };
+            if (capturedRays)
+                capturedRays->emplace_back(shadowRay.Start, shadowRay.Direction, INF, KH_CapturedRayType::Shadow);
+            if (IsOccluded(shadowRay))
+                return glm::vec3(0.0f);
+
+            const glm::vec3 envColor = SampleEnvironment(Env, uv);
+
+            const float pdfEnv = EnvUVPdfToSolidAngle(pdfUV, uv.y);
+
+            const KH_BSDFMaterial& Mat = DecodeBSDFMaterial(hit_result.MaterialSlot);
+            const float pdfBSDF = std::max(BSDF_PDF_Eval(wi, V, Ns, p_glass, hit_result.bIsInside, Mat), 1e-8f);
+
+            const float weight = PowerHeuristic(pdfEnv, pdfBSDF);
+
+            return weight * envColor
+                 * BSDF(wi, V, Ns, Ng, p_glass, hit_result.bIsInside, Mat)
+                 * cosTheta
+                 / std::max(pdfEnv, 1e-6f);
+        }
+
+        // capturedRays 非空时记录本条路径追踪的所有光线
+        glm::vec3 PathTracing(KH_CpuRay ray, KH_Sampler& Sampler, std::vector<KH_CapturedRay>* capturedRays = nullptr) const
+        {
+            glm::vec3 finalColor(0.0f);
+            glm::vec3 throughput(1.0f);
+            float pdf_bsdf = 0.0f;
+
+            for (uint32_t bounce = 0; bounce < Settings.MaxBounce; bounce++)
+            {
+                Sampler.BounceDimension = SOBOL_DIM_BOUNCE_BASE + bounce * SOBOL_DIMS_PER_BOUNCE;
+
+                if (capturedRays)
+                {
+                    capturedRays->emplace_back(ray.Start, ray.Direction, INF,
+                        bounce == 0 ? KH_CapturedRayType::Primary : KH_CapturedRayType::Bounce);
+                }
+
+                const KH_CpuHit hit_result = HitBVH(ray);
+                const glm::vec3 V = -ray.Direction;
+
+                if (!hit_result.bIsHit)
+                {
+                    if (Settings.bEnableSkybox)
+                    {
+                        const glm::vec3 skyColor = SampleEnvironment(Env, SampleSphericalMap(glm::normalize(ray.Direction)));
+                        if (bounce == 0)
+                        {
+                            finalColor += throughput * skyColor;
+                        }
+                        else
+                        {
+                            const float weight = PowerHeuristic(pdf_bsdf, EnvPdf_Eval(Env, ray.Direction));
+                            finalColor += weight * throughput * skyColor;
+                        }
+                    }
+                    else
+                    {
+                        finalColor += throughput * SkyColor;
+                    }
+                    break;
+                }
+
+                const float xi_env1 = Sampler.SampleBounceDimension(SOBOL_DIM_ENV_NEE);
+                const float xi_env2 = Sampler.SampleBounceDimension(SOBOL_DIM_ENV_NEE + 1u);
+
+                const glm::vec3 Ng = glm::normalize(hit_result.GeoNormal);
+                const glm::vec3 Ns = glm::normalize(hit_result.ShadeNormal);
+
+                const KH_BSDFMaterial& Mat = DecodeBSDFMaterial(hit_result.MaterialSlot);
+                const float p_glass = ComputeGlassProbability(Mat);
+
+                finalColor += throughput * Mat.Emissive;
+
+                const KH_BSDFSample sample_result = SampleBSDF(V, Ns, hit_result.bIsInside, Settings.bEnableVNDF, Mat, Sampler);
+
+                if (Settings.bEnableSkybox)
+                {
+                    finalColor += throughput * SampleHDR(xi_env1, xi_env2, V, p_glass, hit_result, capturedRays);
+                }
+
+                if (sample_result.cosTheta <= 0.0f || sample_result.PDF <= 1e-8f)
+                    break;
+
+                pdf_bsdf = sample_result.PDF;
+
+                throughput *= BSDF(sample_result.wi, V, Ns, Ng, sample_result.p_glass, hit_result.bIsInside, Mat)
+                    * sample_result.cosTheta / sample_result.PDF;
+
+                ray.Start = hit_result.HitPoint + glm::sign(glm::dot(sample_result.wi, Ng)) * Ng * 1e-4f;
+                ray.Direction = sample_result.wi;
+
+                if (bounce >= 3)
+                {
+                    const float p = glm::clamp(glm::compMax(throughput), 0.05f, 0.95f);
+                    if (Sampler.SampleBounceDimension(SOBOL_DIM_RR) > p)
+                        break;
+                    throughput /= p;
+                }
+            }
+
+            return finalColor;
+        }
+    };
+}
+
+bool KH_CpuPathTracer::KH_Environment::IsValid() const
+{
+    return Width > 0 && Height > 0 && Channels >= 3 &&
+        Pixels.size() >= static_cast<size_t>(Width) * Height * Channels &&
+        !ImportanceTable.empty();
+}
+
+bool KH_CpuPathTracer::Prepare(const KH_SceneBase& scene, const KH_Camera& camera, const KH_CpuRenderSettings& settings)
+{
+    bPrepared = false;
+
+    if (settings.Width == 0 || settings.Height == 0 || settings.SamplesPerPixel == 0)
+    {
+        LOG_E("CPU path tracer: render extent and sample count must be non-zero");
+        return false;
+    }
+
+    const KH_DisneyBSDF* Feature = scene.GetShaderFeatureAs<KH_DisneyBSDF>(KH_ShaderFeatureType::DisneyBSDF);
+    if (!Feature)
+    {
+        LOG_E("CPU path tracer: scene has no DisneyBSDF shader feature");
+        return false;
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    Settings = settings;
+    Settings.TileSize = std::max(Settings.TileSize, 1u);
+    Stats = KH_CpuRenderStats();
+
+    Materials = Feature->GetMaterials();
+
+    std::vector<KH_PrimitiveEncoded> Encoded;
+    scene.EncodePrimitivesTo(Encoded, KH_ShaderFeatureType::DisneyBSDF);
+
+    Triangles.clear();
+    Triangles.reserve(Encoded.size());
+    for (const KH_PrimitiveEncoded& Primitive : Encoded)
+    {
+        if (Primitive.PrimitiveType.x != static_cast<int>(KH_PrimitiveType::Triangle))
+            continue;
+
+        KH_Triangle& Tri = Triangles.emplace_back();
+        Tri.P1 = glm::vec3(Primitive.Triangle.P1);
+        Tri.Edge1 = glm::vec3(Primitive.Triangle.P2) - Tri.P1;
+        Tri.Edge2 = glm::vec3(Primitive.Triangle.P3) - Tri.P1;
+        Tri.Ng = glm::normalize(glm::cross(Tri.Edge1, Tri.Edge2));
+        Tri.N1 = glm::vec3(Primitive.Triangle.N1);
+        Tri.N2 = glm::vec3(Primitive.Triangle.N2);
+        Tri.N3 = glm::vec3(Primitive.Triangle.N3);
+        Tri.MaterialSlot = Primitive.MaterialSlotID.x;
+    }
+
+    BuildBVH();
+
+    CameraPosition = camera.Position;
+    CameraRight = camera.Right;
+    CameraUp = camera.Up;
+    CameraFront = camera.Front;
+    CameraAspect = camera.Aspect;
+    CameraFovy = camera.Fovy;
+
+    if (Settings.bEnableSkybox && !LoadEnvironment(Settings.SkyboxPath))
+    {
+        LOG_W("CPU path tracer: skybox unavailable, falling back to SkyColor");
+        Settings.bEnableSkybox = false;
+    }
+
+    const uint32_t TilesX = (Settings.Width + Settings.TileSize - 1) / Settings.TileSize;
+    const uint32_t TilesY = (Settings.Height + Settings.TileSize - 1) / Settings.TileSize;
+    TotalTiles = TilesX * TilesY;
+    CompletedTiles = 0;
+    bCancelRequested = false;
+
+    Stats.TriangleCount = static_cast<uint32_t>(Triangles.size());
+    Stats.BVHNodeCount = static_cast<uint32_t>(Nodes.size());
+    Stats.PrepareMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    LOG_D(std::format("CPU path tracer prepared {} triangles, {} BVH nodes in {:.1f} ms",
+        Stats.TriangleCount, Stats.BVHNodeCount, Stats.PrepareMilliseconds));
+
+    bPrepared = true;
+    return true;
+}
+
+bool KH_CpuPathTracer::Render(std::vector<glm::vec4>& outPixels)
+{
+    if (!bPrepared)
+    {
+        LOG_E("CPU path tracer: Render called before Prepare");
+        return false;
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    const uint32_t Width = Settings.Width;
+    const uint32_t Height = Settings.Height;
+    const uint32_t TileSize = Settings.TileSize;
+    const uint32_t TilesX = (Width + TileSize - 1) / TileSize;
+
+    outPixels.assign(static_cast<size_t>(Width) * Height, glm::vec4(0.0f));
+
+    const KH_PathIntegrator Integrator{ Triangles, Nodes, Materials, Environment, Settings };
+
+    const float scale = std::tan(glm::radians(CameraFovy) * 0.5f);
+    const glm::vec2 pixelSize = 2.0f / glm::vec2(Width, Height);
+
+    std::atomic<uint32_t> InvalidSamples = 0;
+
+    // 按 tile 分别收集，拼接后的光线顺序与调度无关
+    const bool bCaptureRays = !Settings.RayCapturePath.empty();
+    std::vector<std::vector<KH_CapturedRay>> TileRays(bCaptureRays ? TotalTiles : 0);
+
+    // 以 tile 为单位动态调度，相邻像素共享 BVH 缓存
+    KH_JobSystem::Instance().ParallelFor(0, TotalTiles, 1, [&](uint32_t tile)
+    {
+        if (bCancelRequested.load(std::memory_order_relaxed))
+            return;
+
+        const uint32_t x0 = (static_cast<uint32_t>(tile) % TilesX) * TileSize;
+        const uint32_t y0 = (static_cast<uint32_t>(tile) / TilesX) * TileSize;
+        const uint32_t x1 = std::min(x0 + TileSize, Width);
+        const uint32_t y1 = std::min(y0 + TileSize, Height);
+
+        KH_Sampler Sampler;
+        uint32_t TileInvalid = 0;
+        std::vector<KH_CapturedRay>* CapturedRays = bCaptureRays ? &TileRays[tile] : nullptr;
+
+        for (uint32_t y = y0; y < y1; y++)
+        {
+            for (uint32_t x = x0; x < x1; x++)
+            {
+                const glm::vec2 CanvasPos = (glm::vec2(x, y) + 0.5f) * pixelSize - 1.0f;
+
+                glm::vec3 Sum(0.0f);
+                uint32_t ValidSamples = 0;
+
+                for (uint32_t s = 0; s < Settings.SamplesPerPixel; s++)
+                {
+                    Sampler.Begin(x, y, s, Settings.bEnableSobol);
+
+                    // 对应 GetRayDirection 的像素内抖动
+                    glm::vec2 uv = CanvasPos;
+                    if (Settings.bEnableSobol)
+                        uv += pixelSize * (glm::vec2(Sampler.SobolOwen(SOBOL_DIM_CAMERA_JITTER), Sampler.SobolOwen(SOBOL_DIM_CAMERA_JITTER + 1u)) - 0.5f);
+                    else
+                        uv += pixelSize * (Sampler.Rand() - 0.5f);
+
+                    const glm::vec3 Direction = glm::normalize(
+                        (uv.x * CameraAspect * scale) * CameraRight +
+                        (uv.y * scale) * CameraUp +
+                        CameraFront);
+
+                    const glm::vec3 Radiance = Integrator.PathTracing(KH_CpuRay{ CameraPosition, Direction }, Sampler,
+                        s < Settings.RayCaptureSamples ? CapturedRays : nullptr);
+
+                    // 丢弃 NaN / Inf，避免单个样本污染整张参考图
+                    if (glm::any(glm::isnan(Radiance)) || glm::any(glm::isinf(Radiance)))
+                    {
+                        TileInvalid++;
+                        continue;
+                    }
+
+                    Sum += Radiance;
+                    ValidSamples++;
+                }
+
+                const glm::vec3 Mean = ValidSamples > 0 ? Sum / static_cast<float>(ValidSamples) : glm::vec3(0.0f);
+                outPixels[static_cast<size_t>(y) * Width + x] = glm::vec4(Mean, static_cast<float>(ValidSamples));
+            }
+        }
+
+        if (TileInvalid > 0)
+            InvalidSamples.fetch_add(TileInvalid, std::memory_order_relaxed);
+        CompletedTiles.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    // 调用线程也参与领取 tile
+    Stats.ThreadCount = static_cast<int>(KH_JobSystem::Instance().GetWorkerCount()) + 1;
+    Stats.InvalidSamples = InvalidSamples.load();
+    Stats.RenderMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    if (bCancelRequested.load())
+    {
+        LOG_W("CPU path tracer: render cancelled");
+        return false;
+    }
+
+    LOG_D(std::format("CPU path tracer rendered {}x{} @ {} spp on {} threads in {:.1f} ms ({} invalid samples)",
+        Width, Height, Settings.SamplesPerPixel, Stats.ThreadCount, Stats.RenderMilliseconds, Stats.InvalidSamples));
+
+    if (bCaptureRays && !SaveCapturedRays(TileRays))
+        return false;
+
+    return true;
+}
+
+void KH_CpuPathTracer::Cancel()
+{
+    bCancelRequested = true;
+}
+
+float KH_CpuPathTracer::GetProgress() const
+{
+    if (TotalTiles == 0)
+        return 0.0f;
+    return static_cast<float>(CompletedTiles.load(std::memory_order_relaxed)) / static_cast<float>(TotalTiles);
+}
+
+bool KH_CpuPathTracer::IsPrepared() const
+{
+    return bPrepared;
+}
+
+const KH_CpuRenderSettings& KH_CpuPathTracer::GetSettings() const
+{
+    return Settings;
+}
+
+const KH_CpuRenderStats& KH_CpuPathTracer::GetStats() const
+{
+    return Stats;
+}
+
+void KH_CpuPathTracer::PrepareGeometry(const std::vector<glm::vec3>& positions)
+{
+    Triangles.clear();
+    Triangles.reserve(positions.size() / 3);
+    for (size_t i = 0; i + 2 < positions.size(); i += 3)
+    {
+        KH_Triangle& Tri = Triangles.emplace_back();
+        Tri.P1 = positions[i];
+        Tri.Edge1 = positions[i + 1] - Tri.P1;
+        Tri.Edge2 = positions[i + 2] - Tri.P1;
+        Tri.Ng = glm::normalize(glm::cross(Tri.Edge1, Tri.Edge2));
+        Tri.N1 = Tri.N2 = Tri.N3 = Tri.Ng;
+    }
+
+    BuildBVH();
+
+    Stats.TriangleCount = static_cast<uint32_t>(Triangles.size());
+    Stats.BVHNodeCount = static_cast<uint32_t>(Nodes.size());
+}
+
+bool KH_CpuPathTracer::IntersectClosest(const glm::vec3& start, const glm::vec3& direction, float tMax, float& outDistance) const
+{
+    float u, v;
+    return TraverseBVH(Nodes, Triangles, KH_CpuRay{ start, direction }, false, tMax, outDistance, u, v) >= 0;
+}
+
+bool KH_CpuPathTracer::IntersectAny(const glm::vec3& start, const glm::vec3& direction, float tMax) const
+{
+    float t, u, v;
+    return TraverseBVH(Nodes, Triangles, KH_CpuRay{ start, direction }, true, tMax, t, u, v) >= 0;
+}
+
+bool KH_CpuPathTracer::LoadEnvironment(const std::string& path)
+{
+    if (Environment.IsValid() && Environment.FileName == path)
+        return true;
+
+    // 与编辑器使用相同的翻转设置，alias 表可直接命中磁盘缓存
+    KH_HDRImage Image = KH_TextureManager::Instance().DecodeHDR(path, true);
+    if (!Image.IsValid() || Image.Pixels.empty())
+    {
+        Environment = KH_Environment();
+        return false;
+    }
+
+    Environment.FileName = path;
+    Environment.Width = Image.Width;
+    Environment.Height = Image.Height;
+    Environment.Channels = Image.Channels;
+    Environment.Pixels = std::move(Image.Pixels);
+    Environment.ImportanceTable = std::move(Image.ImportanceTable);
+    if (!Environment.IsValid())
+        return false;
+
+    CheckEnvPdfConsistency(Environment);
+    return true;
+}
+
+void KH_CpuPathTracer::BuildBVH()
+{
+    Nodes.clear();
+    if (Triangles.empty())
+        return;
+
+    KH_BVHBuilder Builder{ Nodes };
+    Builder.Primitives.resize(Triangles.size());
+    Builder.Indices.resize(Triangles.size());
+
+    for (size_t i = 0; i < Triangles.size(); i++)
+    {
+        const KH_Triangle& Tri = Triangles[i];
+        const glm::vec3 P2 = Tri.P1 + Tri.Edge1;
+        const glm::vec3 P3 = Tri.P1 + Tri.Edge2;
+
+        KH_BuildPrimitive& Prim = Builder.Primitives[i];
+        Prim.MinPos = glm::min(Tri.P1, glm::min(P2, P3));
+        Prim.MaxPos = glm::max(Tri.P1, glm::max(P2, P3));
+        Prim.Centroid = 0.5f * (Prim.MinPos + Prim.MaxPos);
+        Builder.Indices[i] = static_cast<uint32_t>(i);
+    }
+
+    Nodes.reserve(2 * Triangles.size());
+    Nodes.emplace_back();
+    Builder.Build(0, 0, static_cast<uint32_t>(Triangles.size()), 0);
+
+    // 按叶节点顺序重排三角形，叶内连续访问
+    std::vector<KH_Triangle> Sorted;
+    Sorted.reserve(Triangles.size());
+    for (uint32_t index : Builder.Indices)
+        Sorted.push_back(Triangles[index]);
+    Triangles = std::move(Sorted);
+}
+
+bool KH_CpuPathTracer::SaveCapturedRays(std::vector<std::vector<KH_CapturedRay>>& tileRays) const
+{
+    KH_RaySet RaySet;
+    RaySet.SceneName = Settings.RayCaptureSceneName;
+
+    RaySet.TrianglePositions.reserve(Triangles.size() * 3);
+    for (const KH_Triangle& Tri : Triangles)
+    {
+        RaySet.TrianglePositions.push_back(Tri.P1);
+        RaySet.TrianglePositions.push_back(Tri.P1 + Tri.Edge1);
+        RaySet.TrianglePositions.push_back(Tri.P1 + Tri.Edge2);
+    }
+
+    size_t RayCount = 0;
+    for (const auto& Rays : tileRays)
+        RayCount += Rays.size();
+
+    RaySet.Rays.reserve(RayCount);
+    for (auto& Rays : tileRays)
+    {
+        RaySet.Rays.insert(RaySet.Rays.end(), Rays.begin(), Rays.end());
+        std::vector<KH_CapturedRay>().swap(Rays);
+    }
+
+    return RaySet.SaveToFile(Settings.RayCapturePath);
+}
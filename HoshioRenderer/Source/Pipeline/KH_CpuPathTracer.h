@@ -0,0 +1,128 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "Pipeline/ShaderFeature/KH_DisneyBSDF.h"
+#include "Hit/KH_RayCapture.h"
+
+class KH_SceneBase;
+class KH_Camera;
+
+struct KH_CpuRenderSettings
+{
+    uint32_t Width = 0;
+    uint32_t Height = 0;
+    uint32_t SamplesPerPixel = 64;
+    uint32_t MaxBounce = 8;
+    uint32_t TileSize = 16;
+
+    // 与 KH_DisneyBSDF 的开关含义一致
+    bool bEnableSkybox = true;
+    bool bEnableVNDF = false;
+    bool bEnableSobol = true;
+
+    std::string SkyboxPath = "Assert/Images/HDR/qwantani_dusk_2_puresky_4k.hdr";
+
+    // 非空时把渲染中追踪的相机、弹射与阴影光线连同三角形写入该文件（KH_RaySet），供遍历基准回放。
+    // 只录制每个像素的前 RayCaptureSamples 个样本，1080p 单样本约数百 MB
+    std::string RayCapturePath;
+    uint32_t RayCaptureSamples = 1;
+    std::string RayCaptureSceneName;
+};
+
+struct KH_CpuRenderStats
+{
+    uint32_t TriangleCount = 0;
+    uint32_t BVHNodeCount = 0;
+    uint32_t InvalidSamples = 0;
+    int ThreadCount = 0;
+    float PrepareMilliseconds = 0.0f;
+    float RenderMilliseconds = 0.0f;
+};
+
+// CPU 参考路径追踪器：BSDF、环境光重要性采样、MIS 与采样维度分配均与 DisneyBSDF_6.frag 一致，
+// 用于没有 GPU 的渲染节点以及校验 GPU 输出。
+// Prepare 须在主线程调用，把场景快照为三角形、材质与 BVH；Render 只访问快照，可放到工作线程
+class KH_CpuPathTracer
+{
+public:
+    KH_CpuPathTracer() = default;
+    ~KH_CpuPathTracer() = default;
+
+    KH_CpuPathTracer(const KH_CpuPathTracer&) = delete;
+    KH_CpuPathTracer& operator=(const KH_CpuPathTracer&) = delete;
+
+    bool Prepare(const KH_SceneBase& scene, const KH_Camera& camera, const KH_CpuRenderSettings& settings);
+
+    // 输出线性辐射度，行序与 glReadPixels 一致（自下而上），alpha 为有效样本数
+    bool Render(std::vector<glm::vec4>& outPixels);
+
+    void Cancel();
+    float GetProgress() const;
+    bool IsPrepared() const;
+
+    const KH_CpuRenderSettings& GetSettings() const;
+    const KH_CpuRenderStats& GetStats() const;
+
+    // 只用三角形顶点（每 3 个一组）建立 BVH，不涉及材质与相机，之后可用 Intersect* 查询
+    void PrepareGeometry(const std::vector<glm::vec3>& positions);
+
+    // 与渲染使用同一套遍历；tMax 之外的交点不计
+    bool IntersectClosest(const glm::vec3& start, const glm::vec3& direction, float tMax, float& outDistance) const;
+    bool IntersectAny(const glm::vec3& start, const glm::vec3& direction, float tMax) const;
+
+    struct KH_Triangle
+    {
+        glm::vec3 P1;
+        glm::vec3 Edge1;
+        glm::vec3 Edge2;
+        glm::vec3 Ng;
+        glm::vec3 N1, N2, N3;
+        int MaterialSlot = -1;
+    };
+
+    // 叶节点 Count > 0，LeftOrFirst 为首个三角形；内部节点右孩子紧随左孩子之后
+    struct KH_Node
+    {
+        glm::vec3 MinPos;
+        int LeftOrFirst = 0;
+        glm::vec3 MaxPos;
+        int Count = 0;
+    };
+
+    struct KH_Environment
+    {
+        std::string FileName;
+        int Width = 0;
+        int Height = 0;
+        int Channels = 0;
+        std::vector<float> Pixels;
+        std::vector<glm::vec4> ImportanceTable;
+
+        bool IsValid() const;
+    };
+
+private:
+    KH_CpuRenderSettings Settings;
+    KH_CpuRenderStats Stats;
+
+    std::vector<KH_Triangle> Triangles;
+    std::vector<KH_Node> Nodes;
+    std::vector<KH_BSDFMaterial> Materials;
+    KH_Environment Environment;
+
+    glm::vec3 CameraPosition = glm::vec3(0.0f);
+    glm::vec3 CameraRight = glm::vec3(1.0f, 0.0f, 0.0f);
+    glm::vec3 CameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    glm::vec3 CameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    float CameraAspect = 1.0f;
+    float CameraFovy = 45.0f;
+
+    bool bPrepared = false;
+    std::atomic<bool> bCancelRequested = false;
+    std::atomic<uint32_t> CompletedTiles = 0;
+    uint32_t TotalTiles = 0;
+
+    bool LoadEnvironment(const std::string& path);
+    void BuildBVH();
+    bool SaveCapturedRays(std::vector<std::vector<KH_CapturedRay>>& tileRays) const;
+};
@@ -0,0 +1,398 @@
+#include "KH_FrameCapture.h"
+#include "KH_Framebuffer.h"
+#include "KH_GLState.h"
+#include "Utils/KH_DebugUtils.h"
+
+#include "stb_image/stb_image_write.h"
+
+namespace
+{
+    template<typename T>
+    void AppendValue(std::vector<unsigned char>& out, const T& value)
+    {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    void AppendAttribute(std::vector<unsigned char>& out, const char* name, const char* type, const void* value, int32_t size)
+    {
+        out.insert(out.end(), name, name + std::strlen(name) + 1);
+        out.insert(out.end(), type, type + std::strlen(type) + 1);
+        AppendValue(out, size);
+
+        const auto* bytes = static_cast<const unsigned char*>(value);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    // 未压缩的单层 scanline OpenEXR，B/G/R 三个 32 位 float 通道；输入行序自下而上
+    bool WriteEXR(const std::string& path, uint32_t width, uint32_t height, const glm::vec4* pixels)
+    {
+        std::vector<unsigned char> file;
+
+        AppendValue(file, int32_t(20000630));
+        AppendValue(file, int32_t(2));
+
+        // 通道须按名字排序
+        std::vector<unsigned char> channels;
+        for (const char* name : { "B", "G", "R" })
+        {
+            channels.insert(channels.end(), name, name + 2);
+            AppendValue(channels, int32_t(2));           // FLOAT
+            AppendValue(channels, uint32_t(0));          // pLinear + reserved
+            AppendValue(channels, int32_t(1));           // xSampling
+            AppendValue(channels, int32_t(1));           // ySampling
+        }
+        channels.push_back(0);
+
+        const int32_t window[4] = { 0, 0, static_cast<int32_t>(width) - 1, static_cast<int32_t>(height) - 1 };
+        const unsigned char compression = 0;
+        const unsigned char lineOrder = 0;
+        const float pixelAspectRatio = 1.0f;
+        const float screenWindowCenter[2] = { 0.0f, 0.0f };
+        const float screenWindowWidth = 1.0f;
+
+        AppendAttribute(file, "channels", "chlist", channels.data(), static_cast<int32_t>(channels.size()));
+        AppendAttribute(file, "compression", "compression", &compression, 1);
+        AppendAttribute(file, "dataWindow", "box2i", window, sizeof(window));
+        AppendAttribute(file, "displayWindow", "box2i", window, sizeof(window));
+        AppendAttribute(file, "lineOrder", "lineOrder", &lineOrder, 1);
+        AppendAttribute(file, "pixelAspectRatio", "float", &pixelAspectRatio, sizeof(float));
+        AppendAttribute(file, "screenWindowCenter", "v2f", screenWindowCenter, sizeof(screenWindowCenter));
+        AppendAttribute(file, "screenWindowWidth", "float", &screenWindowWidth, sizeof(float));
+        file.push_back(0);
+
+        const int32_t lineBytes = static_cast<int32_t>(width * 3 * sizeof(float));
+        const uint64_t blockBytes = sizeof(int32_t) * 2 + static_cast<uint64_t>(lineBytes);
+        const uint64_t firstBlock = file.size() + sizeof(uint64_t) * height;
+
+        for (uint32_t y = 0; y < height; ++y)
+            AppendValue(file, firstBlock + blockBytes * y);
+
+        file.reserve(file.size() + blockBytes * height);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            AppendValue(file, static_cast<int32_t>(y));
+            AppendValue(file, lineBytes);
+
+            // EXR 自上而下存储
+            const glm::vec4* row = pixels + static_cast<size_t>(height - 1 - y) * width;
+            for (int channel = 2; channel >= 0; --channel)
+            {
+                for (uint32_t x = 0; x < width; ++x)
+                    AppendValue(file, row[x][channel]);
+            }
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+            return false;
+
+        out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+        return static_cast<bool>(out);
+    }
+}
+
+KH_FrameCapture::KH_FrameCapture()
+{
+    Writer = std::thread([this]() { WriterLoop(); });
+}
+
+KH_FrameCapture::~KH_FrameCapture()
+{
+    // 排队的任务已在 Shutdown 中拷出像素，这里只等写盘线程编码完成
+    {
+        std::lock_guard<std::mutex> lock(QueueMutex);
+        bStopping = true;
+    }
+    QueueCondition.notify_all();
+
+    if (Writer.joinable())
+        Writer.join();
+}
+
+KH_CaptureFormat KH_FrameCapture::FormatFromPath(const std::string& path)
+{
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (extension == ".hdr")
+        return KH_CaptureFormat::HDR;
+    if (extension == ".exr")
+        return KH_CaptureFormat::EXR;
+
+    return KH_CaptureFormat::PNG;
+}
+
+bool KH_FrameCapture::Capture(const KH_Framebuffer& framebuffer, const std::string& path, uint32_t attachmentIndex)
+{
+    if (path.empty() || attachmentIndex >= framebuffer.GetColorAttachmentCount())
+        return false;
+
+    if (framebuffer.GetColorAttachmentFormat(attachmentIndex) == KH_FramebufferTextureFormat::R32I)
+    {
+        LOG_E("Capturing R32I framebuffer attachments is not supported.");
+        return false;
+    }
+
+    const uint32_t width = framebuffer.GetWidth();
+    const uint32_t height = framebuffer.GetHeight();
+    if (width == 0 || height == 0)
+        return false;
+
+    const KH_CaptureFormat format = FormatFromPath(path);
+    const bool bFloat = format != KH_CaptureFormat::PNG;
+    const size_t bytes = static_cast<size_t>(width) * height * (bFloat ? sizeof(glm::vec4) : 4);
+
+    const uint32_t index = AcquireSlot();
+    KH_ReadbackSlot& slot = Slots[index];
+    EnsureCapacity(slot, bytes);
+
+    // 空闲槽位若是为更大的捕获分配的，先释放，下次用到时按需重新分配
+    {
+        std::lock_guard<std::mutex> lock(QueueMutex);
+        for (uint32_t i = 0; i < MaxInFlightReadbacks; ++i)
+        {
+            if (i != index && Slots[i].Capacity > bytes * ShrinkFactor && IsSlotFree(i))
+                ReleaseSlot(Slots[i]);
+        }
+    }
+
+    slot.Width = width;
+    slot.Height = height;
+    slot.Bytes = bytes;
+    slot.Format = format;
+    slot.Path = path;
+
+    // 像素打包缓冲没有 DSA 入口，仅在此处短暂绑定；读回写入 PBO，调用立即返回
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+    glGetTextureImage(
+        framebuffer.GetColorAttachmentID(attachmentIndex),
+        0,
+        GL_RGBA,
+        bFloat ? GL_FLOAT : GL_UNSIGNED_BYTE,
+        static_cast<GLsizei>(bytes),
+        nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    InFlight.push_back(index);
+    return true;
+}
+
+void KH_FrameCapture::Update()
+{
+    // 读回按提交顺序完成，遇到第一个未到达的 fence 即可停止
+    while (!InFlight.empty() && RetireOldest(false))
+    {
+    }
+}
+
+void KH_FrameCapture::Flush()
+{
+    while (!InFlight.empty())
+        RetireOldest(true);
+
+    std::unique_lock<std::mutex> lock(QueueMutex);
+    DrainCondition.wait(lock, [this]() { return Queue.empty() && ActiveWrites == 0; });
+}
+
+void KH_FrameCapture::Shutdown()
+{
+    Flush();
+
+    for (KH_ReadbackSlot& slot : Slots)
+        ReleaseSlot(slot);
+}
+
+KH_FrameCaptureStats KH_FrameCapture::GetStats() const
+{
+    KH_FrameCaptureStats stats;
+    stats.InFlightReadbacks = static_cast<uint32_t>(InFlight.size());
+    stats.CompletedCaptures = CompletedCaptures.load();
+    stats.FailedCaptures = FailedCaptures.load();
+
+    std::lock_guard<std::mutex> lock(QueueMutex);
+    stats.QueuedWrites = static_cast<uint32_t>(Queue.size()) + ActiveWrites;
+    return stats;
+}
+
+uint32_t KH_FrameCapture::AcquireSlot()
+{
+    if (InFlight.size() >= MaxInFlightReadbacks)
+        RetireOldest(true);
+
+    // 交给写盘线程的槽位在像素拷出后才归还
+    uint32_t index = 0;
+    std::unique_lock<std::mutex> lock(QueueMutex);
+    DrainCondition.wait(lock, [&]()
+    {
+        for (uint32_t i = 0; i < MaxInFlightReadbacks; ++i)
+        {
+            if (IsSlotFree(i))
+            {
+                index = i;
+                return true;
+            }
+        }
+        return false;
+    });
+    return index;
+}
+
+bool KH_FrameCapture::IsSlotFree(uint32_t index) const
+{
+    return !Slots[index].bCopyPending && std::find(InFlight.begin(), InFlight.end(), index) == InFlight.end();
+}
+
+void KH_FrameCapture::EnsureCapacity(KH_ReadbackSlot& slot, size_t bytes)
+{
+    if (slot.PBO != 0 && slot.Capacity >= bytes && slot.Capacity <= bytes * ShrinkFactor)
+        return;
+
+    ReleaseSlot(slot);
+
+    // 持久映射并保持一致，fence 到达后即可直接读取，无需每次映射
+    const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &slot.PBO);
+    glNamedBufferStorage(slot.PBO, static_cast<GLsizeiptr>(bytes), nullptr, flags);
+    slot.Mapped = static_cast<const unsigned char*>(glMapNamedBufferRange(slot.PBO, 0, static_cast<GLsizeiptr>(bytes), flags));
+    slot.Capacity = bytes;
+}
+
+void KH_FrameCapture::ReleaseSlot(KH_ReadbackSlot& slot)
+{
+    if (slot.Fence)
+    {
+        glDeleteSync(slot.Fence);
+        slot.Fence = nullptr;
+    }
+
+    if (slot.PBO != 0)
+    {
+        if (slot.Mapped)
+            glUnmapNamedBuffer(slot.PBO);
+
+        KH_GLState::Instance().OnBufferDeleted(slot.PBO);
+        glDeleteBuffers(1, &slot.PBO);
+    }
+
+    slot.PBO = 0;
+    slot.Mapped = nullptr;
+    slot.Capacity = 0;
+}
+
+bool KH_FrameCapture::RetireOldest(bool bWait)
+{
+    KH_ReadbackSlot& slot = Slots[InFlight.front()];
+
+    GLenum result = glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (result == GL_TIMEOUT_EXPIRED && !bWait)
+        return false;
+
+    while (result == GL_TIMEOUT_EXPIRED)
+        result = glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+    glDeleteSync(slot.Fence);
+    slot.Fence = nullptr;
+    InFlight.pop_front();
+
+    KH_WriteJob job;
+    job.Path = std::move(slot.Path);
+    job.Format = slot.Format;
+    job.Width = slot.Width;
+    job.Height = slot.Height;
+
+    if (result == GL_WAIT_FAILED || !slot.Mapped)
+    {
+        LOG_E(std::format("Frame capture readback failed: {}", job.Path));
+        FailedCaptures++;
+        return true;
+    }
+
+    job.Slot = static_cast<uint32_t>(&slot - Slots.data());
+    job.Source = slot.Mapped;
+    job.Bytes = slot.Bytes;
+
+    {
+        // 写盘跟不上时在此限流，避免排队的任务无限增长
+        std::unique_lock<std::mutex> lock(QueueMutex);
+        DrainCondition.wait(lock, [this]() { return Queue.size() < MaxQueuedWrites; });
+        slot.bCopyPending = true;
+        Queue.push_back(std::move(job));
+    }
+    QueueCondition.notify_one();
+    return true;
+}
+
+void KH_FrameCapture::WriterLoop()
+{
+    while (true)
+    {
+        KH_WriteJob job;
+        {
+            std::unique_lock<std::mutex> lock(QueueMutex);
+            QueueCondition.wait(lock, [this]() { return bStopping || !Queue.empty(); });
+
+            if (Queue.empty())
+                return;
+
+            job = std::move(Queue.front());
+            Queue.pop_front();
+            ActiveWrites++;
+        }
+
+        // 持久映射保持一致，fence 已到达，可在本线程直接读取；拷出后立即归还槽位
+        job.Pixels.assign(job.Source, job.Source + job.Bytes);
+        {
+            std::lock_guard<std::mutex> lock(QueueMutex);
+            Slots[job.Slot].bCopyPending = false;
+        }
+        DrainCondition.notify_all();
+
+        if (WriteImage(job))
+        {
+            CompletedCaptures++;
+        }
+        else
+        {
+            FailedCaptures++;
+            LOG_E(std::format("Failed to write captured frame '{}'", job.Path));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(QueueMutex);
+            ActiveWrites--;
+        }
+        DrainCondition.notify_all();
+    }
+}
+
+bool KH_FrameCapture::WriteImage(const KH_WriteJob& job)
+{
+    const int width = static_cast<int>(job.Width);
+    const int height = static_cast<int>(job.Height);
+
+    if (job.Format == KH_CaptureFormat::PNG)
+    {
+        stbi_flip_vertically_on_write(1);
+        return stbi_write_png(job.Path.c_str(), width, height, 4, job.Pixels.data(), width * 4) != 0;
+    }
+
+    const auto* pixels = reinterpret_cast<const glm::vec4*>(job.Pixels.data());
+
+    if (job.Format == KH_CaptureFormat::EXR)
+        return WriteEXR(job.Path, job.Width, job.Height, pixels);
+
+    // alpha 为累积样本数，不写入辐射度文件
+    std::vector<float> rgb(static_cast<size_t>(width) * height * 3);
+    for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i)
+    {
+        rgb[i * 3 + 0] = pixels[i].r;
+        rgb[i * 3 + 1] = pixels[i].g;
+        rgb[i * 3 + 2] = pixels[i].b;
+    }
+
+    stbi_flip_vertically_on_write(1);
+    return stbi_write_hdr(job.Path.c_str(), width, height, 3, rgb.data()) != 0;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "KH_Common.h"
+
+#include <deque>
+#include <condition_variable>
+
+class KH_Framebuffer;
+
+enum class KH_CaptureFormat : uint8_t
+{
+    PNG,
+    HDR,
+    EXR
+};
+
+struct KH_FrameCaptureStats
+{
+    uint32_t InFlightReadbacks = 0;
+    uint32_t QueuedWrites = 0;
+    uint32_t CompletedCaptures = 0;
+    uint32_t FailedCaptures = 0;
+};
+
+// 异步帧捕获：读回写入 PBO 环并插入 fence，渲染线程不等待 GPU；fence 到达后把映射范围交给写盘线程，
+// 由它拷出像素、归还槽位后转换并编码。PNG 读回 RGBA8，HDR/EXR 读回线性 RGBA32F，不做色调映射
+class KH_FrameCapture : public KH_Singleton<KH_FrameCapture>
+{
+    friend class KH_Singleton<KH_FrameCapture>;
+
+public:
+    static constexpr uint32_t MaxInFlightReadbacks = 16;
+    static constexpr uint32_t MaxQueuedWrites = 32;
+
+    // 按扩展名选择格式，未知扩展名按 PNG 处理
+    static KH_CaptureFormat FormatFromPath(const std::string& path);
+
+    // PBO 环已满时先等待最早的一次读回；写盘队列已满时等待写盘线程
+    bool Capture(const KH_Framebuffer& framebuffer, const std::string& path, uint32_t attachmentIndex = 0);
+
+    // 每帧调用：把 fence 已到达的读回交给写盘线程
+    void Update();
+
+    // 等待全部读回与写盘完成
+    void Flush();
+
+    // 完成全部捕获并删除 PBO 与 fence，须在 GL 上下文销毁前调用；析构函数不再调用 GL
+    void Shutdown();
+
+    KH_FrameCaptureStats GetStats() const;
+
+private:
+    KH_FrameCapture();
+    ~KH_FrameCapture() override;
+
+    KH_FrameCapture(const KH_FrameCapture&) = delete;
+    KH_FrameCapture& operator=(const KH_FrameCapture&) = delete;
+
+    struct KH_ReadbackSlot
+    {
+        GLuint PBO = 0;
+        size_t Capacity = 0;
+        const unsigned char* Mapped = nullptr;
+        GLsync Fence = nullptr;
+
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        size_t Bytes = 0;
+        KH_CaptureFormat Format = KH_CaptureFormat::PNG;
+        std::string Path;
+
+        // fence 已到达、写盘线程尚未拷出像素；受 QueueMutex 保护
+        bool bCopyPending = false;
+    };
+
+    struct KH_WriteJob
+    {
+        std::string Path;
+        KH_CaptureFormat Format = KH_CaptureFormat::PNG;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+
+        // 读回槽位的映射范围，写盘线程拷出后归还槽位
+        uint32_t Slot = 0;
+        const unsigned char* Source = nullptr;
+        size_t Bytes = 0;
+
+        // 行序与 glGetTextureImage 一致（自下而上）
+        std::vector<unsigned char> Pixels;
+    };
+
+    std::array<KH_ReadbackSlot, MaxInFlightReadbacks> Slots;
+    // 按提交顺序排列的在途槽位
+    std::deque<uint32_t> InFlight;
+
+    std::thread Writer;
+    mutable std::mutex QueueMutex;
+    std::condition_variable QueueCondition;
+    std::condition_variable DrainCondition;
+    std::deque<KH_WriteJob> Queue;
+    uint32_t ActiveWrites = 0;
+    bool bStopping = false;
+
+    std::atomic<uint32_t> CompletedCaptures = 0;
+    std::atomic<uint32_t> FailedCaptures = 0;
+
+    // 槽位容量超过本次读回的这个倍数时重新分配，避免一次大尺寸捕获后长期占用显存
+    static constexpr size_t ShrinkFactor = 2;
+
+    uint32_t AcquireSlot();
+    bool IsSlotFree(uint32_t index) const;
+    void EnsureCapacity(KH_ReadbackSlot& slot, size_t bytes);
+    void ReleaseSlot(KH_ReadbackSlot& slot);
+
+    // 取出最早的在途读回；bWait 为 false 且 fence 未到达时返回 false
+    bool RetireOldest(bool bWait);
+
+    void WriterLoop();
+    static bool WriteImage(const KH_WriteJob& job);
+};
@@ -1,5 +1,6 @@
 #include "KH_Framebuffer.h"
 #include "KH_Shader.h"
+#include "KH_GLState.h"
 #include "Utils/KH_DebugUtils.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -7,75 +8,22 @@
 
 namespace
 {
-    static void CreateTextures(bool multisample, uint32_t* outID, uint32_t count)
-    {
-        glCreateTextures(multisample ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, count, outID);
-    }
-
-    static void BindTexture(bool multisample, uint32_t id)
-    {
-        glBindTexture(multisample ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, id);
-    }
-
-    static void AttachColorTexture(uint32_t id,
-        GLenum internalFormat,
-        GLenum format,
-        uint32_t width,
-        uint32_t height,
-        uint32_t index)
-    {
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_FLOAT, nullptr);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, GL_TEXTURE_2D, id, 0);
-    }
-
-    static void AttachIntegerColorTexture(uint32_t id,
+    static void AttachTexture(uint32_t fbo,
+        uint32_t id,
         GLenum internalFormat,
-        GLenum format,
+        GLenum filter,
         uint32_t width,
         uint32_t height,
-        uint32_t index)
-    {
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_INT, nullptr);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, GL_TEXTURE_2D, id, 0);
-    }
-
-    static void AttachDepthTexture(uint32_t id,
-        GLenum internalFormat,
-        GLenum attachmentType,
-        uint32_t width,
-        uint32_t height)
+        GLenum attachment)
     {
-        glBindTexture(GL_TEXTURE_2D, id);
-
-        if (attachmentType == GL_DEPTH_ATTACHMENT)
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
-        }
-        else
-        {
-            glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
-        }
+        glTextureStorage2D(id, 1, internalFormat, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, filter);
+        glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, filter);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, GL_TEXTURE_2D, id, 0);
+        glNamedFramebufferTexture(fbo, attachment, id, 0);
     }
 }
 
@@ -143,7 +91,6 @@ void KH_Framebuffer::Invalidate()
     Release();
 
     glCreateFramebuffers(1, &FBO);
-    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
 
     if (!ColorAttachmentDescs.empty())
     {
@@ -153,38 +100,27 @@ void KH_Framebuffer::Invalidate()
         for (size_t i = 0; i < ColorAttachments.size(); ++i)
         {
             const auto format = ColorAttachmentDescs[i].Format;
+            const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
 
             switch (format)
             {
             case KH_FramebufferTextureFormat::RGBA8:
-                AttachColorTexture(ColorAttachments[i], GL_RGBA8, GL_RGBA, Desc.Width, Desc.Height, static_cast<uint32_t>(i));
+                AttachTexture(FBO, ColorAttachments[i], GL_RGBA8, GL_LINEAR, Desc.Width, Desc.Height, attachment);
                 break;
             case KH_FramebufferTextureFormat::RGBA16F:
-                AttachColorTexture(ColorAttachments[i], GL_RGBA16F, GL_RGBA, Desc.Width, Desc.Height, static_cast<uint32_t>(i));
+                AttachTexture(FBO, ColorAttachments[i], GL_RGBA16F, GL_LINEAR, Desc.Width, Desc.Height, attachment);
                 break;
             case KH_FramebufferTextureFormat::RGBA32F:
-                AttachColorTexture(ColorAttachments[i], GL_RGBA32F, GL_RGBA, Desc.Width, Desc.Height, static_cast<uint32_t>(i));
+                AttachTexture(FBO, ColorAttachments[i], GL_RGBA32F, GL_LINEAR, Desc.Width, Desc.Height, attachment);
                 break;
             case KH_FramebufferTextureFormat::RG16F:
-                glBindTexture(GL_TEXTURE_2D, ColorAttachments[i]);
-                glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, Desc.Width, Desc.Height, 0, GL_RG, GL_FLOAT, nullptr);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), GL_TEXTURE_2D, ColorAttachments[i], 0);
+                AttachTexture(FBO, ColorAttachments[i], GL_RG16F, GL_LINEAR, Desc.Width, Desc.Height, attachment);
                 break;
             case KH_FramebufferTextureFormat::R8:
-                glBindTexture(GL_TEXTURE_2D, ColorAttachments[i]);
-                glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, Desc.Width, Desc.Height, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), GL_TEXTURE_2D, ColorAttachments[i], 0);
+                AttachTexture(FBO, ColorAttachments[i], GL_R8, GL_LINEAR, Desc.Width, Desc.Height, attachment);
                 break;
             case KH_FramebufferTextureFormat::R32I:
-                AttachIntegerColorTexture(ColorAttachments[i], GL_R32I, GL_RED_INTEGER, Desc.Width, Desc.Height, static_cast<uint32_t>(i));
+                AttachTexture(FBO, ColorAttachments[i], GL_R32I, GL_NEAREST, Desc.Width, Desc.Height, attachment);
                 break;
             default:
                 assert(false && "Unsupported color attachment format");
@@ -200,10 +136,10 @@ void KH_Framebuffer::Invalidate()
         switch (DepthAttachmentDesc.Format)
         {
         case KH_FramebufferTextureFormat::DEPTH24STENCIL8:
-            AttachDepthTexture(DepthAttachment, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, Desc.Width, Desc.Height);
+            AttachTexture(FBO, DepthAttachment, GL_DEPTH24_STENCIL8, GL_NEAREST, Desc.Width, Desc.Height, GL_DEPTH_STENCIL_ATTACHMENT);
             break;
         case KH_FramebufferTextureFormat::DEPTH32F:
-            AttachDepthTexture(DepthAttachment, GL_DEPTH_COMPONENT32F, GL_DEPTH_ATTACHMENT, Desc.Width, Desc.Height);
+            AttachTexture(FBO, DepthAttachment, GL_DEPTH_COMPONENT32F, GL_NEAREST, Desc.Width, Desc.Height, GL_DEPTH_ATTACHMENT);
             break;
         default:
             assert(false && "Unsupported depth attachment format");
@@ -218,38 +154,42 @@ void KH_Framebuffer::Invalidate()
             GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3,
             GL_COLOR_ATTACHMENT4, GL_COLOR_ATTACHMENT5, GL_COLOR_ATTACHMENT6, GL_COLOR_ATTACHMENT7
         };
-        glDrawBuffers(static_cast<GLsizei>(ColorAttachments.size()), buffers);
+        glNamedFramebufferDrawBuffers(FBO, static_cast<GLsizei>(ColorAttachments.size()), buffers);
     }
     else if (ColorAttachments.empty())
     {
-        glDrawBuffer(GL_NONE);
-        glReadBuffer(GL_NONE);
+        glNamedFramebufferDrawBuffer(FBO, GL_NONE);
+        glNamedFramebufferReadBuffer(FBO, GL_NONE);
     }
 
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    if (glCheckNamedFramebufferStatus(FBO, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
     {
         LOG_E("Framebuffer is not complete!");
     }
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
 void KH_Framebuffer::Release()
 {
+    KH_GLState& State = KH_GLState::Instance();
+
     if (FBO)
     {
+        State.OnFramebufferDeleted(FBO);
         glDeleteFramebuffers(1, &FBO);
         FBO = 0;
     }
 
     if (!ColorAttachments.empty())
     {
+        for (uint32_t attachment : ColorAttachments)
+            State.OnTextureDeleted(attachment);
         glDeleteTextures(static_cast<GLsizei>(ColorAttachments.size()), ColorAttachments.data());
         ColorAttachments.clear();
     }
 
     if (DepthAttachment)
     {
+        State.OnTextureDeleted(DepthAttachment);
         glDeleteTextures(1, &DepthAttachment);
         DepthAttachment = 0;
     }
@@ -257,13 +197,14 @@ void KH_Framebuffer::Release()
 
 void KH_Framebuffer::Bind() const
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
-    glViewport(0, 0, static_cast<GLsizei>(Desc.Width), static_cast<GLsizei>(Desc.Height));
+    KH_GLState& State = KH_GLState::Instance();
+    State.BindFramebuffer(FBO);
+    State.Viewport(0, 0, static_cast<GLsizei>(Desc.Width), static_cast<GLsizei>(Desc.Height));
 }
 
 void KH_Framebuffer::Unbind() const
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    KH_GLState::Instance().BindFramebuffer(0);
 }
 
 void KH_Framebuffer::Resize(uint32_t width, uint32_t height)
@@ -281,8 +222,27 @@ void KH_Framebuffer::Resize(uint32_t width, uint32_t height)
 
 void KH_Framebuffer::Clear(const glm::vec4& color) const
 {
-    glClearColor(color.r, color.g, color.b, color.a);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    for (size_t i = 0; i < ColorAttachments.size(); ++i)
+    {
+        if (ColorAttachmentDescs[i].Format == KH_FramebufferTextureFormat::R32I)
+        {
+            const GLint value[4] = { static_cast<GLint>(color.r), 0, 0, 0 };
+            glClearNamedFramebufferiv(FBO, GL_COLOR, static_cast<GLint>(i), value);
+        }
+        else
+        {
+            glClearNamedFramebufferfv(FBO, GL_COLOR, static_cast<GLint>(i), glm::value_ptr(color));
+        }
+    }
+
+    if (DepthAttachment)
+    {
+        const float depth = 1.0f;
+        if (DepthAttachmentDesc.Format == KH_FramebufferTextureFormat::DEPTH24STENCIL8)
+            glClearNamedFramebufferfi(FBO, GL_DEPTH_STENCIL, 0, depth, 0);
+        else
+            glClearNamedFramebufferfv(FBO, GL_DEPTH, 0, &depth);
+    }
 }
 
 void KH_Framebuffer::ClearColorAttachment(uint32_t attachmentIndex, const glm::vec4& value) const
@@ -379,21 +339,18 @@ void KH_Framebuffer::ClearDepthStencilAttachment(float depth, int stencil) const
 void KH_Framebuffer::BindColorAttachment(uint32_t attachmentIndex, uint32_t unit) const
 {
     assert(attachmentIndex < ColorAttachments.size());
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, ColorAttachments[attachmentIndex]);
+    KH_GLState::Instance().BindTextureUnit(unit, ColorAttachments[attachmentIndex]);
 }
 
 void KH_Framebuffer::BindDepthAttachment(uint32_t unit) const
 {
     assert(DepthAttachment != 0);
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, DepthAttachment);
+    KH_GLState::Instance().BindTextureUnit(unit, DepthAttachment);
 }
 
 void KH_Framebuffer::UnbindTexture(uint32_t unit) const
 {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    KH_GLState::Instance().BindTextureUnit(unit, 0);
 }
 
 bool KH_Framebuffer::SaveColorAttachmentToPNG(const std::string& filePath, uint32_t attachmentIndex) const
@@ -416,81 +373,85 @@ bool KH_Framebuffer::SaveColorAttachmentToPNG(const std::string& filePath, uint3
         return false;
     }
 
-    GLint prevFBO = 0;
-    GLint prevReadBuffer = 0;
-    GLint prevPackAlignment = 0;
-    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prevFBO);
-    glGetIntegerv(GL_READ_BUFFER, &prevReadBuffer);
-    glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
-    glReadBuffer(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(attachmentIndex));
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    // 直接读取纹理，不改动也不查询当前的帧缓冲与读缓冲绑定
+    std::vector<glm::vec4> pixels;
+    if (!ReadColorAttachment(pixels, attachmentIndex))
+        return false;
 
     std::vector<unsigned char> pngPixels(static_cast<size_t>(width) * static_cast<size_t>(height) * 4ull, 255u);
 
-    if (format == KH_FramebufferTextureFormat::RGBA8)
+    for (size_t i = 0; i < pixels.size(); ++i)
     {
-        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pngPixels.data());
+        glm::vec4 value = glm::clamp(pixels[i], 0.0f, 1.0f);
+        if (format == KH_FramebufferTextureFormat::R8)
+            value = glm::vec4(glm::vec3(value.r), 1.0f);
+
+        pngPixels[i * 4 + 0] = static_cast<unsigned char>(value.r * 255.0f + 0.5f);
+        pngPixels[i * 4 + 1] = static_cast<unsigned char>(value.g * 255.0f + 0.5f);
+        pngPixels[i * 4 + 2] = static_cast<unsigned char>(value.b * 255.0f + 0.5f);
+        pngPixels[i * 4 + 3] = static_cast<unsigned char>(value.a * 255.0f + 0.5f);
     }
-    else if (format == KH_FramebufferTextureFormat::R8)
-    {
-        std::vector<unsigned char> red(static_cast<size_t>(width) * static_cast<size_t>(height), 0u);
-        glReadPixels(0, 0, width, height, GL_RED, GL_UNSIGNED_BYTE, red.data());
 
-        for (int i = 0; i < width * height; ++i)
-        {
-            const unsigned char value = red[i];
-            pngPixels[i * 4 + 0] = value;
-            pngPixels[i * 4 + 1] = value;
-            pngPixels[i * 4 + 2] = value;
-            pngPixels[i * 4 + 3] = 255u;
-        }
-    }
-    else if (
-        format == KH_FramebufferTextureFormat::RGBA16F ||
-        format == KH_FramebufferTextureFormat::RGBA32F ||
-        format == KH_FramebufferTextureFormat::RG16F)
-    {
-        const GLenum readFormat = (format == KH_FramebufferTextureFormat::RG16F) ? GL_RG : GL_RGBA;
-        const int channelCount = (format == KH_FramebufferTextureFormat::RG16F) ? 2 : 4;
+    stbi_flip_vertically_on_write(1);
+    const int strideInBytes = width * 4;
+    return stbi_write_png(filePath.c_str(), width, height, 4, pngPixels.data(), strideInBytes) != 0;
+}
 
-        std::vector<float> pixels(static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channelCount), 0.0f);
-        glReadPixels(0, 0, width, height, readFormat, GL_FLOAT, pixels.data());
+bool KH_Framebuffer::ReadColorAttachment(std::vector<glm::vec4>& outPixels, uint32_t attachmentIndex) const
+{
+    if (attachmentIndex >= ColorAttachments.size())
+        return false;
 
-        for (int i = 0; i < width * height; ++i)
-        {
-            const float r = std::clamp(pixels[i * channelCount + 0], 0.0f, 1.0f);
-            const float g = std::clamp(pixels[i * channelCount + 1], 0.0f, 1.0f);
-            const float b = (channelCount >= 3)
-                ? std::clamp(pixels[i * channelCount + 2], 0.0f, 1.0f)
-                : 0.0f;
-            const float a = (channelCount >= 4)
-                ? std::clamp(pixels[i * channelCount + 3], 0.0f, 1.0f)
-                : 1.0f;
-
-            pngPixels[i * 4 + 0] = static_cast<unsigned char>(r * 255.0f + 0.5f);
-            pngPixels[i * 4 + 1] = static_cast<unsigned char>(g * 255.0f + 0.5f);
-            pngPixels[i * 4 + 2] = static_cast<unsigned char>(b * 255.0f + 0.5f);
-            pngPixels[i * 4 + 3] = static_cast<unsigned char>(a * 255.0f + 0.5f);
-        }
+    const auto format = ColorAttachmentDescs[attachmentIndex].Format;
+    if (format == KH_FramebufferTextureFormat::R32I)
+    {
+        LOG_E("Reading R32I framebuffer attachments as float is not supported.");
+        return false;
     }
-    else
+
+    const size_t pixelCount = static_cast<size_t>(Desc.Width) * static_cast<size_t>(Desc.Height);
+    if (pixelCount == 0)
+        return false;
+
+    outPixels.assign(pixelCount, glm::vec4(0.0f));
+    glGetTextureImage(
+        ColorAttachments[attachmentIndex],
+        0,
+        GL_RGBA,
+        GL_FLOAT,
+        static_cast<GLsizei>(pixelCount * sizeof(glm::vec4)),
+        outPixels.data());
+
+    return true;
+}
+
+bool KH_Framebuffer::WriteColorAttachment(const std::vector<glm::vec4>& pixels, uint32_t attachmentIndex)
+{
+    if (attachmentIndex >= ColorAttachments.size())
+        return false;
+
+    const auto format = ColorAttachmentDescs[attachmentIndex].Format;
+    if (format == KH_FramebufferTextureFormat::R32I)
     {
-        glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
-        glReadBuffer(prevReadBuffer);
-        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(prevFBO));
-        LOG_E("Unsupported framebuffer color format for PNG export.");
+        LOG_E("Writing float pixels to R32I framebuffer attachments is not supported.");
         return false;
     }
 
-    glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
-    glReadBuffer(prevReadBuffer);
-    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(prevFBO));
+    const size_t pixelCount = static_cast<size_t>(Desc.Width) * static_cast<size_t>(Desc.Height);
+    if (pixelCount == 0 || pixels.size() != pixelCount)
+        return false;
 
-    stbi_flip_vertically_on_write(1);
-    const int strideInBytes = width * 4;
-    return stbi_write_png(filePath.c_str(), width, height, 4, pngPixels.data(), strideInBytes) != 0;
+    glTextureSubImage2D(
+        ColorAttachments[attachmentIndex],
+        0,
+        0, 0,
+        static_cast<GLsizei>(Desc.Width),
+        static_cast<GLsizei>(Desc.Height),
+        GL_RGBA,
+        GL_FLOAT,
+        pixels.data());
+
+    return true;
 }
 
 uint32_t KH_Framebuffer::GetColorAttachmentID(uint32_t index) const
@@ -499,6 +460,12 @@ uint32_t KH_Framebuffer::GetColorAttachmentID(uint32_t index) const
     return ColorAttachments[index];
 }
 
+KH_FramebufferTextureFormat KH_Framebuffer::GetColorAttachmentFormat(uint32_t index) const
+{
+    assert(index < ColorAttachmentDescs.size());
+    return ColorAttachmentDescs[index].Format;
+}
+
 bool KH_Framebuffer::IsDepthFormat(KH_FramebufferTextureFormat format)
 {
     return format == KH_FramebufferTextureFormat::DEPTH24STENCIL8 ||
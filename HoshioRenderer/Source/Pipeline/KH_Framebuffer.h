@@ -79,12 +79,17 @@ public:
     void UnbindTexture(uint32_t unit = 0) const;
 
     bool SaveColorAttachmentToPNG(const std::string& filePath, uint32_t attachmentIndex = 0) const;
+    bool ReadColorAttachment(std::vector<glm::vec4>& outPixels, uint32_t attachmentIndex = 0) const;
+    // 像素数须与附件尺寸一致，行序与 ReadColorAttachment 相同
+    bool WriteColorAttachment(const std::vector<glm::vec4>& pixels, uint32_t attachmentIndex = 0);
 
     uint32_t GetRendererID() const { return FBO; }
     uint32_t GetWidth() const { return Desc.Width; }
     uint32_t GetHeight() const { return Desc.Height; }
 
     uint32_t GetColorAttachmentID(uint32_t index = 0) const;
+    uint32_t GetColorAttachmentCount() const { return static_cast<uint32_t>(ColorAttachments.size()); }
+    KH_FramebufferTextureFormat GetColorAttachmentFormat(uint32_t index = 0) const;
     uint32_t GetDepthAttachmentID() const { return DepthAttachment; }
 
     const KH_FramebufferDescription& GetDescription() const { return Desc; }
@@ -0,0 +1,176 @@
+#include "KH_GLState.h"
+
+KH_GLState::KH_GLState()
+{
+    Invalidate();
+}
+
+bool KH_GLState::Skip(bool bRedundant)
+{
+    if (bCacheEnabled && bRedundant)
+    {
+        FrameStats.SkippedCalls++;
+        return true;
+    }
+
+    FrameStats.StateCalls++;
+    return false;
+}
+
+void KH_GLState::BindFramebuffer(GLuint fbo)
+{
+    if (Skip(Framebuffer == fbo))
+        return;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    Framebuffer = fbo;
+    FrameStats.FramebufferBinds++;
+}
+
+void KH_GLState::Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    const glm::ivec4 rect(x, y, width, height);
+    if (Skip(ViewportRect == rect))
+        return;
+
+    glViewport(x, y, width, height);
+    ViewportRect = rect;
+    FrameStats.ViewportChanges++;
+}
+
+void KH_GLState::UseProgram(GLuint program)
+{
+    if (Skip(Program == program))
+        return;
+
+    glUseProgram(program);
+    Program = program;
+    FrameStats.ProgramBinds++;
+}
+
+void KH_GLState::BindTextureUnit(GLuint unit, GLuint texture)
+{
+    const bool bTracked = unit < MaxTextureUnits;
+    if (Skip(bTracked && TextureUnits[unit] == texture))
+        return;
+
+    glBindTextureUnit(unit, texture);
+    if (bTracked)
+        TextureUnits[unit] = texture;
+    FrameStats.TextureBinds++;
+}
+
+void KH_GLState::BindVertexArray(GLuint vao)
+{
+    if (Skip(VertexArray == vao))
+        return;
+
+    glBindVertexArray(vao);
+    VertexArray = vao;
+    FrameStats.VertexArrayBinds++;
+}
+
+void KH_GLState::BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    KH_BufferBinding* binding = FindBufferBinding(target, index);
+    const bool bRedundant = binding && binding->bValid && binding->Buffer == buffer && binding->Offset == 0 && binding->Size == 0;
+    if (Skip(bRedundant))
+        return;
+
+    glBindBufferBase(target, index, buffer);
+    if (binding)
+        *binding = { buffer, 0, 0, true };
+    FrameStats.BufferBinds++;
+}
+
+void KH_GLState::BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    KH_BufferBinding* binding = FindBufferBinding(target, index);
+    const bool bRedundant = binding && binding->bValid && binding->Buffer == buffer && binding->Offset == offset && binding->Size == size;
+    if (Skip(bRedundant))
+        return;
+
+    glBindBufferRange(target, index, buffer, offset, size);
+    if (binding)
+        *binding = { buffer, offset, size, true };
+    FrameStats.BufferBinds++;
+}
+
+void KH_GLState::OnFramebufferDeleted(GLuint fbo)
+{
+    if (Framebuffer == fbo)
+        Framebuffer = 0;
+}
+
+void KH_GLState::OnProgramDeleted(GLuint program)
+{
+    if (Program == program)
+        Program = Unknown;
+}
+
+void KH_GLState::OnTextureDeleted(GLuint texture)
+{
+    for (GLuint& unit : TextureUnits)
+    {
+        if (unit == texture)
+            unit = 0;
+    }
+}
+
+void KH_GLState::OnBufferDeleted(GLuint buffer)
+{
+    for (auto* bindings : { &UniformBuffers, &StorageBuffers })
+    {
+        for (KH_BufferBinding& binding : *bindings)
+        {
+            if (binding.bValid && binding.Buffer == buffer)
+                binding = { 0, 0, 0, true };
+        }
+    }
+}
+
+void KH_GLState::OnVertexArrayDeleted(GLuint vao)
+{
+    if (VertexArray == vao)
+        VertexArray = 0;
+}
+
+void KH_GLState::Invalidate()
+{
+    Framebuffer = Unknown;
+    Program = Unknown;
+    VertexArray = Unknown;
+    ViewportRect = glm::ivec4(-1);
+
+    TextureUnits.fill(Unknown);
+    UniformBuffers.fill(KH_BufferBinding());
+    StorageBuffers.fill(KH_BufferBinding());
+}
+
+void KH_GLState::BeginFrame()
+{
+    LastFrameStats = FrameStats;
+    FrameStats = KH_GLCallStats();
+
+    // ImGui 后端会在帧间改动程序、纹理与 VAO 绑定
+    Invalidate();
+}
+
+void KH_GLState::SetCacheEnabled(bool bEnabled)
+{
+    bCacheEnabled = bEnabled;
+    Invalidate();
+}
+
+KH_GLState::KH_BufferBinding* KH_GLState::FindBufferBinding(GLenum target, GLuint index)
+{
+    if (index >= MaxBufferBindings)
+        return nullptr;
+
+    if (target == GL_UNIFORM_BUFFER)
+        return &UniformBuffers[index];
+    if (target == GL_SHADER_STORAGE_BUFFER)
+        return &StorageBuffers[index];
+
+    return nullptr;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "KH_Common.h"
+
+struct KH_GLCallStats
+{
+    uint32_t StateCalls = 0;
+    uint32_t SkippedCalls = 0;
+
+    uint32_t FramebufferBinds = 0;
+    uint32_t ProgramBinds = 0;
+    uint32_t TextureBinds = 0;
+    uint32_t BufferBinds = 0;
+    uint32_t VertexArrayBinds = 0;
+    uint32_t ViewportChanges = 0;
+};
+
+// 缓存已绑定的 GL 对象，跳过重复绑定并统计每帧的状态切换次数
+// 绕过缓存直接改动绑定的代码（如 ImGui 后端）之后需调用 Invalidate
+class KH_GLState : public KH_Singleton<KH_GLState>
+{
+    friend class KH_Singleton<KH_GLState>;
+
+public:
+    static constexpr uint32_t MaxTextureUnits = 32;
+    static constexpr uint32_t MaxBufferBindings = 16;
+
+    void BindFramebuffer(GLuint fbo);
+    void Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void UseProgram(GLuint program);
+    void BindTextureUnit(GLuint unit, GLuint texture);
+    void BindVertexArray(GLuint vao);
+    void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+    void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+    // 对象删除后 GL 会自动解除其绑定，名字可能被复用，缓存需同步清除
+    void OnFramebufferDeleted(GLuint fbo);
+    void OnProgramDeleted(GLuint program);
+    void OnTextureDeleted(GLuint texture);
+    void OnBufferDeleted(GLuint buffer);
+    void OnVertexArrayDeleted(GLuint vao);
+
+    void Invalidate();
+
+    // 每帧开始时调用，保存上一帧统计
+    void BeginFrame();
+
+    const KH_GLCallStats& GetLastFrameStats() const { return LastFrameStats; }
+
+    bool IsCacheEnabled() const { return bCacheEnabled; }
+    void SetCacheEnabled(bool bEnabled);
+
+private:
+    KH_GLState();
+    ~KH_GLState() override = default;
+
+    KH_GLState(const KH_GLState&) = delete;
+    KH_GLState& operator=(const KH_GLState&) = delete;
+
+    struct KH_BufferBinding
+    {
+        GLuint Buffer = 0;
+        GLintptr Offset = 0;
+        GLsizeiptr Size = 0;
+        bool bValid = false;
+    };
+
+    static constexpr GLuint Unknown = std::numeric_limits<GLuint>::max();
+
+    bool bCacheEnabled = true;
+
+    GLuint Framebuffer = Unknown;
+    GLuint Program = Unknown;
+    GLuint VertexArray = Unknown;
+    glm::ivec4 ViewportRect = glm::ivec4(-1);
+
+    std::array<GLuint, MaxTextureUnits> TextureUnits;
+    std::array<KH_BufferBinding, MaxBufferBindings> UniformBuffers;
+    std::array<KH_BufferBinding, MaxBufferBindings> StorageBuffers;
+
+    KH_GLCallStats FrameStats;
+    KH_GLCallStats LastFrameStats;
+
+    KH_BufferBinding* FindBufferBinding(GLenum target, GLuint index);
+
+    bool Skip(bool bRedundant);
+};
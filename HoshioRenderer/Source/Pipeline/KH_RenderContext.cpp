@@ -0,0 +1,21 @@
+#include "KH_RenderContext.h"
+
+#include <cassert>
+
+KH_RenderContext* KH_RenderContext::CurrentContext = nullptr;
+
+KH_RenderContext& KH_RenderContext::Current()
+{
+    assert(CurrentContext != nullptr);
+    return *CurrentContext;
+}
+
+bool KH_RenderContext::HasCurrent()
+{
+    return CurrentContext != nullptr;
+}
+
+void KH_RenderContext::SetCurrent(KH_RenderContext* context)
+{
+    CurrentContext = context;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "KH_Common.h"
+
+class KH_Camera;
+class KH_Framebuffer;
+
+// 驱动一帧路径追踪与后处理的宿主（编辑器或无窗口渲染器）。
+// 场景与后处理图只通过当前上下文读取相机、累积目标与帧参数，不直接依赖 KH_Editor
+class KH_RenderContext
+{
+public:
+    KH_RenderContext() = default;
+    virtual ~KH_RenderContext() = default;
+
+    virtual const KH_Camera& GetCamera() const = 0;
+
+    // 本帧写入的累积目标与上一帧的历史
+    virtual KH_Framebuffer& GetSceneFramebuffer() = 0;
+    virtual const KH_Framebuffer& GetLastFramebuffer() = 0;
+    virtual void SetPresentFramebuffer(const KH_Framebuffer* framebuffer) = 0;
+
+    virtual glm::uvec2 GetRenderExtent() const = 0;
+    virtual uint32_t GetFrameCounter() const = 0;
+    virtual uint32_t GetSampleTarget() const = 0;
+    virtual bool IsTemporalReprojectionEnabled() const = 0;
+    virtual float GetHistoryClamp() const = 0;
+
+    static KH_RenderContext& Current();
+    static bool HasCurrent();
+    static void SetCurrent(KH_RenderContext* context);
+
+private:
+    static KH_RenderContext* CurrentContext;
+};
@@ -0,0 +1,127 @@
+#include "KH_RenderTargetPool.h"
+
+KH_Framebuffer* KH_RenderTargetPool::Acquire(const KH_FramebufferDescription& desc)
+{
+    KH_PooledTarget* resizable = nullptr;
+
+    for (KH_PooledTarget& target : Targets)
+    {
+        if (target.bInUse || !SameFormats(target.Framebuffer->GetDescription(), desc))
+            continue;
+
+        if (target.Framebuffer->GetWidth() == desc.Width && target.Framebuffer->GetHeight() == desc.Height)
+        {
+            target.bInUse = true;
+            target.LastUsedFrame = FrameIndex;
+            FrameReuses++;
+            return target.Framebuffer.get();
+        }
+
+        if (!resizable)
+            resizable = &target;
+    }
+
+    if (resizable)
+    {
+        resizable->Framebuffer->Resize(desc.Width, desc.Height);
+        resizable->bInUse = true;
+        resizable->LastUsedFrame = FrameIndex;
+        FrameReuses++;
+        return resizable->Framebuffer.get();
+    }
+
+    KH_PooledTarget target;
+    target.Framebuffer = std::make_unique<KH_Framebuffer>(desc);
+    target.bInUse = true;
+    target.LastUsedFrame = FrameIndex;
+    Targets.push_back(std::move(target));
+
+    FrameAllocations++;
+    return Targets.back().Framebuffer.get();
+}
+
+void KH_RenderTargetPool::Release(KH_Framebuffer* framebuffer)
+{
+    for (KH_PooledTarget& target : Targets)
+    {
+        if (target.Framebuffer.get() == framebuffer)
+        {
+            target.bInUse = false;
+            target.LastUsedFrame = FrameIndex;
+            return;
+        }
+    }
+}
+
+void KH_RenderTargetPool::BeginFrame()
+{
+    FrameIndex++;
+
+    LastFrameAllocations = FrameAllocations;
+    LastFrameReuses = FrameReuses;
+    FrameAllocations = 0;
+    FrameReuses = 0;
+
+    std::erase_if(Targets, [this](const KH_PooledTarget& target) {
+        return !target.bInUse && FrameIndex - target.LastUsedFrame > MaxIdleFrames;
+    });
+}
+
+void KH_RenderTargetPool::Clear()
+{
+    std::erase_if(Targets, [](const KH_PooledTarget& target) { return !target.bInUse; });
+}
+
+KH_RenderTargetPoolStats KH_RenderTargetPool::GetStats() const
+{
+    KH_RenderTargetPoolStats stats;
+    stats.TargetCount = static_cast<uint32_t>(Targets.size());
+    stats.Allocations = LastFrameAllocations;
+    stats.Reuses = LastFrameReuses;
+
+    for (const KH_PooledTarget& target : Targets)
+    {
+        if (target.bInUse)
+            stats.InUseCount++;
+        stats.Bytes += EstimateBytes(target.Framebuffer->GetDescription());
+    }
+
+    return stats;
+}
+
+bool KH_RenderTargetPool::SameFormats(const KH_FramebufferDescription& a, const KH_FramebufferDescription& b)
+{
+    const auto& lhs = a.Attachments.Attachments;
+    const auto& rhs = b.Attachments.Attachments;
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (lhs[i].Format != rhs[i].Format)
+            return false;
+    }
+    return true;
+}
+
+size_t KH_RenderTargetPool::EstimateBytes(const KH_FramebufferDescription& desc)
+{
+    size_t bytesPerPixel = 0;
+    for (const auto& attachment : desc.Attachments.Attachments)
+    {
+        switch (attachment.Format)
+        {
+        case KH_FramebufferTextureFormat::RGBA8:           bytesPerPixel += 4; break;
+        case KH_FramebufferTextureFormat::RGBA16F:         bytesPerPixel += 8; break;
+        case KH_FramebufferTextureFormat::RGBA32F:         bytesPerPixel += 16; break;
+        case KH_FramebufferTextureFormat::RG16F:           bytesPerPixel += 4; break;
+        case KH_FramebufferTextureFormat::R8:              bytesPerPixel += 1; break;
+        case KH_FramebufferTextureFormat::R32I:            bytesPerPixel += 4; break;
+        case KH_FramebufferTextureFormat::DEPTH24STENCIL8: bytesPerPixel += 4; break;
+        case KH_FramebufferTextureFormat::DEPTH32F:        bytesPerPixel += 4; break;
+        default: break;
+        }
+    }
+
+    return static_cast<size_t>(desc.Width) * desc.Height * bytesPerPixel;
+}
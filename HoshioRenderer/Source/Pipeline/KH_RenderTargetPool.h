@@ -0,0 +1,56 @@
+#pragma once
+
+#include "KH_Framebuffer.h"
+
+struct KH_RenderTargetPoolStats
+{
+    uint32_t TargetCount = 0;
+    uint32_t InUseCount = 0;
+    uint32_t Allocations = 0;
+    uint32_t Reuses = 0;
+    size_t Bytes = 0;
+};
+
+// 按尺寸与格式复用临时渲染目标：Acquire 优先返回空闲的同尺寸目标，
+// 其次把同格式的空闲目标 Resize 后复用；闲置超过 MaxIdleFrames 帧的目标被回收
+class KH_RenderTargetPool : public KH_Singleton<KH_RenderTargetPool>
+{
+    friend class KH_Singleton<KH_RenderTargetPool>;
+
+public:
+    static constexpr uint32_t MaxIdleFrames = 8;
+
+    KH_Framebuffer* Acquire(const KH_FramebufferDescription& desc);
+    void Release(KH_Framebuffer* framebuffer);
+
+    // 每帧开始时调用，回收长期闲置的目标
+    void BeginFrame();
+    void Clear();
+
+    KH_RenderTargetPoolStats GetStats() const;
+
+private:
+    KH_RenderTargetPool() = default;
+    ~KH_RenderTargetPool() override = default;
+
+    KH_RenderTargetPool(const KH_RenderTargetPool&) = delete;
+    KH_RenderTargetPool& operator=(const KH_RenderTargetPool&) = delete;
+
+    struct KH_PooledTarget
+    {
+        std::unique_ptr<KH_Framebuffer> Framebuffer;
+        bool bInUse = false;
+        uint64_t LastUsedFrame = 0;
+    };
+
+    static bool SameFormats(const KH_FramebufferDescription& a, const KH_FramebufferDescription& b);
+    static size_t EstimateBytes(const KH_FramebufferDescription& desc);
+
+    std::vector<KH_PooledTarget> Targets;
+    uint64_t FrameIndex = 0;
+
+    uint32_t FrameAllocations = 0;
+    uint32_t FrameReuses = 0;
+    uint32_t LastFrameAllocations = 0;
+    uint32_t LastFrameReuses = 0;
+};
@@ -1,11 +1,32 @@
 #include "KH_Shader.h"
+#include "KH_GLState.h"
 #include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Algorithms.h"
 #include "Editor/KH_Editor.h"
 
+namespace
+{
+    constexpr uint32_t kProgramBinaryMagic = 0x4250484B; // "KHPB"
+
+    struct KH_ProgramBinaryHeader
+    {
+        uint32_t Magic = kProgramBinaryMagic;
+        uint32_t Format = 0;
+        uint32_t Length = 0;
+        uint32_t Padding = 0;
+    };
+
+    double ElapsedMilliseconds(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+}
+
 KH_ShaderResource::~KH_ShaderResource()
 {
     if (ID != 0)
     {
+        KH_GLState::Instance().OnProgramDeleted(ID);
         glDeleteProgram(ID);
         ID = 0;
     }
@@ -18,11 +39,13 @@ KH_Shader::KH_Shader(std::shared_ptr<KH_ShaderResource> resource)
 
 bool KH_Shader::IsValid() const
 {
+    Resolve();
     return Resource != nullptr && Resource->ID != 0;
 }
 
 unsigned int KH_Shader::GetID() const
 {
+    Resolve();
     return Resource ? Resource->ID : 0;
 }
 
@@ -54,7 +77,7 @@ void KH_Shader::Use() const
     if (!IsValid())
         return;
 
-    glUseProgram(Resource->ID);
+    KH_GLState::Instance().UseProgram(Resource->ID);
 }
 
 void KH_Shader::SetInt(const std::string& name, int value) const
@@ -62,7 +85,7 @@ void KH_Shader::SetInt(const std::string& name, int value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform1i(location, value);
 }
 
@@ -71,7 +94,7 @@ void KH_Shader::SetUint(const std::string& name, uint32_t value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform1ui(location, value);
 }
 
@@ -80,7 +103,7 @@ void KH_Shader::SetFloat(const std::string& name, float value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform1f(location, value);
 }
 
@@ -89,7 +112,7 @@ void KH_Shader::SetMat4(const std::string& name, const glm::mat4& mat) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
 }
 
@@ -98,7 +121,7 @@ void KH_Shader::SetUvec2(const std::string& name, const glm::uvec2& value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform2uiv(location, 1, &value[0]);
 }
 
@@ -107,7 +130,7 @@ void KH_Shader::SetVec2(const std::string& name, const glm::vec2& value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform2fv(location, 1, &value[0]);
 }
 
@@ -116,7 +139,7 @@ void KH_Shader::SetVec3(const std::string& name, const glm::vec3& value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform3fv(location, 1, &value[0]);
 }
 
@@ -125,10 +148,30 @@ void KH_Shader::SetVec4(const std::string& name, const glm::vec4& value) const
     if (!IsValid())
         return;
 
-    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    GLint location = GetUniformLocation(name);
     glUniform4fv(location, 1, &value[0]);
 }
 
+void KH_Shader::Resolve() const
+{
+    if (Resource && Resource->bDeferred)
+    {
+        KH_ShaderManager::Instance().ResolveDeferred(*Resource);
+    }
+}
+
+GLint KH_Shader::GetUniformLocation(const std::string& name) const
+{
+    auto it = Resource->UniformLocations.find(name);
+    if (it != Resource->UniformLocations.end())
+        return it->second;
+
+    // 数组元素等未反射到的名字查询一次后记下，不存在的名字记为 -1
+    GLint location = glGetUniformLocation(Resource->ID, name.c_str());
+    Resource->UniformLocations.emplace(name, location);
+    return location;
+}
+
 void KH_Shader::PrintActiveUniform() const
 {
     if (!IsValid())
@@ -202,6 +245,117 @@ KH_Shader KH_ShaderManager::LoadComputeShader(const std::string& computePath)
     return KH_Shader(resource);
 }
 
+KH_Shader KH_ShaderManager::LoadComputeShaderFromSource(const std::string& source, const std::string& debugName)
+{
+    const std::string key = BuildComputeShaderKey(std::format("<generated:{}>{:x}", debugName, std::hash<std::string>{}(source)));
+
+    auto it = ShaderCache.find(key);
+    if (it != ShaderCache.end())
+    {
+        if (auto shared = it->second.lock())
+        {
+            return KH_Shader(shared);
+        }
+    }
+
+    unsigned int program = BuildProgramFromSources({ GL_COMPUTE_SHADER }, { source }, { debugName }, debugName,
+        std::chrono::steady_clock::now());
+    if (program == 0)
+    {
+        return KH_Shader();
+    }
+
+    auto resource = std::make_shared<KH_ShaderResource>();
+    resource->ID = program;
+    resource->Type = KH_SHADER_TYPE::COMPUTE;
+    resource->ComputePath = debugName;
+    ReflectUniforms(*resource);
+
+    ShaderCache[key] = resource;
+    return KH_Shader(resource);
+}
+
+KH_Shader KH_ShaderManager::DeferShader(const std::string& vertexPath, const std::string& fragmentPath)
+{
+    const std::string normalizedVertexPath = NormalizePath(vertexPath);
+    const std::string normalizedFragmentPath = NormalizePath(fragmentPath);
+    const std::string key = BuildGraphicsShaderKey(normalizedVertexPath, normalizedFragmentPath);
+
+    auto it = ShaderCache.find(key);
+    if (it != ShaderCache.end())
+    {
+        if (auto shared = it->second.lock())
+        {
+            return KH_Shader(shared);
+        }
+    }
+
+    auto resource = std::make_shared<KH_ShaderResource>();
+    resource->Type = KH_SHADER_TYPE::GRAPHICS;
+    resource->VertexPath = normalizedVertexPath;
+    resource->FragmentPath = normalizedFragmentPath;
+    resource->bDeferred = true;
+
+    ShaderCache[key] = resource;
+    return KH_Shader(resource);
+}
+
+KH_Shader KH_ShaderManager::LoadShaderVariant(const std::string& vertexPath, const std::string& fragmentPath,
+    const std::vector<std::string>& defines)
+{
+    const std::string normalizedVertexPath = NormalizePath(vertexPath);
+    const std::string normalizedFragmentPath = NormalizePath(fragmentPath);
+    const std::string key = BuildGraphicsShaderKey(normalizedVertexPath, normalizedFragmentPath) + BuildDefinesKey(defines);
+
+    auto it = ShaderCache.find(key);
+    if (it != ShaderCache.end())
+    {
+        if (auto shared = it->second.lock())
+        {
+            return KH_Shader(shared);
+        }
+    }
+
+    auto resource = std::make_shared<KH_ShaderResource>();
+    resource->Type = KH_SHADER_TYPE::GRAPHICS;
+    resource->VertexPath = normalizedVertexPath;
+    resource->FragmentPath = normalizedFragmentPath;
+    resource->Defines = defines;
+    resource->bDeferred = true;
+
+    ShaderCache[key] = resource;
+    return KH_Shader(resource);
+}
+
+bool KH_ShaderManager::ResolveDeferred(KH_ShaderResource& resource)
+{
+    if (!resource.bDeferred)
+        return resource.ID != 0;
+
+    // 失败后不再重试，避免每帧重复编译
+    resource.bDeferred = false;
+
+    if (resource.Type == KH_SHADER_TYPE::COMPUTE)
+    {
+        resource.ID = BuildProgram({ { GL_COMPUTE_SHADER, resource.ComputePath } }, resource.ComputePath, resource.Defines);
+    }
+    else
+    {
+        resource.ID = BuildProgram(
+            { { GL_VERTEX_SHADER, resource.VertexPath }, { GL_FRAGMENT_SHADER, resource.FragmentPath } },
+            std::format("{} + {}{}", resource.VertexPath, resource.FragmentPath, BuildDefinesKey(resource.Defines)),
+            resource.Defines);
+    }
+
+    ReflectUniforms(resource);
+    return resource.ID != 0;
+}
+
+const KH_ShaderLoadStats& KH_ShaderManager::GetLoadStats() const
+{
+    return LoadStats;
+}
+
 void KH_ShaderManager::GarbageCollect()
 {
     for (auto it = ShaderCache.begin(); it != ShaderCache.end();)
@@ -242,42 +396,24 @@ std::string KH_ShaderManager::BuildComputeShaderKey(const std::string& computePa
     return std::format("COMPUTE|{}", computePath);
 }
 
-std::shared_ptr<KH_ShaderResource> KH_ShaderManager::CreateGraphicsShaderResource(
-    const std::string& normalizedVertexPath,
-    const std::string& normalizedFragmentPath)
+std::string KH_ShaderManager::BuildDefinesKey(const std::vector<std::string>& defines) const
 {
-    std::string vertexCode;
-    std::string fragmentCode;
-
-    if (!ReadFileToString(normalizedVertexPath, vertexCode))
+    std::string key;
+    for (const std::string& define : defines)
     {
-        LOG_E(std::format("Failed to read vertex shader file: {}", normalizedVertexPath));
-        return nullptr;
-    }
-
-    if (!ReadFileToString(normalizedFragmentPath, fragmentCode))
-    {
-        LOG_E(std::format("Failed to read fragment shader file: {}", normalizedFragmentPath));
-        return nullptr;
-    }
-
-    unsigned int vertexShader = CompileShader(GL_VERTEX_SHADER, vertexCode.c_str(), normalizedVertexPath);
-    if (vertexShader == 0)
-        return nullptr;
-
-    unsigned int fragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentCode.c_str(), normalizedFragmentPath);
-    if (fragmentShader == 0)
-    {
-        glDeleteShader(vertexShader);
-        return nullptr;
+        key += "|" + define;
     }
+    return key;
+}
 
-    unsigned int program = LinkProgram({ vertexShader, fragmentShader },
+std::shared_ptr<KH_ShaderResource> KH_ShaderManager::CreateGraphicsShaderResource(
+    const std::string& normalizedVertexPath,
+    const std::string& normalizedFragmentPath)
+{
+    unsigned int program = BuildProgram(
+        { { GL_VERTEX_SHADER, normalizedVertexPath }, { GL_FRAGMENT_SHADER, normalizedFragmentPath } },
         std::format("{} + {}", normalizedVertexPath, normalizedFragmentPath));
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
     if (program == 0)
         return nullptr;
 
@@ -286,24 +422,13 @@ std::shared_ptr<KH_ShaderResource> KH_ShaderManager::CreateGraphicsShaderResourc
     resource->Type = KH_SHADER_TYPE::GRAPHICS;
     resource->VertexPath = normalizedVertexPath;
     resource->FragmentPath = normalizedFragmentPath;
+    ReflectUniforms(*resource);
     return resource;
 }
 
 std::shared_ptr<KH_ShaderResource> KH_ShaderManager::CreateComputeShaderResource(const std::string& normalizedComputePath)
 {
-    std::string computeCode;
-    if (!ReadFileToString(normalizedComputePath, computeCode))
-    {
-        LOG_E(std::format("Failed to read compute shader file: {}", normalizedComputePath));
-        return nullptr;
-    }
-
-    unsigned int computeShader = CompileShader(GL_COMPUTE_SHADER, computeCode.c_str(), normalizedComputePath);
-    if (computeShader == 0)
-        return nullptr;
-
-    unsigned int program = LinkProgram({ computeShader }, normalizedComputePath);
-    glDeleteShader(computeShader);
+    unsigned int program = BuildProgram({ { GL_COMPUTE_SHADER, normalizedComputePath } }, normalizedComputePath);
 
     if (program == 0)
         return nullptr;
@@ -312,9 +437,256 @@ std::shared_ptr<KH_ShaderResource> KH_ShaderManager::CreateComputeShaderResource
     resource->ID = program;
     resource->Type = KH_SHADER_TYPE::COMPUTE;
     resource->ComputePath = normalizedComputePath;
+    ReflectUniforms(*resource);
     return resource;
 }
 
+unsigned int KH_ShaderManager::BuildProgram(const std::vector<std::pair<GLenum, std::string>>& stages, const std::string& debugName,
+    const std::vector<std::string>& defines)
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::vector<std::string> sources(stages.size());
+    for (size_t i = 0; i < stages.size(); i++)
+    {
+        if (!ReadFileToString(stages[i].second, sources[i]))
+        {
+            LOG_E(std::format("Failed to read shader file: {}", stages[i].second));
+            return 0;
+        }
+    }
+
+    if (!defines.empty())
+    {
+        for (std::string& source : sources)
+            InjectDefines(source, defines);
+    }
+
+    std::vector<GLenum> types(stages.size());
+    std::vector<std::string> names(stages.size());
+    for (size_t i = 0; i < stages.size(); i++)
+    {
+        types[i] = stages[i].first;
+        names[i] = stages[i].second;
+    }
+
+    return BuildProgramFromSources(types, sources, names, debugName, begin);
+}
+
+unsigned int KH_ShaderManager::BuildProgramFromSources(const std::vector<GLenum>& types, const std::vector<std::string>& sources,
+    const std::vector<std::string>& names, const std::string& debugName, std::chrono::steady_clock::time_point begin)
+{
+    std::string cachePath;
+    if (IsBinaryCacheSupported())
+    {
+        cachePath = BuildBinaryCachePath(sources);
+
+        unsigned int program = LoadProgramBinary(cachePath);
+        if (program != 0)
+        {
+            const double elapsed = ElapsedMilliseconds(begin);
+            LoadStats.ProgramsFromCache++;
+            LoadStats.CacheLoadMilliseconds += elapsed;
+            LOG_D(std::format("Shader {} loaded from binary cache ({:.1f} ms)", debugName, elapsed));
+            return program;
+        }
+    }
+
+    std::vector<unsigned int> shaders;
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        unsigned int shader = CompileShader(types[i], sources[i].c_str(), names[i]);
+        if (shader == 0)
+        {
+            for (unsigned int compiled : shaders)
+                glDeleteShader(compiled);
+            return 0;
+        }
+        shaders.push_back(shader);
+    }
+
+    unsigned int program = LinkProgram(shaders, debugName);
+
+    for (unsigned int shader : shaders)
+        glDeleteShader(shader);
+
+    if (program == 0)
+        return 0;
+
+    if (!cachePath.empty())
+    {
+        SaveProgramBinary(program, cachePath);
+    }
+
+    const double elapsed = ElapsedMilliseconds(begin);
+    LoadStats.ProgramsCompiled++;
+    LoadStats.CompileMilliseconds += elapsed;
+    LOG_D(std::format("Shader {} compiled ({:.1f} ms)", debugName, elapsed));
+
+    return program;
+}
+
+void KH_ShaderManager::InjectDefines(std::string& source, const std::vector<std::string>& defines)
+{
+    std::string block;
+    for (const std::string& define : defines)
+    {
+        block += "#define " + define + "\n";
+    }
+
+    // #version 必须是第一条指令，宏插在它之后
+    size_t insertPos = 0;
+    const size_t versionPos = source.find("#version");
+    if (versionPos != std::string::npos)
+    {
+        const size_t lineEnd = source.find('\n', versionPos);
+        insertPos = (lineEnd == std::string::npos) ? source.size() : lineEnd + 1;
+    }
+
+    source.insert(insertPos, block);
+}
+
+void KH_ShaderManager::ReflectUniforms(KH_ShaderResource& resource)
+{
+    resource.UniformLocations.clear();
+    if (resource.ID == 0)
+        return;
+
+    GLint count = 0;
+    GLint maxLength = 0;
+    glGetProgramiv(resource.ID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(resource.ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::vector<char> name(std::max(maxLength, 1));
+    resource.UniformLocations.reserve(count);
+
+    for (GLint i = 0; i < count; ++i)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(resource.ID, i, static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+
+        // uniform block 成员没有位置
+        GLint location = glGetUniformLocation(resource.ID, name.data());
+        if (location < 0)
+            continue;
+
+        std::string uniformName(name.data(), length);
+        resource.UniformLocations.emplace(uniformName, location);
+
+        // 数组同时登记不带 [0] 的名字
+        if (uniformName.size() > 3 && uniformName.ends_with("[0]"))
+        {
+            resource.UniformLocations.emplace(uniformName.substr(0, uniformName.size() - 3), location);
+        }
+    }
+}
+
+bool KH_ShaderManager::IsBinaryCacheSupported()
+{
+    if (bBinaryCacheChecked)
+        return bBinaryCacheSupported;
+
+    bBinaryCacheChecked = true;
+
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount <= 0)
+    {
+        LOG_W("Driver exposes no program binary formats, shader binary cache disabled");
+        return bBinaryCacheSupported = false;
+    }
+
+    auto GLString = [](GLenum name)
+    {
+        const GLubyte* value = glGetString(name);
+        return value ? std::string(reinterpret_cast<const char*>(value)) : std::string();
+    };
+
+    DriverSignature = std::format("{}|{}|{}", GLString(GL_VENDOR), GLString(GL_RENDERER), GLString(GL_VERSION));
+
+    std::error_code ec;
+    std::filesystem::create_directories(BinaryCacheDirectory, ec);
+    if (ec)
+    {
+        LOG_W(std::format("Failed to create shader cache directory {}: {}", BinaryCacheDirectory, ec.message()));
+        return bBinaryCacheSupported = false;
+    }
+
+    return bBinaryCacheSupported = true;
+}
+
+std::string KH_ShaderManager::BuildBinaryCachePath(const std::vector<std::string>& sources)
+{
+    uint64_t hash = KH_Hash::FNV1a64(DriverSignature.data(), DriverSignature.size());
+    for (const std::string& source : sources)
+    {
+        const uint64_t size = source.size();
+        hash = KH_Hash::FNV1a64(&size, sizeof(size), hash);
+        hash = KH_Hash::FNV1a64(source.data(), source.size(), hash);
+    }
+
+    return std::format("{}/{:016x}.bin", BinaryCacheDirectory, hash);
+}
+
+unsigned int KH_ShaderManager::LoadProgramBinary(const std::string& cachePath) const
+{
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file.is_open())
+        return 0;
+
+    KH_ProgramBinaryHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.Magic != kProgramBinaryMagic || header.Length == 0)
+        return 0;
+
+    std::vector<char> binary(header.Length);
+    file.read(binary.data(), binary.size());
+    if (!file)
+        return 0;
+
+    unsigned int program = glCreateProgram();
+    glProgramBinary(program, header.Format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    // 驱动升级后旧二进制会被拒绝，回退到源码编译
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+void KH_ShaderManager::SaveProgramBinary(unsigned int program, const std::string& cachePath) const
+{
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOG_W(std::format("Failed to write shader binary cache: {}", cachePath));
+        return;
+    }
+
+    KH_ProgramBinaryHeader header;
+    header.Format = format;
+    header.Length = static_cast<uint32_t>(length);
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), binary.size());
+}
+
 bool KH_ShaderManager::ReadFileToString(const std::string& filePath, std::string& outCode) const
 {
     std::ifstream shaderFile;
@@ -379,6 +751,7 @@ unsigned int KH_ShaderManager::LinkProgram(const std::vector<unsigned int>& shad
         glAttachShader(program, shader);
     }
 
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(program);
 
     GLint success = 0;
@@ -449,43 +822,45 @@ KH_ExampleShaders::KH_ExampleShaders()
 
 void KH_ExampleShaders::InitShaders()
 {
+    const auto begin = std::chrono::steady_clock::now();
+
     auto& ShaderManager = KH_ShaderManager::Instance();
 
-    TestShader = ShaderManager.LoadShader("Assert/Shaders/test.vert", "Assert/Shaders/test.frag");
-    AABBShader = ShaderManager.LoadShader("Assert/Shaders/DrawAABBs.vert", "Assert/Shaders/DrawAABBs.frag");
-    TestCanvasShader = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/DefaultCanvas.frag");
-    RayTracingShader1_0 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_0.frag");
-    RayTracingShader1_1 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_1.frag");
-    RayTracingShader1_2 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_2.frag");
-    RayTracingShader1_3 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_3.frag");
-    RayTracingShader2_0 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_0.frag");
-    RayTracingShader2_1 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_1.frag");
-    RayTracingShader2_2 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_2.frag");
-    RayTracingShader2_3 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_3.frag");
-    RayTracingShader2_4 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_4.frag");
-    DisneyBRDF_0 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_0.frag");
-    DisneyBRDF_1 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_1.frag");
-    DisneyBRDF_2 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_2.frag");
-    DisneyBRDF_3 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_3.frag");
-    DisneyBRDF_4 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_4.frag");
-
-    BSSRDF_0 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_0.frag");
-    BSSRDF_1 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_1.frag");
-    BSSRDF_2 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_2.frag");
-    BSSRDF_3 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_3.frag");
-
-    DisneyBSDF_0 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_0.frag");
-    DisneyBSDF_1 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_1.frag");
-    DisneyBSDF_2 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_2.frag");
-    DisneyBSDF_3 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_3.frag");
-    DisneyBSDF_4 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_4.frag");
-    DisneyBSDF_5 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_5.frag");
-    DisneyBSDF_6 = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_6.frag");
-
-    GammaCorrectionShader = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/PostProcess/GammaCorrection.frag");
-    DrawSobolShader = ShaderManager.LoadShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/ScenePass/DrawSobol.frag");
-
-    LOG_D(std::format("All Shaders have been loaded."));
+    TestShader = ShaderManager.DeferShader("Assert/Shaders/test.vert", "Assert/Shaders/test.frag");
+    AABBShader = ShaderManager.DeferShader("Assert/Shaders/DrawAABBs.vert", "Assert/Shaders/DrawAABBs.frag");
+    TestCanvasShader = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/DefaultCanvas.frag");
+    RayTracingShader1_0 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_0.frag");
+    RayTracingShader1_1 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_1.frag");
+    RayTracingShader1_2 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_2.frag");
+    RayTracingShader1_3 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version1/RayTracing1_3.frag");
+    RayTracingShader2_0 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_0.frag");
+    RayTracingShader2_1 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_1.frag");
+    RayTracingShader2_2 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_2.frag");
+    RayTracingShader2_3 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_3.frag");
+    RayTracingShader2_4 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version2/RayTracing2_4.frag");
+    DisneyBRDF_0 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_0.frag");
+    DisneyBRDF_1 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_1.frag");
+    DisneyBRDF_2 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_2.frag");
+    DisneyBRDF_3 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_3.frag");
+    DisneyBRDF_4 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version3/DisneyBRDF_4.frag");
+
+    BSSRDF_0 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_0.frag");
+    BSSRDF_1 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_1.frag");
+    BSSRDF_2 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_2.frag");
+    BSSRDF_3 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version4/BSSRDF_3.frag");
+
+    DisneyBSDF_0 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_0.frag");
+    DisneyBSDF_1 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_1.frag");
+    DisneyBSDF_2 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_2.frag");
+    DisneyBSDF_3 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_3.frag");
+    DisneyBSDF_4 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_4.frag");
+    DisneyBSDF_5 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_5.frag");
+    DisneyBSDF_6 = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/RayTracing/Version5/DisneyBSDF_6.frag");
+
+    GammaCorrectionShader = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/PostProcess/GammaCorrection.frag");
+    DrawSobolShader = ShaderManager.DeferShader("Assert/Shaders/DefaultCanvas.vert", "Assert/Shaders/ScenePass/DrawSobol.frag");
+
+    LOG_D(std::format("All Shaders have been registered in {:.1f} ms, programs compile on first use.", ElapsedMilliseconds(begin)));
 }
 
 void KH_ExampleShaders::PrintShaderLoadMessage(std::string ShaderName)
@@ -18,6 +18,15 @@ struct KH_ShaderResource
     std::string FragmentPath;
     std::string ComputePath;
 
+    // 编译时注入的宏，形如 "KH_ENABLE_VNDF 1"
+    std::vector<std::string> Defines;
+
+    // 延迟编译：首次使用时才由 KH_ShaderManager 编译链接
+    bool bDeferred = false;
+
+    // 链接后反射得到的 uniform 位置，Set* 不再逐次 glGetUniformLocation
+    std::unordered_map<std::string, GLint> UniformLocations;
+
     ~KH_ShaderResource();
 };
 
@@ -55,9 +64,20 @@ public:
     void PrintActiveUniform() const;
 
 private:
+    void Resolve() const;
+    GLint GetUniformLocation(const std::string& name) const;
+
     std::shared_ptr<KH_ShaderResource> Resource;
 };
 
+struct KH_ShaderLoadStats
+{
+    uint32_t ProgramsCompiled = 0;
+    uint32_t ProgramsFromCache = 0;
+    double CompileMilliseconds = 0.0;
+    double CacheLoadMilliseconds = 0.0;
+};
+
 class KH_ShaderManager : public KH_Singleton<KH_ShaderManager>
 {
     friend class KH_Singleton<KH_ShaderManager>;
@@ -66,6 +86,20 @@ public:
     KH_Shader LoadShader(const std::string& vertexPath, const std::string& fragmentPath);
     KH_Shader LoadComputeShader(const std::string& computePath);
 
+    // 运行时生成的 compute shader（如融合后的后处理），按源码内容缓存
+    KH_Shader LoadComputeShaderFromSource(const std::string& source, const std::string& debugName);
+
+    // 只登记路径，首次 Use/Set*/GetID 时再编译
+    KH_Shader DeferShader(const std::string& vertexPath, const std::string& fragmentPath);
+
+    // 按宏组合缓存的变体，同样延迟编译
+    KH_Shader LoadShaderVariant(const std::string& vertexPath, const std::string& fragmentPath,
+        const std::vector<std::string>& defines);
+
+    bool ResolveDeferred(KH_ShaderResource& resource);
+
+    const KH_ShaderLoadStats& GetLoadStats() const;
+
     void GarbageCollect();
     void Clear();
 
@@ -79,10 +113,18 @@ private:
 private:
     std::unordered_map<std::string, std::weak_ptr<KH_ShaderResource>> ShaderCache;
 
+    KH_ShaderLoadStats LoadStats;
+
+    std::string BinaryCacheDirectory = "Cache/Shaders";
+    std::string DriverSignature;
+    bool bBinaryCacheChecked = false;
+    bool bBinaryCacheSupported = false;
+
 private:
     std::string NormalizePath(const std::string& path) const;
     std::string BuildGraphicsShaderKey(const std::string& vertexPath, const std::string& fragmentPath) const;
     std::string BuildComputeShaderKey(const std::string& computePath) const;
+    std::string BuildDefinesKey(const std::vector<std::string>& defines) const;
 
     std::shared_ptr<KH_ShaderResource> CreateGraphicsShaderResource(const std::string& normalizedVertexPath,
         const std::string& normalizedFragmentPath);
@@ -91,6 +133,21 @@ private:
 
     bool ReadFileToString(const std::string& filePath, std::string& outCode) const;
 
+    // 各阶段 (类型, 路径) -> program，优先读取 glProgramBinary 缓存
+    unsigned int BuildProgram(const std::vector<std::pair<GLenum, std::string>>& stages, const std::string& debugName,
+        const std::vector<std::string>& defines = {});
+
+    unsigned int BuildProgramFromSources(const std::vector<GLenum>& types, const std::vector<std::string>& sources,
+        const std::vector<std::string>& names, const std::string& debugName, std::chrono::steady_clock::time_point begin);
+
+    static void InjectDefines(std::string& source, const std::vector<std::string>& defines);
+    static void ReflectUniforms(KH_ShaderResource& resource);
+
+    bool IsBinaryCacheSupported();
+    std::string BuildBinaryCachePath(const std::vector<std::string>& sources);
+    unsigned int LoadProgramBinary(const std::string& cachePath) const;
+    void SaveProgramBinary(unsigned int program, const std::string& cachePath) const;
+
     unsigned int CompileShader(GLenum shaderType, const char* code, const std::string& debugName) const;
     unsigned int LinkProgram(const std::vector<unsigned int>& shaders, const std::string& debugName) const;
 
@@ -1,6 +1,6 @@
 #include "KH_ShaderFeature.h"
 
-#include "KH_ShaderFeature.h"
+bool KH_ShaderFeatureBase::bSpecializeShaders = true;
 
 KH_ShaderFeatureBase::KH_ShaderFeatureBase(KH_ShaderFeatureType type)
     : Type(type)
@@ -10,7 +10,7 @@ KH_ShaderFeatureBase::KH_ShaderFeatureBase(KH_ShaderFeatureType type)
 KH_ShaderFeatureBase::KH_ShaderFeatureBase(
     KH_ShaderFeatureType type,
     const KH_Shader& shader)
-    : Type(type), Shader(shader)
+    : Type(type), Shader(shader), BaseShader(shader)
 {
 }
 
@@ -42,4 +42,54 @@ void KH_ShaderFeatureBase::SetEnabled(bool enabled)
 void KH_ShaderFeatureBase::SetShader(const KH_Shader& shader)
 {
     Shader = shader;
+    BaseShader = shader;
+    Variants.clear();
+    ActiveVariantKey.clear();
+}
+
+void KH_ShaderFeatureBase::UpdatePermutation()
+{
+    const std::vector<std::string> Defines = bSpecializeShaders ? GetPermutationDefines() : std::vector<std::string>{};
+
+    std::string Key;
+    for (const std::string& Define : Defines)
+    {
+        Key += Define + ";";
+    }
+
+    if (Key == ActiveVariantKey)
+        return;
+
+    ActiveVariantKey = Key;
+
+    if (Defines.empty() || BaseShader.GetFragmentPath().empty())
+    {
+        Shader = BaseShader;
+        return;
+    }
+
+    auto it = Variants.find(Key);
+    if (it == Variants.end())
+    {
+        KH_Shader Variant = KH_ShaderManager::Instance().LoadShaderVariant(
+            BaseShader.GetVertexPath(), BaseShader.GetFragmentPath(), Defines);
+        it = Variants.emplace(Key, Variant).first;
+    }
+
+    Shader = it->second;
+}
+
+bool KH_ShaderFeatureBase::IsSpecializationEnabled()
+{
+    return bSpecializeShaders;
+}
+
+void KH_ShaderFeatureBase::SetSpecializationEnabled(bool bEnabled)
+{
+    bSpecializeShaders = bEnabled;
+}
+
+std::string KH_ShaderFeatureBase::MakeDefine(const char* Name, int Value)
+{
+    return std::format("{} {}", Name, Value);
 }
\ No newline at end of file
@@ -17,6 +17,14 @@ inline size_t KH_ShaderFeatureTypeToIndex(KH_ShaderFeatureType type)
     return static_cast<size_t>(type);
 }
 
+// 与编辑器面板上的复选框对应，离线渲染通过命令行设置；着色特性不支持的开关被忽略
+struct KH_ShaderFeatureToggles
+{
+    bool bEnableSkybox = false;
+    bool bEnableVNDF = false;
+    bool bEnableSobol = false;
+};
+
 class KH_ShaderFeatureBase
 {
 public:
@@ -34,13 +42,29 @@ public:
 
     // 每个 ShaderFeature 自己负责自己的材质缓存
     virtual void UploadMaterialBuffer() = 0;
+    // 材质数量不变时只写回单个材质
+    virtual void UploadMaterial(int materialID) = 0;
     virtual void BindBuffers() = 0;
     virtual void ClearMaterials() = 0;
     virtual int GetMaterialCount() const = 0;
     virtual bool DeleteMaterial(int materialID) = 0;
+    // 编码后材质数据的哈希，用于判断累积检查点是否仍与当前材质一致
+    virtual uint64_t ComputeMaterialHash() const = 0;
 
     virtual void Use();
 
+    virtual KH_ShaderFeatureToggles GetToggles() const { return {}; }
+    virtual void SetToggles(const KH_ShaderFeatureToggles& toggles) { (void)toggles; }
+
+    // 开关以宏的形式编进 shader，返回当前开关对应的宏；为空表示不做特化
+    virtual std::vector<std::string> GetPermutationDefines() const { return {}; }
+
+    // 按当前开关切换到对应的 shader 变体
+    void UpdatePermutation();
+
+    static bool IsSpecializationEnabled();
+    static void SetSpecializationEnabled(bool bEnabled);
+
     KH_ShaderFeatureType GetType() const;
 
     bool IsEnabled() const;
@@ -55,4 +79,14 @@ protected:
     KH_ShaderFeatureType Type;
     KH_Shader Shader;
     bool bEnabled = true;
+
+    static std::string MakeDefine(const char* Name, int Value);
+
+private:
+    // 未注入宏的原始 shader，开关通过 uniform 传入
+    KH_Shader BaseShader;
+    std::unordered_map<std::string, KH_Shader> Variants;
+    std::string ActiveVariantKey;
+
+    static bool bSpecializeShaders;
 };
\ No newline at end of file
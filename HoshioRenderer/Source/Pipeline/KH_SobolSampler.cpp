@@ -0,0 +1,26 @@
+#include "KH_SobolSampler.h"
+#include "Utils/KH_SobolTable.h"
+
+// 方向数表由 --export-sobol-table（KH_Sobol::ExportDirectionTable）离线生成，启动时直接上传
+KH_SobolSampler::KH_SobolSampler()
+{
+    DirectionNumbers_SSBO.SetBindPoint(6);
+
+    DimensionCount = std::min(KH_SOBOL_MAX_DIMENSIONS, KH_SOBOL_TABLE_DIMENSIONS);
+    DirectionNumbers_SSBO.SetData(KH_SobolDirectionTable, static_cast<size_t>(DimensionCount) * 32);
+}
+
+void KH_SobolSampler::Bind() const
+{
+    DirectionNumbers_SSBO.Bind();
+}
+
+bool KH_SobolSampler::IsValid() const
+{
+    return DimensionCount > 0;
+}
+
+uint32_t KH_SobolSampler::GetDimensionCount() const
+{
+    return DimensionCount;
+}
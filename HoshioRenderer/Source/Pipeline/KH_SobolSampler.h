@@ -0,0 +1,28 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "Pipeline/KH_Buffer.h"
+
+// 路径追踪中每次弹射固定使用的维度数，CPU 参考追踪器直接使用；DisneyBSDF_6.frag 的 SOBOL_DIMS_PER_BOUNCE 须与之一致
+#define KH_SOBOL_DIMS_PER_BOUNCE 8u
+#define KH_SOBOL_MAX_DIMENSIONS 128u
+
+class KH_SobolSampler : public KH_Singleton<KH_SobolSampler>
+{
+    friend class KH_Singleton<KH_SobolSampler>;
+
+private:
+    KH_SobolSampler();
+    ~KH_SobolSampler() override = default;
+
+    uint32_t DimensionCount = 0;
+
+    KH_SSBO<uint32_t> DirectionNumbers_SSBO;
+
+public:
+    void Bind() const;
+
+    bool IsValid() const;
+
+    uint32_t GetDimensionCount() const;
+};
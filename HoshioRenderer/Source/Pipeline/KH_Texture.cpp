@@ -1,171 +1,289 @@
 #include "KH_Texture.h"
+#include "KH_GLState.h"
 
 #include "Scene/KH_Scene.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image/stb_image.h"
 
 #include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Algorithms.h"
+#include "Utils/KH_JobSystem.h"
 
 
 namespace
 {
     constexpr float kEpsilon = 1e-8f;
 
-    float Luminance(float r, float g, float b)
-    {
-        return 0.2126f * r + 0.7152f * g + 0.0722f * b;
-    }
+    constexpr uint32_t kEnvAliasCacheMagic = 0x54414B48; // "HKAT"
+    constexpr uint32_t kEnvAliasCacheVersion = 1;
 
-    std::vector<float> BuildCDF(const std::vector<float>& pdf)
+    struct KH_EnvAliasCacheHeader
     {
-        std::vector<float> cdf(pdf.size(), 0.0f);
-        if (pdf.empty())
-            return cdf;
-
-        float accum = 0.0f;
-        for (size_t i = 0; i < pdf.size(); ++i)
-        {
-            accum += pdf[i];
-            cdf[i] = accum;
-        }
-
-        cdf.back() = 1.0f;
-        return cdf;
-    }
+        uint32_t Magic = kEnvAliasCacheMagic;
+        uint32_t Version = kEnvAliasCacheVersion;
+        uint64_t SourceSize = 0;
+        uint64_t SourceHash = 0;
+        int32_t Width = 0;
+        int32_t Height = 0;
+        int32_t FlipY = 0;
+        int32_t Padding = 0;
+    };
 
-    int SampleCDFIndex(float xi, const std::vector<float>& cdf)
+    float Luminance(float r, float g, float b)
     {
-        if (cdf.empty())
-            return 0;
-
-        xi = std::clamp(xi, 0.0f, 1.0f - 1e-7f);
-
-        auto it = std::lower_bound(cdf.begin(), cdf.end(), xi);
-        if (it == cdf.end())
-            return static_cast<int>(cdf.size()) - 1;
-
-        return static_cast<int>(std::distance(cdf.begin(), it));
+        return 0.2126f * r + 0.7152f * g + 0.0722f * b;
     }
 
-    float TexelCenter(int index, int resolution)
+    // 边缘分布表按行折叠到条件表之后，共 ceil(height / width) 行
+    int EnvAliasMarginalRows(int width, int height)
     {
-        return (static_cast<float>(index) + 0.5f) / static_cast<float>(resolution);
+        return (height + width - 1) / width;
     }
 
-    std::vector<glm::vec4> ComputeHDRCache(const float* data, int width, int height, int nrComponents)
+    // 纹理布局 width x (height + marginalRows)：
+    // 前 height 行为每行的条件 alias 表 (threshold, alias u, pdf(u,v), pdf(alias u,v))
+    // 之后为边缘 alias 表，第 v 项位于 (v % width, height + v / width)，存 (threshold, alias v, 0, 0)
+    std::vector<glm::vec4> BuildEnvAliasTable(const float* data, int width, int height, int nrComponents)
     {
         assert(data != nullptr);
         assert(width > 0 && height > 0);
         assert(nrComponents >= 3);
 
         const int nPixels = width * height;
-        std::vector<glm::vec4> hdrCache(nPixels, glm::vec4(0.0f));
+        const int marginalRows = EnvAliasMarginalRows(width, height);
 
-        std::vector<std::vector<float>> jointPdf(height, std::vector<float>(width, 0.0f));
-        std::vector<float> marginalPdfV(height, 0.0f);
+        std::vector<glm::vec4> table(static_cast<size_t>(width) * (height + marginalRows), glm::vec4(0.0f));
+        std::vector<float> weights(nPixels, 0.0f);
+        std::vector<float> rowWeights(height, 0.0f);
 
-        float totalWeight = 0.0f;
+        KH_JobSystem& jobSystem = KH_JobSystem::Instance();
 
-        for (int v = 0; v < height; ++v)
+        jobSystem.ParallelFor(0, height, 16, [&](uint32_t v)
         {
             const float theta = glm::pi<float>() * ((static_cast<float>(v) + 0.5f) / static_cast<float>(height));
             const float sinTheta = std::sin(theta);
 
-            float rowSum = 0.0f;
-
+            float* rowWeight = weights.data() + static_cast<size_t>(v) * width;
             for (int u = 0; u < width; ++u)
             {
-                const int offset = (v * width + u) * nrComponents;
-                const float lum = Luminance(data[offset], data[offset + 1], data[offset + 2]);
-
-                const float weight = lum * sinTheta;
-
-                //const float weight = lum;
-                jointPdf[v][u] = weight;
-                rowSum += weight;
+                const int offset = (static_cast<int>(v) * width + u) * nrComponents;
+                rowWeight[u] = Luminance(data[offset], data[offset + 1], data[offset + 2]) * sinTheta;
             }
+        });
 
-            marginalPdfV[v] = rowSum;
-            totalWeight += rowSum;
+        // 按行分块求和后按块序合并，结果与线程数无关
+        double totalWeight = jobSystem.ParallelReduce(0, height, 64, 0.0,
+            [&](uint32_t first, uint32_t last)
+            {
+                double sum = 0.0;
+                for (size_t i = static_cast<size_t>(first) * width; i < static_cast<size_t>(last) * width; ++i)
+                    sum += weights[i];
+                return sum;
+            },
+            [](double a, double b) { return a + b; });
+
+        // 全黑环境图退化为 uv 空间均匀采样
+        if (totalWeight <= kEpsilon)
+        {
+            std::fill(weights.begin(), weights.end(), 1.0f);
+            totalWeight = static_cast<double>(nPixels);
         }
 
-        if (totalWeight <= kEpsilon)
+        const float pdfScale = static_cast<float>(static_cast<double>(nPixels) / totalWeight);
+
+        jobSystem.ParallelFor(0, height, 16, [&](uint32_t v)
         {
-            float uniformPDF = 1.0f;
+            std::vector<float> threshold;
+            std::vector<uint32_t> alias;
 
-            for (int v = 0; v < height; ++v)
+            const float* rowWeight = weights.data() + static_cast<size_t>(v) * width;
+            rowWeights[v] = KH_AliasTable::Build(rowWeight, width, threshold, alias);
+
+            glm::vec4* row = table.data() + static_cast<size_t>(v) * width;
+            for (int u = 0; u < width; ++u)
             {
-                for (int u = 0; u < width; ++u)
-                {
-
-                    hdrCache[v * width + u] = glm::vec4(
-                        TexelCenter(u, width),
-                        TexelCenter(v, height),
-                        uniformPDF,
-                        uniformPDF
-                    );
-                }
+                row[u] = glm::vec4(
+                    threshold[u],
+                    static_cast<float>(alias[u]),
+                    rowWeight[u] * pdfScale,
+                    rowWeight[alias[u]] * pdfScale);
             }
-            return hdrCache;
+        });
+
+        std::vector<float> threshold;
+        std::vector<uint32_t> alias;
+        KH_AliasTable::Build(rowWeights.data(), height, threshold, alias);
+
+        for (int v = 0; v < height; ++v)
+        {
+            const size_t index = static_cast<size_t>(height + v / width) * width + v % width;
+            table[index] = glm::vec4(threshold[v], static_cast<float>(alias[v]), 0.0f, 0.0f);
         }
 
-        
-        for (float& p : marginalPdfV)
+        return table;
+    }
+
+    std::string EnvAliasCachePath(const std::string& hdrPath)
+    {
+        return hdrPath + ".alias";
+    }
+
+    // 命中时写回缓存中的宽高
+    bool LoadEnvAliasCache(const std::string& cachePath, KH_EnvAliasCacheHeader& expected, std::vector<glm::vec4>& table)
+    {
+        std::ifstream file(cachePath, std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        KH_EnvAliasCacheHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if (!file
+            || header.Magic != expected.Magic
+            || header.Version != expected.Version
+            || header.SourceSize != expected.SourceSize
+            || header.SourceHash != expected.SourceHash
+            || header.FlipY != expected.FlipY
+            || header.Width <= 0 || header.Height <= 0)
         {
-            p /= totalWeight;
+            return false;
         }
 
-        std::vector<std::vector<float>> conditionalPdfU(height, std::vector<float>(width, 0.0f));
+        const size_t count = static_cast<size_t>(header.Width) * (header.Height + EnvAliasMarginalRows(header.Width, header.Height));
+        table.resize(count);
+        file.read(reinterpret_cast<char*>(table.data()), count * sizeof(glm::vec4));
 
-        for (int v = 0; v < height; ++v)
+        if (!file)
         {
-            const float rowWeight = std::accumulate(jointPdf[v].begin(), jointPdf[v].end(), 0.0f);
+            table.clear();
+            return false;
+        }
 
-            if (rowWeight <= kEpsilon)
-            {
-                const float uniform = 1.0f / static_cast<float>(width);
-                std::fill(conditionalPdfU[v].begin(), conditionalPdfU[v].end(), uniform);
-            }
-            else
-            {
-                for (int u = 0; u < width; ++u)
-                {
-                    conditionalPdfU[v][u] = jointPdf[v][u] / rowWeight;
-                }
-            }
+        expected.Width = header.Width;
+        expected.Height = header.Height;
+        return true;
+    }
+
+    void SaveEnvAliasCache(const std::string& cachePath, const KH_EnvAliasCacheHeader& header, const std::vector<glm::vec4>& table)
+    {
+        std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_W(std::format("Failed to write HDR alias cache: {}", cachePath));
+            return;
         }
 
-        const std::vector<float> cdfV = BuildCDF(marginalPdfV);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(glm::vec4));
+    }
 
-        std::vector<std::vector<float>> cdfU(height);
-        for (int v = 0; v < height; ++v)
+    bool ReadFileBytes(const char* path, std::vector<unsigned char>& bytes)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+
+        const std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+
+        bytes.resize(static_cast<size_t>(size));
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), size));
+    }
+
+    // 解码 HDR 并准备重要性采样表；bKeepPixels 为 false 且命中 alias 缓存时跳过解码
+    bool DecodeHDRImage(const std::string& path, bool flipY, bool bKeepPixels, KH_HDRImage& image)
+    {
+        image.FileName = path;
+        image.bFlipY = flipY;
+
+        std::vector<unsigned char> fileBytes;
+        if (!ReadFileBytes(path.c_str(), fileBytes))
         {
-            cdfU[v] = BuildCDF(conditionalPdfU[v]);
+            LOG_E(std::format("HDR Texture failed to load at path: {}", path));
+            return false;
         }
 
-        const float stepU = 1.0f / static_cast<float>(width);
-        const float stepV = 1.0f / static_cast<float>(height);
+        KH_EnvAliasCacheHeader header;
+        header.SourceSize = fileBytes.size();
+        header.SourceHash = KH_Hash::FNV1a64(fileBytes.data(), fileBytes.size());
+        header.FlipY = flipY ? 1 : 0;
 
-        for (int y = 0; y < height; ++y)
+        const std::string cachePath = EnvAliasCachePath(path);
+        const bool bCacheHit = LoadEnvAliasCache(cachePath, header, image.ImportanceTable);
+
+        if (bCacheHit && !bKeepPixels)
         {
-            const float xi1 = (static_cast<float>(y) + 0.5f) * stepV;
-            const int sampledV = SampleCDFIndex(xi1, cdfV);
-            const float sampleV = TexelCenter(sampledV, height);
+            image.Width = header.Width;
+            image.Height = header.Height;
+            image.Channels = 4;
+            return true;
+        }
 
-            for (int x = 0; x < width; ++x)
-            {
-                const float xi2 = (static_cast<float>(x) + 0.5f) * stepU;
+        stbi_set_flip_vertically_on_load_thread(flipY);
 
-                const int sampledU = SampleCDFIndex(xi2, cdfU[sampledV]);
-                const float sampleU = TexelCenter(sampledU, width);
-                const float pdf_sampleUV = jointPdf[sampledV][sampledU] / totalWeight * nPixels;
-                const float pdf_realUV = jointPdf[y][x] / totalWeight * nPixels;
+        int nrComponents = 0;
+        float* data = stbi_loadf_from_memory(fileBytes.data(), static_cast<int>(fileBytes.size()),
+            &image.Width, &image.Height, &nrComponents, 0);
 
-                hdrCache[y * width + x] = glm::vec4(sampleU, sampleV, pdf_sampleUV, pdf_realUV);
-            }
+        if (!data)
+        {
+            LOG_E(std::format("HDR Texture failed to load at path: {}", path));
+            return false;
+        }
+
+        image.Channels = nrComponents;
+
+        if (!bCacheHit || header.Width != image.Width || header.Height != image.Height)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            image.ImportanceTable = BuildEnvAliasTable(data, image.Width, image.Height, nrComponents);
+            const auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            LOG_D(std::format("Built HDR alias table {}x{} in {:.1f} ms", image.Width, image.Height, elapsed));
+
+            header.Width = image.Width;
+            header.Height = image.Height;
+            SaveEnvAliasCache(cachePath, header, image.ImportanceTable);
         }
 
-        return hdrCache;
+        if (bKeepPixels)
+        {
+            image.Pixels.assign(data, data + static_cast<size_t>(image.Width) * image.Height * nrComponents);
+        }
+
+        stbi_image_free(data);
+        return true;
+    }
+
+    GLsizei TextureLevelCount(int width, int height, bool generateMipmap)
+    {
+        if (!generateMipmap)
+            return 1;
+
+        return static_cast<GLsizei>(std::floor(std::log2(static_cast<float>(std::max(width, height))))) + 1;
+    }
+
+    // 直接从 CPU 内存上传（同步拷贝，data 在返回后即可释放）；纹理存储需已由 glTextureStorage2D 分配
+    void UploadTexture2D(GLuint texture, int width, int height, GLenum dataFormat, const void* data)
+    {
+        glTextureSubImage2D(texture, 0, 0, 0, width, height, dataFormat, GL_FLOAT, data);
+    }
+
+    void SetTextureSampling(GLuint texture, GLenum wrap, bool generateMipmap)
+    {
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, wrap);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, wrap);
+
+        if (generateMipmap)
+        {
+            glGenerateTextureMipmap(texture);
+            glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        }
+        else
+        {
+            glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        }
+
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     }
 }
 
@@ -174,11 +292,17 @@ KH_TextureResource::~KH_TextureResource()
 {
     if (ID != 0)
     {
+        KH_GLState::Instance().OnTextureDeleted(ID);
         glDeleteTextures(1, &ID);
         ID = 0;
     }
 }
 
+bool KH_HDRImage::IsValid() const
+{
+    return Width > 0 && Height > 0 && !ImportanceTable.empty();
+}
+
 KH_Texture::KH_Texture(std::shared_ptr<KH_TextureResource> resource)
     : Resource(std::move(resource))
 {
@@ -220,13 +344,12 @@ void KH_Texture::Bind(uint32_t Unit) const
     if (!IsValid())
         return;
 
-    glActiveTexture(GL_TEXTURE0 + Unit);
-    glBindTexture(GL_TEXTURE_2D, Resource->ID);
+    KH_GLState::Instance().BindTextureUnit(Unit, Resource->ID);
 }
 
 void KH_Texture::Unbind() const
 {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    KH_GLState::Instance().BindTextureUnit(0, 0);
 }
 
 KH_Texture KH_TextureManager::LoadTexture(const std::string& filePath,
@@ -280,6 +403,71 @@ KH_Texture KH_TextureManager::CreateHDRCache(const std::string& filePath, bool g
     return KH_Texture(resource);
 }
 
+std::vector<glm::vec4> KH_TextureManager::BuildEnvImportanceTable(const float* data, int width, int height, int nrComponents)
+{
+    return BuildEnvAliasTable(data, width, height, nrComponents);
+}
+
+KH_HDRImage KH_TextureManager::DecodeHDR(const std::string& filePath, bool flipY) const
+{
+    KH_HDRImage image;
+    if (!DecodeHDRImage(NormalizePath(filePath), flipY, true, image))
+        return KH_HDRImage();
+    return image;
+}
+
+std::future<KH_HDRImage> KH_TextureManager::DecodeHDRAsync(const std::string& filePath, bool flipY) const
+{
+    return KH_JobSystem::Instance().Async([this, filePath, flipY]()
+    {
+        return DecodeHDR(filePath, flipY);
+    });
+}
+
+KH_Texture KH_TextureManager::CreateHDRTexture(const KH_HDRImage& image, bool generateMipmap)
+{
+    if (!image.IsValid() || image.Pixels.empty())
+        return KH_Texture();
+
+    auto resource = std::make_shared<KH_TextureResource>();
+    resource->FileName = image.FileName;
+    resource->Type = KH_TEXTURE_TYPE::HDR;
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &resource->ID);
+    if (resource->ID == 0)
+    {
+        LOG_E(std::format("glCreateTextures failed for path: {}", image.FileName));
+        return KH_Texture();
+    }
+
+    UploadHDRPixels(*resource, image, generateMipmap);
+
+    TextureCache[image.FileName] = resource;
+    return KH_Texture(resource);
+}
+
+KH_Texture KH_TextureManager::CreateHDRCache(const KH_HDRImage& image)
+{
+    if (!image.IsValid())
+        return KH_Texture();
+
+    auto resource = std::make_shared<KH_TextureResource>();
+    resource->FileName = image.FileName;
+    resource->Type = KH_TEXTURE_TYPE::HDR;
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &resource->ID);
+    if (resource->ID == 0)
+    {
+        LOG_E(std::format("glCreateTextures failed for path: {}", image.FileName));
+        return KH_Texture();
+    }
+
+    UploadHDRCache(*resource, image);
+
+    TextureCache[image.FileName + "-HDRCache"] = resource;
+    return KH_Texture(resource);
+}
+
 void KH_TextureManager::GarbageCollect()
 {
     for (auto it = TextureCache.begin(); it != TextureCache.end();)
@@ -318,11 +506,11 @@ std::shared_ptr<KH_TextureResource> KH_TextureManager::CreateTextureResource(con
     auto resource = std::make_shared<KH_TextureResource>();
     resource->FileName = normalizedPath;
 
-    glGenTextures(1, &resource->ID);
+    glCreateTextures(GL_TEXTURE_2D, 1, &resource->ID);
 
     if (resource->ID == 0)
     {
-        LOG_E(std::format("glGenTextures failed for path: {}", normalizedPath));
+        LOG_E(std::format("glCreateTextures failed for path: {}", normalizedPath));
         return nullptr;
     }
 
@@ -354,11 +542,11 @@ std::shared_ptr<KH_TextureResource> KH_TextureManager::CreateHDRCacheTextureReso
     auto resource = std::make_shared<KH_TextureResource>();
     resource->FileName = normalizedPath;
 
-    glGenTextures(1, &resource->ID);
+    glCreateTextures(GL_TEXTURE_2D, 1, &resource->ID);
 
     if (resource->ID == 0)
     {
-        LOG_E(std::format("glGenTextures failed for path: {}", normalizedPath));
+        LOG_E(std::format("glCreateTextures failed for path: {}", normalizedPath));
         return nullptr;
     }
 
@@ -433,23 +621,10 @@ void KH_TextureManager::LoadStandardTexture(KH_TextureResource& resource,
     resource.Channels = nrComponents;
 
 
-    glBindTexture(GL_TEXTURE_2D, resource.ID);
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, dataFormat, GL_UNSIGNED_BYTE, data);
+    glTextureStorage2D(resource.ID, TextureLevelCount(width, height, generateMipmap), internalFormat, width, height);
+    glTextureSubImage2D(resource.ID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-    if (generateMipmap)
-    {
-        glGenerateMipmap(GL_TEXTURE_2D);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    }
-    else
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    }
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    SetTextureSampling(resource.ID, GL_REPEAT, generateMipmap);
 
     stbi_image_free(data);
 }
@@ -481,43 +656,25 @@ void KH_TextureManager::LoadHDRTexture(KH_TextureResource& resource,
     resource.Height = height;
     resource.Channels = nrComponents;
 
-    glBindTexture(GL_TEXTURE_2D, resource.ID);
-
     GLenum dataFormat = (nrComponents == 4) ? GL_RGBA : GL_RGB;
     GLenum internalFormat = (nrComponents == 4) ? GL_RGBA32F : GL_RGB32F;
 
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, dataFormat, GL_FLOAT, data);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTextureStorage2D(resource.ID, TextureLevelCount(width, height, generateMipmap), internalFormat, width, height);
+    glTextureSubImage2D(resource.ID, 0, 0, 0, width, height, dataFormat, GL_FLOAT, data);
 
-    if (generateMipmap)
-    {
-        glGenerateMipmap(GL_TEXTURE_2D);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    }
-    else
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    }
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    SetTextureSampling(resource.ID, GL_CLAMP_TO_EDGE, generateMipmap);
 
     stbi_image_free(data);
 }
 
 void KH_TextureManager::CreateHDRCacheTexture(KH_TextureResource& resource, const char* path, bool generateMipmap, bool flipY) const
 {
-    stbi_set_flip_vertically_on_load(flipY);
-
-    int width = 0;
-    int height = 0;
-    int nrComponents = 0;
-    float* data = stbi_loadf(path, &width, &height, &nrComponents, 0);
+    // alias 表只能 texelFetch，不生成 mipmap
+    (void)generateMipmap;
 
-    if (!data)
+    KH_HDRImage image;
+    if (!DecodeHDRImage(path, flipY, false, image))
     {
-        LOG_E(std::format("HDR Texture failed to load at path: {}", path));
         if (resource.ID != 0)
         {
             glDeleteTextures(1, &resource.ID);
@@ -526,34 +683,39 @@ void KH_TextureManager::CreateHDRCacheTexture(KH_TextureResource& resource, cons
         return;
     }
 
-    resource.Width = width;
-    resource.Height = height;
-    resource.Channels = nrComponents;
+    UploadHDRCache(resource, image);
+}
 
-    std::vector<glm::vec4> hdrCache = ComputeHDRCache(data, width, height, nrComponents);
+void KH_TextureManager::UploadHDRPixels(KH_TextureResource& resource, const KH_HDRImage& image, bool generateMipmap) const
+{
+    resource.Width = image.Width;
+    resource.Height = image.Height;
+    resource.Channels = image.Channels;
 
-    glBindTexture(GL_TEXTURE_2D, resource.ID);
+    GLenum dataFormat = (image.Channels == 4) ? GL_RGBA : GL_RGB;
+    GLenum internalFormat = (image.Channels == 4) ? GL_RGBA32F : GL_RGB32F;
 
-    GLenum dataFormat = GL_RGBA;
-    GLenum internalFormat = GL_RGBA32F;
+    glTextureStorage2D(resource.ID, TextureLevelCount(image.Width, image.Height, generateMipmap), internalFormat, image.Width, image.Height);
+    UploadTexture2D(resource.ID, image.Width, image.Height, dataFormat, image.Pixels.data());
 
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, dataFormat, GL_FLOAT, hdrCache.data());
+    SetTextureSampling(resource.ID, GL_CLAMP_TO_EDGE, generateMipmap);
+}
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+void KH_TextureManager::UploadHDRCache(KH_TextureResource& resource, const KH_HDRImage& image) const
+{
+    resource.Width = image.Width;
+    resource.Height = image.Height;
+    resource.Channels = 4;
 
-    if (generateMipmap)
-    {
-        glGenerateMipmap(GL_TEXTURE_2D);
-    }
-    else
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    }
+    const int textureHeight = image.Height + EnvAliasMarginalRows(image.Width, image.Height);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureStorage2D(resource.ID, 1, GL_RGBA32F, image.Width, textureHeight);
+    UploadTexture2D(resource.ID, image.Width, textureHeight, GL_RGBA, image.ImportanceTable.data());
 
-    stbi_image_free(data);
+    glTextureParameteri(resource.ID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(resource.ID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(resource.ID, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(resource.ID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 }
 
 KH_ExampleTextures::KH_ExampleTextures()
@@ -563,16 +725,44 @@ KH_ExampleTextures::KH_ExampleTextures()
 
 void KH_ExampleTextures::InitTextures()
 {
-    SkyboxHDR = KH_TextureManager::Instance().LoadTexture(
-        "Assert/Images/HDR/qwantani_dusk_2_puresky_4k.hdr",
-        false,
-        KH_TEXTURE_TYPE::HDR,
-        true
-    );
-
-    SkyboxHDRCache = KH_TextureManager::Instance().CreateHDRCache(
-        "Assert/Images/HDR/qwantani_dusk_2_puresky_4k.hdr",
-        false,
-        true
-    );
+    KH_JobSystem& jobSystem = KH_JobSystem::Instance();
+    auto image = std::make_shared<KH_HDRImage>();
+
+    const KH_JobHandle decode = jobSystem.Schedule([image]()
+    {
+        *image = KH_TextureManager::Instance().DecodeHDR("Assert/Images/HDR/qwantani_dusk_2_puresky_4k.hdr", true);
+    }, KH_JobQueue::Background);
+
+    PendingSkybox = jobSystem.Schedule([this, image]()
+    {
+        if (!image->IsValid())
+        {
+            LOG_E("Skybox HDR failed to load, falling back to SkyColor");
+            return;
+        }
+
+        SkyboxHDR = KH_TextureManager::Instance().CreateHDRTexture(*image, false);
+        SkyboxHDRCache = KH_TextureManager::Instance().CreateHDRCache(*image);
+
+        LOG_D(std::format("Skybox HDR ready: {}", image->FileName));
+    }, KH_JobQueue::MainThread, { decode });
+}
+
+bool KH_ExampleTextures::Update()
+{
+    if (!PendingSkybox.IsValid() || !PendingSkybox.IsDone())
+        return false;
+
+    PendingSkybox = KH_JobHandle();
+    return IsSkyboxReady();
+}
+
+bool KH_ExampleTextures::IsSkyboxReady() const
+{
+    return SkyboxHDR.IsValid() && SkyboxHDRCache.IsValid();
+}
+
+bool KH_ExampleTextures::IsSkyboxPending() const
+{
+    return PendingSkybox.IsValid();
 }
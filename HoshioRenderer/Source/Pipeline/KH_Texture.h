@@ -1,6 +1,7 @@
 #pragma once
 
 #include "KH_Common.h"
+#include "Utils/KH_JobSystem.h"
 
 class KH_Shader;
 
@@ -27,6 +28,22 @@ struct KH_TextureResource
     ~KH_TextureResource();
 };
 
+// HDR 解码结果，辐射度纹理与重要性采样表共用同一次解码
+struct KH_HDRImage
+{
+    std::string FileName;
+    bool bFlipY = true;
+
+    int Width = 0;
+    int Height = 0;
+    int Channels = 0;
+
+    std::vector<float> Pixels;
+    std::vector<glm::vec4> ImportanceTable;
+
+    bool IsValid() const;
+};
+
 class KH_Texture
 {
 public:
@@ -63,6 +80,17 @@ public:
 
     KH_Texture CreateHDRCache(const std::string& filePath, bool generateMipmap = false, bool flipY = true);
 
+    // 解码 HDR 并构建重要性采样表，不访问 GL，可在任意线程调用
+    KH_HDRImage DecodeHDR(const std::string& filePath, bool flipY = true) const;
+    // 以后台任务执行 DecodeHDR
+    std::future<KH_HDRImage> DecodeHDRAsync(const std::string& filePath, bool flipY = true) const;
+    // 由 RGB(A) 辐射度构建 ImportanceTable（行条件与边缘 alias 表），不访问 GL
+    static std::vector<glm::vec4> BuildEnvImportanceTable(const float* data, int width, int height, int nrComponents);
+
+    // 主线程上传，经 PBO 传输
+    KH_Texture CreateHDRTexture(const KH_HDRImage& image, bool generateMipmap = false);
+    KH_Texture CreateHDRCache(const KH_HDRImage& image);
+
     void GarbageCollect();
     void Clear();
 
@@ -100,6 +128,9 @@ private:
         const char* path,
         bool generateMipmap,
         bool flipY) const;
+
+    void UploadHDRPixels(KH_TextureResource& resource, const KH_HDRImage& image, bool generateMipmap) const;
+    void UploadHDRCache(KH_TextureResource& resource, const KH_HDRImage& image) const;
 };
 
 
@@ -111,8 +142,18 @@ private:
     ~KH_ExampleTextures() override = default;
 
     void InitTextures();
+
+    // 后台解码 -> 渲染线程上传，上传任务依赖解码任务
+    KH_JobHandle PendingSkybox;
    
 public:
+    // 每帧在 RunMainThreadJobs 之后调用，上传完成的那一帧返回 true
+    bool Update();
+
+    bool IsSkyboxReady() const;
+    // 解码或上传尚未被 Update 取走
+    bool IsSkyboxPending() const;
+
     KH_Texture SkyboxHDR;
     KH_Texture SkyboxHDRCache;
 
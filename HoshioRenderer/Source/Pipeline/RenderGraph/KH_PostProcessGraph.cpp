@@ -1,34 +1,354 @@
 #include "KH_PostProcessGraph.h"
 
-#include "Editor/KH_Editor.h"
+#include "Pipeline/KH_RenderContext.h"
+#include "Pipeline/KH_RenderTargetPool.h"
+#include "Pipeline/KH_GLState.h"
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Profiler.h"
 
 #include "PostProcess/KH_GammaCorrectionPass.h"
 
-void KH_PostProcessGraph::AddPass(std::unique_ptr<KH_PostProcessPass> pass)
+namespace
 {
-	Passes.push_back(std::move(pass));
+    bool FusedImageFormat(KH_FramebufferTextureFormat format, const char*& outQualifier, GLenum& outFormat)
+    {
+        switch (format)
+        {
+        case KH_FramebufferTextureFormat::RGBA8:   outQualifier = "rgba8";   outFormat = GL_RGBA8;   return true;
+        case KH_FramebufferTextureFormat::RGBA16F: outQualifier = "rgba16f"; outFormat = GL_RGBA16F; return true;
+        case KH_FramebufferTextureFormat::RGBA32F: outQualifier = "rgba32f"; outFormat = GL_RGBA32F; return true;
+        case KH_FramebufferTextureFormat::RG16F:   outQualifier = "rg16f";   outFormat = GL_RG16F;   return true;
+        case KH_FramebufferTextureFormat::R8:      outQualifier = "r8";      outFormat = GL_R8;      return true;
+        default: return false;
+        }
+    }
+
+    std::string FusedPrefix(size_t index)
+    {
+        return std::format("KH_Fused{}_", index);
+    }
+}
+
+KH_PostProcessGraph::~KH_PostProcessGraph()
+{
+    if (TimerQueries[0] != 0)
+        glDeleteQueries(static_cast<GLsizei>(TimerQueries.size()), TimerQueries.data());
+}
+
+void KH_PostProcessGraph::AddPass(std::unique_ptr<KH_PostProcessPass> pass,
+    std::vector<std::string> inputs,
+    std::string output,
+    KH_FramebufferTextureFormat outputFormat)
+{
+    KH_PostProcessNode node;
+    node.Pass = std::move(pass);
+    node.Inputs = std::move(inputs);
+    node.Output = std::move(output);
+    node.OutputFormat = outputFormat;
+
+    if (OutputName.empty())
+        OutputName = node.Output;
+
+    Nodes.push_back(std::move(node));
+}
+
+void KH_PostProcessGraph::SetOutput(const std::string& name)
+{
+    OutputName = name;
 }
 
 void KH_PostProcessGraph::Execute()
 {
-    bool firstPass = true;
+    KH_PROFILE_GPU_SCOPE("PostProcess");
+
+    KH_RenderContext& context = KH_RenderContext::Current();
+    KH_RenderTargetPool& pool = KH_RenderTargetPool::Instance();
+
+    if (Presented)
+    {
+        pool.Release(Presented);
+        Presented = nullptr;
+    }
+
+    // 被禁用的 pass 把输出重定向到第一个输入
+    std::unordered_map<std::string, std::string> aliases;
+    for (const auto& node : Nodes)
+    {
+        if (!node.Pass->IsEnabled() && !node.Inputs.empty())
+            aliases[node.Output] = node.Inputs.front();
+    }
 
-    KH_Canvas& canvas = KH_Editor::Instance().GetCanvas();
+    auto resolve = [&aliases](std::string name) {
+        for (auto it = aliases.find(name); it != aliases.end(); it = aliases.find(name))
+            name = it->second;
+        return name;
+    };
 
-    for (auto& pass : Passes)
+    const std::string output = resolve(OutputName);
+
+    // 从输出反向标记存活的 pass
+    std::vector<bool> live(Nodes.size(), false);
+    std::unordered_set<std::string> needed = { output };
+    for (size_t i = Nodes.size(); i-- > 0;)
+    {
+        const auto& node = Nodes[i];
+        if (!node.Pass->IsEnabled() || !needed.contains(node.Output))
+            continue;
+
+        live[i] = true;
+        needed.erase(node.Output);
+        for (const auto& input : node.Inputs)
+            needed.insert(resolve(input));
+    }
+
+    std::unordered_map<std::string, size_t> lastUse;
+    std::unordered_map<std::string, uint32_t> readers;
+    for (size_t i = 0; i < Nodes.size(); ++i)
     {
-        if (!pass->IsEnabled())
+        if (!live[i])
             continue;
+        for (const auto& input : Nodes[i].Inputs)
+        {
+            lastUse[resolve(input)] = i;
+            readers[resolve(input)]++;
+        }
+    }
+
+    std::unordered_map<std::string, KH_Framebuffer*> targets;
+    std::unordered_set<std::string> pooled;
+    targets[KH_RG_SCENE_COLOR] = &context.GetSceneFramebuffer();
 
-        KH_Framebuffer& input = firstPass ? canvas.GetSceneFramebuffer()
-            : canvas.GetLastPostProcessFramebuffer();
-        KH_Framebuffer& output = canvas.GetCurrentPostProcessFramebuffer();
+    KH_FramebufferDescription desc;
+    const glm::uvec2 extent = context.GetRenderExtent();
+    desc.Width = extent.x;
+    desc.Height = extent.y;
 
-        pass->Execute(input, output);
+    LastExecutedPassCount = 0;
+    LastCulledPassCount = 0;
+    LastFusedPassCount = 0;
 
-        canvas.SwapPostProcessFramebuffers();
-        firstPass = false;
+    for (size_t i = 0; i < Nodes.size(); ++i)
+    {
+        if (Nodes[i].Pass->IsEnabled() && !live[i])
+            LastCulledPassCount++;
     }
+
+    BeginTimer();
+
+    for (size_t i = 0; i < Nodes.size(); ++i)
+    {
+        auto& node = Nodes[i];
+        if (!live[i])
+            continue;
+
+        // 收集从 i 开始的融合链：后一个 pass 只读前一个的输出，且该输出没有其他读者
+        std::vector<size_t> chain;
+        if (bFusionEnabled && IsFusable(node))
+        {
+            chain.push_back(i);
+            for (size_t k = i + 1; k < Nodes.size(); ++k)
+            {
+                if (!live[k])
+                    continue;
+
+                const auto& prev = Nodes[chain.back()];
+                const auto& next = Nodes[k];
+                if (!IsFusable(next) || resolve(next.Inputs.front()) != prev.Output ||
+                    readers[prev.Output] != 1 || prev.Output == output)
+                    break;
+
+                chain.push_back(k);
+            }
+        }
+
+        KH_Shader fusedShader;
+        if (!chain.empty())
+        {
+            fusedShader = GetFusedShader(chain);
+            if (!fusedShader.IsValid())
+            {
+                LOG_E("[PostProcessGraph] Failed to build fused post-process shader, falling back to per-pass rendering");
+                bFusionEnabled = false;
+                chain.clear();
+            }
+        }
+
+        const auto& last = chain.empty() ? node : Nodes[chain.back()];
+
+        std::vector<KH_Framebuffer*> inputs;
+        for (const auto& input : node.Inputs)
+        {
+            auto it = targets.find(resolve(input));
+            if (it == targets.end())
+            {
+                LOG_W(std::format("[PostProcessGraph] Pass '{}' reads undefined resource '{}'", node.Pass->GetName(), input));
+                break;
+            }
+            inputs.push_back(it->second);
+        }
+        if (inputs.size() != node.Inputs.size())
+            continue;
+
+        desc.Attachments = { last.OutputFormat };
+        KH_Framebuffer* target = pool.Acquire(desc);
+
+        KH_Profiler& profiler = KH_Profiler::Instance();
+        KH_PROFILE_GPU_SCOPE(profiler.IsEnabled()
+            ? profiler.InternName(chain.empty() ? node.Pass->GetName() : "Fused." + node.Pass->GetName())
+            : "");
+
+        if (chain.empty())
+        {
+            node.Pass->Execute(inputs, *target);
+            LastExecutedPassCount++;
+        }
+        else
+        {
+            ExecuteFused(chain, fusedShader, *inputs.front(), *target);
+            LastExecutedPassCount += static_cast<uint32_t>(chain.size());
+            LastFusedPassCount += static_cast<uint32_t>(chain.size());
+        }
+
+        const size_t lastIndex = chain.empty() ? i : chain.back();
+
+        // 写入后再归还最后一次被读取的输入，避免与本 pass 的输出共用同一目标
+        for (const auto& input : node.Inputs)
+        {
+            const std::string name = resolve(input);
+            if (pooled.contains(name) && lastUse[name] <= lastIndex)
+            {
+                pool.Release(targets[name]);
+                pooled.erase(name);
+                targets.erase(name);
+            }
+        }
+
+        if (pooled.contains(last.Output))
+            pool.Release(targets[last.Output]);
+
+        targets[last.Output] = target;
+        pooled.insert(last.Output);
+
+        i = lastIndex;
+    }
+
+    EndTimer();
+
+    KH_Framebuffer* result = nullptr;
+    if (auto it = targets.find(output); it != targets.end())
+        result = it->second;
+
+    for (const auto& name : pooled)
+    {
+        if (targets[name] != result)
+            pool.Release(targets[name]);
+    }
+
+    if (pooled.contains(output))
+        Presented = result;
+
+    context.SetPresentFramebuffer(result ? result : &context.GetSceneFramebuffer());
+}
+
+bool KH_PostProcessGraph::IsFusable(const KH_PostProcessNode& node)
+{
+    const char* qualifier = nullptr;
+    GLenum format = GL_NONE;
+    return node.Inputs.size() == 1 &&
+        FusedImageFormat(node.OutputFormat, qualifier, format) &&
+        !node.Pass->GetFusedSource(FusedPrefix(0)).empty();
+}
+
+KH_Shader KH_PostProcessGraph::GetFusedShader(const std::vector<size_t>& chain)
+{
+    std::string key;
+    for (size_t index : chain)
+        key += std::format("{},", index);
+
+    if (auto it = FusedShaders.find(key); it != FusedShaders.end())
+        return it->second;
+
+    const char* qualifier = nullptr;
+    GLenum format = GL_NONE;
+    FusedImageFormat(Nodes[chain.back()].OutputFormat, qualifier, format);
+
+    std::string source = std::format(R"(#version 460 core
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(binding = 0) uniform sampler2D uInput;
+layout({}, binding = 0) writeonly uniform image2D uOutput;
+)", qualifier);
+
+    std::string body;
+    for (size_t k = 0; k < chain.size(); ++k)
+    {
+        source += Nodes[chain[k]].Pass->GetFusedSource(FusedPrefix(k));
+        body += std::format("    color = {}(color);\n", FusedPrefix(k));
+    }
+
+    source += std::format(R"(
+void main()
+{{
+    const ivec2 pixel = ivec2(gl_GlobalInvocationID.xy);
+    if (any(greaterThanEqual(pixel, imageSize(uOutput))))
+        return;
+
+    vec4 color = texelFetch(uInput, pixel, 0);
+{}
+    imageStore(uOutput, pixel, color);
+}}
+)", body);
+
+    KH_Shader shader = KH_ShaderManager::Instance().LoadComputeShaderFromSource(source, "PostProcessFused[" + key + "]");
+    FusedShaders[key] = shader;
+    return shader;
+}
+
+void KH_PostProcessGraph::ExecuteFused(const std::vector<size_t>& chain, const KH_Shader& shader,
+    KH_Framebuffer& input, KH_Framebuffer& output)
+{
+    const char* qualifier = nullptr;
+    GLenum format = GL_NONE;
+    FusedImageFormat(Nodes[chain.back()].OutputFormat, qualifier, format);
+
+    shader.Use();
+    for (size_t k = 0; k < chain.size(); ++k)
+        Nodes[chain[k]].Pass->ApplyFusedUniforms(shader, FusedPrefix(k));
+
+    KH_GLState::Instance().BindTextureUnit(0, input.GetColorAttachmentID(0));
+    glBindImageTexture(0, output.GetColorAttachmentID(0), 0, GL_FALSE, 0, GL_WRITE_ONLY, format);
+
+    glDispatchCompute((output.GetWidth() + 7) / 8, (output.GetHeight() + 7) / 8, 1);
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+void KH_PostProcessGraph::BeginTimer()
+{
+    if (TimerQueries[0] == 0)
+        glCreateQueries(GL_TIME_ELAPSED, static_cast<GLsizei>(TimerQueries.size()), TimerQueries.data());
+
+    // 取回两帧前同一个查询的结果，尚未就绪时沿用上次的数值
+    const GLuint query = TimerQueries[TimerIndex];
+    if (TimerIssued[TimerIndex])
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available)
+        {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+            LastGpuMilliseconds = static_cast<double>(elapsed) / 1.0e6;
+        }
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, query);
+}
+
+void KH_PostProcessGraph::EndTimer()
+{
+    glEndQuery(GL_TIME_ELAPSED);
+    TimerIssued[TimerIndex] = true;
+    TimerIndex = (TimerIndex + 1) % static_cast<uint32_t>(TimerQueries.size());
 }
 
 KH_PostProcessHelper::KH_PostProcessHelper()
@@ -46,5 +366,6 @@ void KH_PostProcessHelper::InitSingleGammaCorrectionGraph()
     KH_Shader& Shader = KH_ExampleShaders::Instance().GammaCorrectionShader;
     auto GammaCorrection = std::make_unique<KH_GammaCorrectionPass>("GammaCorrection", Shader, 2.2);
 
-    SingleGammaCorrectionGraph.AddPass(std::move(GammaCorrection));
+    SingleGammaCorrectionGraph.AddPass(std::move(GammaCorrection), { KH_RG_SCENE_COLOR }, "FinalColor");
+    SingleGammaCorrectionGraph.SetOutput("FinalColor");
 }
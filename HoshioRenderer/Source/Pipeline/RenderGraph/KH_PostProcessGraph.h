@@ -1,18 +1,78 @@
 #pragma once
 
 #include "KH_PostProcessPass.h"
+#include "Pipeline/KH_Framebuffer.h"
 
 class KH_Canvas;
 
+// 图中始终可用的外部资源：当前帧的场景颜色
+inline const std::string KH_RG_SCENE_COLOR = "SceneColor";
+
+struct KH_PostProcessNode
+{
+    std::unique_ptr<KH_PostProcessPass> Pass;
+    std::vector<std::string> Inputs;
+    std::string Output;
+    KH_FramebufferTextureFormat OutputFormat = KH_FramebufferTextureFormat::RGBA8;
+};
+
+// 每个 pass 声明读取的资源与写入的资源，Execute 时从图输出反向裁剪掉无贡献的 pass，
+// 临时目标从 KH_RenderTargetPool 获取，最后一次被读取后立即归还，供后续 pass 复用
+// 被禁用的 pass 视为把第一个输入直接透传到输出
+// 开启融合时，相邻且一对一相连的逐像素 pass 合并为一次 compute dispatch，中间结果不落地
 class KH_PostProcessGraph
 {
 public:
-    void AddPass(std::unique_ptr<KH_PostProcessPass> pass);
+    KH_PostProcessGraph() = default;
+    ~KH_PostProcessGraph();
+
+    KH_PostProcessGraph(const KH_PostProcessGraph&) = delete;
+    KH_PostProcessGraph& operator=(const KH_PostProcessGraph&) = delete;
+
+    void AddPass(std::unique_ptr<KH_PostProcessPass> pass,
+        std::vector<std::string> inputs,
+        std::string output,
+        KH_FramebufferTextureFormat outputFormat = KH_FramebufferTextureFormat::RGBA8);
+
+    void SetOutput(const std::string& name);
 
     void Execute();
 
+    uint32_t GetLastExecutedPassCount() const { return LastExecutedPassCount; }
+    uint32_t GetLastCulledPassCount() const { return LastCulledPassCount; }
+    uint32_t GetLastFusedPassCount() const { return LastFusedPassCount; }
+
+    // 图的 GPU 耗时，取自两帧前的计时查询，不会阻塞
+    double GetLastGpuMilliseconds() const { return LastGpuMilliseconds; }
+
+    bool IsFusionEnabled() const { return bFusionEnabled; }
+    void SetFusionEnabled(bool bEnabled) { bFusionEnabled = bEnabled; }
+
 private:
-    std::vector<std::unique_ptr<KH_PostProcessPass>> Passes;
+    std::vector<KH_PostProcessNode> Nodes;
+    std::string OutputName;
+
+    bool bFusionEnabled = true;
+    std::unordered_map<std::string, KH_Shader> FusedShaders;
+
+    std::array<GLuint, 2> TimerQueries = {};
+    std::array<bool, 2> TimerIssued = {};
+    uint32_t TimerIndex = 0;
+    double LastGpuMilliseconds = 0.0;
+
+    static bool IsFusable(const KH_PostProcessNode& node);
+    KH_Shader GetFusedShader(const std::vector<size_t>& chain);
+    void ExecuteFused(const std::vector<size_t>& chain, const KH_Shader& shader, KH_Framebuffer& input, KH_Framebuffer& output);
+
+    void BeginTimer();
+    void EndTimer();
+
+    // 呈现到画布的池化目标，保留到下一次 Execute
+    KH_Framebuffer* Presented = nullptr;
+
+    uint32_t LastExecutedPassCount = 0;
+    uint32_t LastCulledPassCount = 0;
+    uint32_t LastFusedPassCount = 0;
 };
 
 
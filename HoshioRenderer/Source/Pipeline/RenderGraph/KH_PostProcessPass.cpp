@@ -1,6 +1,7 @@
 #include "KH_PostProcessPass.h"
 #include "Pipeline/KH_Shader.h"
 #include "Pipeline/KH_Framebuffer.h"
+#include "Pipeline/KH_GLState.h"
 
 #include "Scene/KH_Model.h"
 
@@ -24,6 +25,14 @@ void KH_PostProcessPass::SetEnabled(bool enabled)
 	Enabled = enabled;
 }
 
+void KH_PostProcessPass::Execute(const std::vector<KH_Framebuffer*>& Inputs, KH_Framebuffer& Output)
+{
+    if (Inputs.empty() || !Inputs.front())
+        return;
+
+    Execute(*Inputs.front(), Output);
+}
+
 void KH_PostProcessPass::Execute(KH_Framebuffer& Input, KH_Framebuffer& Output)
 {
     Output.Bind();
@@ -39,9 +48,17 @@ void KH_PostProcessPass::Execute(KH_Framebuffer& Input, KH_Framebuffer& Output)
     Output.Unbind();
 }
 
+std::string KH_PostProcessPass::GetFusedSource(const std::string& prefix) const
+{
+    return {};
+}
+
+void KH_PostProcessPass::ApplyFusedUniforms(const KH_Shader& FusedShader, const std::string& prefix) const
+{
+}
+
 void KH_PostProcessPass::RenderFullscreenQuad()
 {
-    glBindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
+    KH_GLState::Instance().BindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
     glDrawElements(GL_TRIANGLES, KH_DefaultModels::Instance().FullscreenQuad.GetNumIndices(), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
 }
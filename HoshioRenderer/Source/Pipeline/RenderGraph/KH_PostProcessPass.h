@@ -16,8 +16,15 @@ public:
     bool IsEnabled() const override;
     void SetEnabled(bool enabled);
 
+    // 多输入 pass 重写此版本，默认只读取第一个输入
+    virtual void Execute(const std::vector<KH_Framebuffer*>& Inputs, KH_Framebuffer& Output);
     virtual void Execute(KH_Framebuffer& Input, KH_Framebuffer& Output);
 
+    // 逐像素 pass 可返回一段 GLSL，定义 vec4 <prefix>(vec4 color)，uniform 也以 prefix 命名，
+    // 供 KH_PostProcessGraph 把相邻 pass 融合进一个 compute shader；返回空串表示不可融合
+    virtual std::string GetFusedSource(const std::string& prefix) const;
+    virtual void ApplyFusedUniforms(const KH_Shader& FusedShader, const std::string& prefix) const;
+
 protected:
     virtual void RenderFullscreenQuad();
 
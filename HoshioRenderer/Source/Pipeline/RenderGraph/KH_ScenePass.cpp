@@ -1,6 +1,7 @@
 #include "KH_ScenePass.h"
 #include "Pipeline/KH_Shader.h"
 #include "Pipeline/KH_Framebuffer.h"
+#include "Pipeline/KH_GLState.h"
 #include "Scene/KH_Model.h"
 
 KH_ScenePass::KH_ScenePass(const std::string& name, KH_Shader shader)
@@ -25,7 +26,6 @@ void KH_ScenePass::SetEnabled(bool enabled)
 
 void KH_ScenePass::RenderFullscreenQuad()
 {
-	glBindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
+	KH_GLState::Instance().BindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
 	glDrawElements(GL_TRIANGLES, KH_DefaultModels::Instance().FullscreenQuad.GetNumIndices(), GL_UNSIGNED_INT, 0);
-	glBindVertexArray(0);
 }
@@ -21,3 +21,23 @@ void KH_GammaCorrectionPass::Execute(KH_Framebuffer& Input, KH_Framebuffer& Outp
 
     Output.Unbind();
 }
+
+std::string KH_GammaCorrectionPass::GetFusedSource(const std::string& prefix) const
+{
+    // 与 GammaCorrection.frag 一致：ACES 色调映射后做 gamma 校正
+    return std::format(R"(
+uniform float {0}Gamma;
+
+vec4 {0}(vec4 color)
+{{
+    vec3 x = color.rgb;
+    x = clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);
+    return vec4(pow(x, vec3(1.0 / {0}Gamma)), 1.0);
+}}
+)", prefix);
+}
+
+void KH_GammaCorrectionPass::ApplyFusedUniforms(const KH_Shader& FusedShader, const std::string& prefix) const
+{
+    FusedShader.SetFloat(prefix + "Gamma", Gamma);
+}
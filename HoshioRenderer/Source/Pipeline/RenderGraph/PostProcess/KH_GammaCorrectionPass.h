@@ -10,7 +10,11 @@ public:
 
 	~KH_GammaCorrectionPass() override = default;
 
+	using KH_PostProcessPass::Execute;
 	void Execute(KH_Framebuffer& Input, KH_Framebuffer& Output) override;
 
+	std::string GetFusedSource(const std::string& prefix) const override;
+	void ApplyFusedUniforms(const KH_Shader& FusedShader, const std::string& prefix) const override;
+
 	float Gamma = 2.2;
 };
\ No newline at end of file
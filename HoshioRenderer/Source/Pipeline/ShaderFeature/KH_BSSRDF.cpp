@@ -1,5 +1,6 @@
 #include "KH_BSSRDF.h"
 #include "Editor/KH_Editor.h"
+#include "Utils/KH_Algorithms.h"
 
 KH_BSSRDF::KH_BSSRDF()
     : KH_ShaderFeatureBase(KH_ShaderFeatureType::BSSRDF)
@@ -33,19 +34,26 @@ const std::vector<KH_BSSRDFMaterial>& KH_BSSRDF::GetMaterials() const
     return Materials;
 }
 
+KH_BSSRDFMaterialEncoded KH_BSSRDF::EncodeMaterial(const KH_BSSRDFMaterial& mat)
+{
+    KH_BSSRDFMaterialEncoded encoded{};
+
+    encoded.Emissive = glm::vec4(mat.Emissive, 1.0f);
+    encoded.BaseColor = glm::vec4(mat.BaseColor, 1.0f);
+    encoded.Radius = glm::vec4(mat.Radius, 1.0f);
+    encoded.Eta = glm::vec2(mat.Eta, 0.0f);
+    encoded.Scale = glm::vec2(mat.Scale, 0.0f);
+
+    return encoded;
+}
+
 std::vector<KH_BSSRDFMaterialEncoded> KH_BSSRDF::EncodeMaterials() const
 {
     std::vector<KH_BSSRDFMaterialEncoded> encoded(Materials.size());
 
     for (size_t i = 0; i < Materials.size(); ++i)
     {
-        const KH_BSSRDFMaterial& mat = Materials[i];
-
-        encoded[i].Emissive = glm::vec4(mat.Emissive, 1.0f);
-        encoded[i].BaseColor = glm::vec4(mat.BaseColor, 1.0f);
-        encoded[i].Radius = glm::vec4(mat.Radius, 1.0f);
-        encoded[i].Eta = glm::vec2(mat.Eta, 0.0f);
-        encoded[i].Scale = glm::vec2(mat.Scale, 0.0f);
+        encoded[i] = EncodeMaterial(Materials[i]);
     }
 
     return encoded;
@@ -63,6 +71,20 @@ void KH_BSSRDF::UploadMaterialBuffer()
     Material_SSBO.SetData(encoded);
 }
 
+void KH_BSSRDF::UploadMaterial(int materialID)
+{
+    // 数量不变时只写回这一个材质
+    if (materialID < 0 || materialID >= static_cast<int>(Materials.size()) ||
+        Material_SSBO.GetCount() != Materials.size())
+    {
+        UploadMaterialBuffer();
+        return;
+    }
+
+    const KH_BSSRDFMaterialEncoded encoded = EncodeMaterial(Materials[materialID]);
+    Material_SSBO.Update(static_cast<size_t>(materialID), &encoded, 1);
+}
+
 void KH_BSSRDF::BindBuffers()
 {
     Material_SSBO.Bind();
@@ -89,11 +111,17 @@ bool KH_BSSRDF::DeleteMaterial(int materialID)
     return true;
 }
 
+uint64_t KH_BSSRDF::ComputeMaterialHash() const
+{
+    const std::vector<KH_BSSRDFMaterialEncoded> encoded = EncodeMaterials();
+    return KH_Hash::FNV1a64(encoded.data(), encoded.size() * sizeof(KH_BSSRDFMaterialEncoded));
+}
+
 void KH_BSSRDF::DrawControlPanel()
 {
     KH_Editor& Editor = KH_Editor::Instance();
 
-    static bool bEnableSkybox = false;
+    bool bEnableSkybox = EnableSkybox != 0;
 
     ImGui::SeparatorText("BSSRDF");
 
@@ -123,6 +151,15 @@ void KH_BSSRDF::ApplyUniforms()
     Shader.SetInt("uEnableSkybox", EnableSkybox);
 }
 
+std::vector<std::string> KH_BSSRDF::GetPermutationDefines() const
+{
+    const bool bSkyboxReady = KH_ExampleTextures::Instance().IsSkyboxReady();
+
+    return {
+        MakeDefine("KH_ENABLE_SKYBOX", bSkyboxReady ? EnableSkybox : 0)
+    };
+}
+
 float KH_BSSRDF::InvertCDF_Newton(float init_value, float xi)
 {
     float x = init_value;
@@ -153,6 +190,18 @@ void KH_BSSRDF::PrecomputeInvertCDF()
     InvertCDF_SSBO.SetData(table, GL_STATIC_DRAW);
 }
 
+KH_ShaderFeatureToggles KH_BSSRDF::GetToggles() const
+{
+    KH_ShaderFeatureToggles toggles;
+    toggles.bEnableSkybox = EnableSkybox != 0;
+    return toggles;
+}
+
+void KH_BSSRDF::SetToggles(const KH_ShaderFeatureToggles& toggles)
+{
+    SetEnableSkybox(toggles.bEnableSkybox);
+}
+
 void KH_BSSRDF::SetEnableSkybox(bool bEnable)
 {
     EnableSkybox = bEnable ? 1 : 0;
@@ -34,14 +34,20 @@ public:
 
     void DrawControlPanel() override;
     void ApplyUniforms() override;
+    std::vector<std::string> GetPermutationDefines() const override;
+    KH_ShaderFeatureToggles GetToggles() const override;
+    void SetToggles(const KH_ShaderFeatureToggles& toggles) override;
 
     void UploadMaterialBuffer() override;
+    void UploadMaterial(int materialID) override;
     void BindBuffers() override;
     void ClearMaterials() override;
     int GetMaterialCount() const override;
     bool DeleteMaterial(int materialID) override;
+    uint64_t ComputeMaterialHash() const override;
 
 private:
+    static KH_BSSRDFMaterialEncoded EncodeMaterial(const KH_BSSRDFMaterial& mat);
     std::vector<KH_BSSRDFMaterialEncoded> EncodeMaterials() const;
 
     float InvertCDF_Newton(float init_value, float xi);
@@ -52,7 +58,7 @@ private:
     int EnableSkybox = 0;
 
     std::vector<KH_BSSRDFMaterial> Materials;
-    KH_SSBO<KH_BSSRDFMaterialEncoded> Material_SSBO;
+    KH_PersistentSSBO<KH_BSSRDFMaterialEncoded> Material_SSBO{ 4, KH_BUFFER_FRAMES_IN_FLIGHT };
     KH_SSBO<float> InvertCDF_SSBO;
 
     void SetEnableSkybox(bool bEnable);
@@ -1,5 +1,6 @@
 #include "KH_DisneyBRDF.h"
 #include "Editor/KH_Editor.h"
+#include "Utils/KH_Algorithms.h"
 
 KH_DisneyBRDF::KH_DisneyBRDF()
     : KH_ShaderFeatureBase(KH_ShaderFeatureType::DisneyBRDF)
@@ -29,33 +30,40 @@ const std::vector<KH_BRDFMaterial>& KH_DisneyBRDF::GetMaterials() const
     return Materials;
 }
 
+KH_BRDFMaterialEncoded KH_DisneyBRDF::EncodeMaterial(const KH_BRDFMaterial& mat)
+{
+    KH_BRDFMaterialEncoded encoded{};
+
+    encoded.Emissive = glm::vec4(mat.Emissive, 1.0f);
+    encoded.BaseColor = glm::vec4(mat.BaseColor, 1.0f);
+    encoded.Param1 = glm::vec4(
+        mat.Subsurface,
+        mat.Metallic,
+        mat.Specular,
+        mat.SpecularTint);
+
+    encoded.Param2 = glm::vec4(
+        mat.Roughness,
+        mat.Anisotropic,
+        mat.Sheen,
+        mat.SheenTint);
+
+    encoded.Param3 = glm::vec4(
+        mat.Clearcoat,
+        mat.ClearcoatGloss,
+        0.0f,
+        0.0f);
+
+    return encoded;
+}
+
 std::vector<KH_BRDFMaterialEncoded> KH_DisneyBRDF::EncodeMaterials() const
 {
     std::vector<KH_BRDFMaterialEncoded> encoded(Materials.size());
 
     for (size_t i = 0; i < Materials.size(); ++i)
     {
-        const KH_BRDFMaterial& mat = Materials[i];
-
-        encoded[i].Emissive = glm::vec4(mat.Emissive, 1.0f);
-        encoded[i].BaseColor = glm::vec4(mat.BaseColor, 1.0f);
-        encoded[i].Param1 = glm::vec4(
-            mat.Subsurface,
-            mat.Metallic,
-            mat.Specular,
-            mat.SpecularTint);
-
-        encoded[i].Param2 = glm::vec4(
-            mat.Roughness,
-            mat.Anisotropic,
-            mat.Sheen,
-            mat.SheenTint);
-
-        encoded[i].Param3 = glm::vec4(
-            mat.Clearcoat,
-            mat.ClearcoatGloss,
-            0.0f,
-            0.0f);
+        encoded[i] = EncodeMaterial(Materials[i]);
     }
 
     return encoded;
@@ -73,6 +81,20 @@ void KH_DisneyBRDF::UploadMaterialBuffer()
     Material_SSBO.SetData(encoded);
 }
 
+void KH_DisneyBRDF::UploadMaterial(int materialID)
+{
+    // 数量不变时只写回这一个材质
+    if (materialID < 0 || materialID >= static_cast<int>(Materials.size()) ||
+        Material_SSBO.GetCount() != Materials.size())
+    {
+        UploadMaterialBuffer();
+        return;
+    }
+
+    const KH_BRDFMaterialEncoded encoded = EncodeMaterial(Materials[materialID]);
+    Material_SSBO.Update(static_cast<size_t>(materialID), &encoded, 1);
+}
+
 void KH_DisneyBRDF::BindBuffers()
 {
     Material_SSBO.Bind();
@@ -98,14 +120,20 @@ bool KH_DisneyBRDF::DeleteMaterial(int materialID)
     return true;
 }
 
+uint64_t KH_DisneyBRDF::ComputeMaterialHash() const
+{
+    const std::vector<KH_BRDFMaterialEncoded> encoded = EncodeMaterials();
+    return KH_Hash::FNV1a64(encoded.data(), encoded.size() * sizeof(KH_BRDFMaterialEncoded));
+}
+
 void KH_DisneyBRDF::DrawControlPanel()
 {
     KH_Editor& Editor = KH_Editor::Instance();
 
-    static bool bEnableSobol = false;
+    bool bEnableSobol = uEnableSobol != 0;
     static bool bEnableImportanceSampling = false;
     static bool bEnableMIS = false;
-    static bool bEnableSkybox = false;
+    bool bEnableSkybox = uEnableSkybox != 0;
     static int SelectedISMode = 0;
     static int PrevAllowSingleIS = uAllowSingleIS;
 
@@ -219,6 +247,36 @@ void KH_DisneyBRDF::ApplyUniforms()
     Shader.SetInt("uEnableClearcoatIS", uEnableClearcoatIS);
 }
 
+std::vector<std::string> KH_DisneyBRDF::GetPermutationDefines() const
+{
+    const bool bSkyboxReady = KH_ExampleTextures::Instance().IsSkyboxReady();
+
+    return {
+        MakeDefine("KH_ENABLE_SOBOL", uEnableSobol),
+        MakeDefine("KH_ENABLE_SKYBOX", bSkyboxReady ? uEnableSkybox : 0),
+        MakeDefine("KH_ENABLE_IMPORTANCE_SAMPLING", uEnableImportanceSampling),
+        MakeDefine("KH_ENABLE_MIS", uEnableMIS),
+        MakeDefine("KH_ALLOW_SINGLE_IS", uAllowSingleIS),
+        MakeDefine("KH_ENABLE_DIFFUSE_IS", uEnableDiffuseIS),
+        MakeDefine("KH_ENABLE_SPECULAR_IS", uEnableSpecularIS),
+        MakeDefine("KH_ENABLE_CLEARCOAT_IS", uEnableClearcoatIS)
+    };
+}
+
+KH_ShaderFeatureToggles KH_DisneyBRDF::GetToggles() const
+{
+    KH_ShaderFeatureToggles toggles;
+    toggles.bEnableSkybox = uEnableSkybox != 0;
+    toggles.bEnableSobol = uEnableSobol != 0;
+    return toggles;
+}
+
+void KH_DisneyBRDF::SetToggles(const KH_ShaderFeatureToggles& toggles)
+{
+    SetEnableSkybox(toggles.bEnableSkybox);
+    SetEnableSobol(toggles.bEnableSobol);
+}
+
 void KH_DisneyBRDF::SetEnableSobol(bool bEnable)
 {
     uEnableSobol = bEnable ? 1 : 0;
@@ -41,19 +41,25 @@ public:
 
     void DrawControlPanel() override;
     void ApplyUniforms() override;
+    std::vector<std::string> GetPermutationDefines() const override;
+    KH_ShaderFeatureToggles GetToggles() const override;
+    void SetToggles(const KH_ShaderFeatureToggles& toggles) override;
 
     void UploadMaterialBuffer() override;
+    void UploadMaterial(int materialID) override;
     void BindBuffers() override;
     void ClearMaterials() override;
     int GetMaterialCount() const override;
     bool DeleteMaterial(int materialID) override;
+    uint64_t ComputeMaterialHash() const override;
 
 private:
+    static KH_BRDFMaterialEncoded EncodeMaterial(const KH_BRDFMaterial& mat);
     std::vector<KH_BRDFMaterialEncoded> EncodeMaterials() const;
 
 private:
     std::vector<KH_BRDFMaterial> Materials;
-    KH_SSBO<KH_BRDFMaterialEncoded> Material_SSBO;
+    KH_PersistentSSBO<KH_BRDFMaterialEncoded> Material_SSBO{ 4, KH_BUFFER_FRAMES_IN_FLIGHT };
 
     int uEnableSobol = 0;
     int uEnableSkybox = 0;
@@ -1,5 +1,6 @@
 #include "KH_DisneyBSDF.h"
 #include "Editor/KH_Editor.h"
+#include "Utils/KH_Algorithms.h"
 
 KH_DisneyBSDF::KH_DisneyBSDF()
     : KH_ShaderFeatureBase(KH_ShaderFeatureType::DisneyBSDF)
@@ -29,33 +30,40 @@ const std::vector<KH_BSDFMaterial>& KH_DisneyBSDF::GetMaterials() const
     return Materials;
 }
 
+KH_BSDFMaterialEncoded KH_DisneyBSDF::EncodeMaterial(const KH_BSDFMaterial& mat)
+{
+    KH_BSDFMaterialEncoded encoded{};
+
+    encoded.Emissive = glm::vec4(mat.Emissive, 1.0f);
+    encoded.BaseColor = glm::vec4(mat.BaseColor, 1.0f);
+    encoded.Param1 = glm::vec4(
+        mat.Subsurface,
+        mat.Metallic,
+        mat.Specular,
+        mat.SpecularTint);
+
+    encoded.Param2 = glm::vec4(
+        mat.Roughness,
+        mat.Anisotropic,
+        mat.Sheen,
+        mat.SheenTint);
+
+    encoded.Param3 = glm::vec4(
+        mat.Clearcoat,
+        mat.ClearcoatGloss,
+        mat.IOR,
+        mat.Transmission);
+
+    return encoded;
+}
+
 std::vector<KH_BSDFMaterialEncoded> KH_DisneyBSDF::EncodeMaterials() const
 {
     std::vector<KH_BSDFMaterialEncoded> encoded(Materials.size());
 
     for (size_t i = 0; i < Materials.size(); ++i)
     {
-        const KH_BSDFMaterial& mat = Materials[i];
-
-        encoded[i].Emissive = glm::vec4(mat.Emissive, 1.0f);
-        encoded[i].BaseColor = glm::vec4(mat.BaseColor, 1.0f);
-        encoded[i].Param1 = glm::vec4(
-            mat.Subsurface,
-            mat.Metallic,
-            mat.Specular,
-            mat.SpecularTint);
-
-        encoded[i].Param2 = glm::vec4(
-            mat.Roughness,
-            mat.Anisotropic,
-            mat.Sheen,
-            mat.SheenTint);
-
-        encoded[i].Param3 = glm::vec4(
-            mat.Clearcoat,
-            mat.ClearcoatGloss,
-            mat.IOR,
-            mat.Transmission);
+        encoded[i] = EncodeMaterial(Materials[i]);
     }
 
     return encoded;
@@ -73,6 +81,20 @@ void KH_DisneyBSDF::UploadMaterialBuffer()
     Material_SSBO.SetData(encoded);
 }
 
+void KH_DisneyBSDF::UploadMaterial(int materialID)
+{
+    // 数量不变时只写回这一个材质
+    if (materialID < 0 || materialID >= static_cast<int>(Materials.size()) ||
+        Material_SSBO.GetCount() != Materials.size())
+    {
+        UploadMaterialBuffer();
+        return;
+    }
+
+    const KH_BSDFMaterialEncoded encoded = EncodeMaterial(Materials[materialID]);
+    Material_SSBO.Update(static_cast<size_t>(materialID), &encoded, 1);
+}
+
 void KH_DisneyBSDF::BindBuffers()
 {
     Material_SSBO.Bind();
@@ -98,12 +120,19 @@ bool KH_DisneyBSDF::DeleteMaterial(int materialID)
     return true;
 }
 
+uint64_t KH_DisneyBSDF::ComputeMaterialHash() const
+{
+    const std::vector<KH_BSDFMaterialEncoded> encoded = EncodeMaterials();
+    return KH_Hash::FNV1a64(encoded.data(), encoded.size() * sizeof(KH_BSDFMaterialEncoded));
+}
+
 void KH_DisneyBSDF::DrawControlPanel()
 {
     KH_Editor& Editor = KH_Editor::Instance();
 
-    static bool bEnableVNDF = false;
-    static bool bEnableSkybox = false;
+    bool bEnableVNDF = IsVNDFEnabled();
+    bool bEnableSkybox = IsSkyboxEnabled();
+    bool bEnableSobol = IsSobolEnabled();
 
 
     ImGui::SeparatorText("DisneyBSDF");
@@ -123,6 +152,11 @@ void KH_DisneyBSDF::DrawControlPanel()
         bNeedReset = true;
     }
 
+    if (ImGui::Checkbox("EnableSobol", &bEnableSobol))
+    {
+        bNeedReset = true;
+    }
+
 
     ImGui::Unindent(20.0f);
 
@@ -133,12 +167,37 @@ void KH_DisneyBSDF::DrawControlPanel()
 
     SetEnableVNDF(bEnableVNDF);
     SetEnableSkybox(bEnableSkybox);
+    SetEnableSobol(bEnableSobol);
 }
 
 void KH_DisneyBSDF::ApplyUniforms()
 {
     Shader.SetInt("uEnableVNDF", uEnableVNDF);
     Shader.SetInt("uEnableSkybox", uEnableSkybox);
+    Shader.SetInt("uEnableSobol", uEnableSobol);
+}
+
+std::vector<std::string> KH_DisneyBSDF::GetPermutationDefines() const
+{
+    const bool bSkyboxReady = KH_ExampleTextures::Instance().IsSkyboxReady();
+
+    return {
+        MakeDefine("KH_ENABLE_VNDF", uEnableVNDF),
+        MakeDefine("KH_ENABLE_SKYBOX", bSkyboxReady ? uEnableSkybox : 0),
+        MakeDefine("KH_ENABLE_SOBOL", uEnableSobol)
+    };
+}
+
+KH_ShaderFeatureToggles KH_DisneyBSDF::GetToggles() const
+{
+    return { IsSkyboxEnabled(), IsVNDFEnabled(), IsSobolEnabled() };
+}
+
+void KH_DisneyBSDF::SetToggles(const KH_ShaderFeatureToggles& toggles)
+{
+    SetEnableSkybox(toggles.bEnableSkybox);
+    SetEnableVNDF(toggles.bEnableVNDF);
+    SetEnableSobol(toggles.bEnableSobol);
 }
 
 void KH_DisneyBSDF::SetEnableVNDF(bool bEnable)
@@ -149,4 +208,9 @@ void KH_DisneyBSDF::SetEnableVNDF(bool bEnable)
 void KH_DisneyBSDF::SetEnableSkybox(bool bEnable)
 {
     uEnableSkybox = bEnable ? 1 : 0;
+}
+
+void KH_DisneyBSDF::SetEnableSobol(bool bEnable)
+{
+    uEnableSobol = bEnable ? 1 : 0;
 }
\ No newline at end of file
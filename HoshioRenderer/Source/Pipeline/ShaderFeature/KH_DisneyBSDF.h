@@ -44,23 +44,35 @@ public:
 
     void DrawControlPanel() override;
     void ApplyUniforms() override;
+    std::vector<std::string> GetPermutationDefines() const override;
+    KH_ShaderFeatureToggles GetToggles() const override;
+    void SetToggles(const KH_ShaderFeatureToggles& toggles) override;
 
     void UploadMaterialBuffer() override;
+    void UploadMaterial(int materialID) override;
     void BindBuffers() override;
     void ClearMaterials() override;
     int GetMaterialCount() const override;
     bool DeleteMaterial(int materialID) override;
+    uint64_t ComputeMaterialHash() const override;
+
+    bool IsVNDFEnabled() const { return uEnableVNDF != 0; }
+    bool IsSkyboxEnabled() const { return uEnableSkybox != 0; }
+    bool IsSobolEnabled() const { return uEnableSobol != 0; }
 
 private:
+    static KH_BSDFMaterialEncoded EncodeMaterial(const KH_BSDFMaterial& mat);
     std::vector<KH_BSDFMaterialEncoded> EncodeMaterials() const;
 
 private:
     std::vector<KH_BSDFMaterial> Materials;
-    KH_SSBO<KH_BSDFMaterialEncoded> Material_SSBO;
+    KH_PersistentSSBO<KH_BSDFMaterialEncoded> Material_SSBO{ 4, KH_BUFFER_FRAMES_IN_FLIGHT };
 
     int uEnableVNDF = 0;
     int uEnableSkybox = 0;
+    int uEnableSobol = 0;
 
     void SetEnableVNDF(bool bEnable);
     void SetEnableSkybox(bool bEnable);
+    void SetEnableSobol(bool bEnable);
 };
\ No newline at end of file
@@ -3,8 +3,35 @@
 #include "Editor/KH_Editor.h"
 #include "Pipeline/KH_Texture.h"
 #include "Pipeline/KH_Shader.h"
+#include "Pipeline/KH_GLState.h"
 
+namespace
+{
+    void DeleteMeshObjects(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO)
+    {
+        KH_GLState& State = KH_GLState::Instance();
 
+        if (VAO)
+        {
+            State.OnVertexArrayDeleted(VAO);
+            glDeleteVertexArrays(1, &VAO);
+        }
+
+        if (VBO)
+        {
+            State.OnBufferDeleted(VBO);
+            glDeleteBuffers(1, &VBO);
+        }
+
+        if (EBO)
+        {
+            State.OnBufferDeleted(EBO);
+            glDeleteBuffers(1, &EBO);
+        }
+
+        VAO = VBO = EBO = 0;
+    }
+}
 
 KH_Mesh::KH_Mesh(std::vector<KH_Vertex>& Vertices, std::vector<unsigned int>& Indices, std::vector<KH_Texture>& Textures, GLenum DrawMode)
 {
@@ -32,9 +59,7 @@ KH_Mesh& KH_Mesh::operator=(KH_Mesh&& other) noexcept
 {
     if (this != &other)
     {
-        if (VAO) glDeleteVertexArrays(1, &VAO);
-        if (VBO) glDeleteBuffers(1, &VBO);
-        if (EBO) glDeleteBuffers(1, &EBO);
+        DeleteMeshObjects(VAO, VBO, EBO);
 
         Vertices = std::move(other.Vertices);
         Indices = std::move(other.Indices);
@@ -57,9 +82,7 @@ KH_Mesh& KH_Mesh::operator=(KH_Mesh&& other) noexcept
 
 KH_Mesh::~KH_Mesh()
 {
-    if (VAO) glDeleteVertexArrays(1, &VAO);
-    if (VBO) glDeleteBuffers(1, &VBO);
-    if (EBO) glDeleteBuffers(1, &EBO);
+    DeleteMeshObjects(VAO, VBO, EBO);
 }
 
 void KH_Mesh::Create(std::vector<KH_Vertex>& Vertices, std::vector<unsigned int>& Indices, std::vector<KH_Texture>& Textures, GLenum DrawMode)
@@ -73,6 +96,17 @@ void KH_Mesh::Create(std::vector<KH_Vertex>& Vertices, std::vector<unsigned int>
     SetupMesh();
 }
 
+void KH_Mesh::Create(std::vector<KH_Vertex>&& Vertices, std::vector<unsigned int>&& Indices, std::vector<KH_Texture>&& Textures, const KH_AABB& LocalAABB, GLenum DrawMode)
+{
+    this->Vertices = std::move(Vertices);
+    this->Indices = std::move(Indices);
+    this->Textures = std::move(Textures);
+    this->LocalAABB = LocalAABB;
+
+    SetDrawMode(DrawMode);
+    SetupMesh();
+}
+
 void KH_Mesh::SetDrawMode(GLenum DrawMode)
 {
     this->DrawMode = DrawMode;
@@ -95,15 +129,12 @@ void KH_Mesh::Render(KH_Shader& Shader)
             number = std::to_string(specularNr++);
 
 
-        glActiveTexture(GL_TEXTURE0 + i); 
         Shader.SetInt(("Material." + name + number).c_str(), i);
-        glBindTexture(GL_TEXTURE_2D, Textures[i].GetID());
+        Textures[i].Bind(i);
     }
-    glActiveTexture(GL_TEXTURE0);
 
-    glBindVertexArray(VAO);
+    KH_GLState::Instance().BindVertexArray(VAO);
     glDrawElements(DrawMode, Indices.size(), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
 }
 
 const unsigned int KH_Mesh::GetVAO() const
@@ -128,7 +159,9 @@ uint32_t KH_Mesh::GetPrimitiveCount() const
 }
 
 void KH_Mesh::EncodePrimitives(
-    std::vector<KH_PrimitiveEncoded>& outPrimitives,
+    KH_PrimitiveEncoded* outPrimitives,
+    uint32_t FirstPrimitive,
+    uint32_t Count,
     const glm::mat4& ModelMatrix,
     const glm::mat3& NormalMatrix,
     KH_ShaderFeatureType ShaderFeatureType) const
@@ -138,8 +171,10 @@ void KH_Mesh::EncodePrimitives(
 
     const int MaterialSlotID = GetMaterialSlotID(ShaderFeatureType);
 
-    for (size_t i = 0; i + 2 < Indices.size(); i += 3)
+    const size_t End = std::min<size_t>(static_cast<size_t>(FirstPrimitive) + Count, GetPrimitiveCount());
+    for (size_t t = FirstPrimitive; t < End; ++t)
     {
+        const size_t i = t * 3;
         const KH_Vertex& v0 = Vertices[Indices[i]];
         const KH_Vertex& v1 = Vertices[Indices[i + 1]];
         const KH_Vertex& v2 = Vertices[Indices[i + 2]];
@@ -164,7 +199,7 @@ void KH_Mesh::EncodePrimitives(
         primitive.PrimitiveType = glm::ivec2(static_cast<int>(KH_PrimitiveType::Triangle), 0);
         primitive.MaterialSlotID = glm::ivec2(MaterialSlotID, 0);
 
-        outPrimitives.push_back(primitive);
+        outPrimitives[t - FirstPrimitive] = primitive;
     }
 }
 
@@ -242,6 +277,11 @@ const std::vector<unsigned int>& KH_Mesh::GetIndices() const
     return Indices;
 }
 
+const std::vector<KH_Texture>& KH_Mesh::GetTextures() const
+{
+    return Textures;
+}
+
 GLenum KH_Mesh::GetDrawMode() const
 {
     return DrawMode;
@@ -292,29 +332,27 @@ KH_PickResult KH_Mesh::Pick(
 
 void KH_Mesh::SetupMesh()
 {
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-    glBufferData(GL_ARRAY_BUFFER, Vertices.size() * sizeof(KH_Vertex), Vertices.data(), GL_STATIC_DRAW);
+    glCreateVertexArrays(1, &VAO);
+    glCreateBuffers(1, &VBO);
+    glCreateBuffers(1, &EBO);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, Indices.size() * sizeof(unsigned int),
-        Indices.data(), GL_STATIC_DRAW);
+    glNamedBufferData(VBO, Vertices.size() * sizeof(KH_Vertex), Vertices.data(), GL_STATIC_DRAW);
+    glNamedBufferData(EBO, Indices.size() * sizeof(unsigned int), Indices.data(), GL_STATIC_DRAW);
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(KH_Vertex), (void*)0);
+    glVertexArrayVertexBuffer(VAO, 0, VBO, 0, sizeof(KH_Vertex));
+    glVertexArrayElementBuffer(VAO, EBO);
 
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(KH_Vertex), (void*)offsetof(KH_Vertex, Normal));
+    glEnableVertexArrayAttrib(VAO, 0);
+    glVertexArrayAttribFormat(VAO, 0, 3, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(VAO, 0, 0);
 
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(KH_Vertex), (void*)offsetof(KH_Vertex, UV));
+    glEnableVertexArrayAttrib(VAO, 1);
+    glVertexArrayAttribFormat(VAO, 1, 3, GL_FLOAT, GL_FALSE, offsetof(KH_Vertex, Normal));
+    glVertexArrayAttribBinding(VAO, 1, 0);
 
-    glBindVertexArray(0);
+    glEnableVertexArrayAttrib(VAO, 2);
+    glVertexArrayAttribFormat(VAO, 2, 2, GL_FLOAT, GL_FALSE, offsetof(KH_Vertex, UV));
+    glVertexArrayAttribBinding(VAO, 2, 0);
 }
 
 void KH_Mesh::UpdateLocalAABB()
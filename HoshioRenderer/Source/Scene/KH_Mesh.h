@@ -52,12 +52,15 @@ public:
     const KH_AABB& GetLocalAABB() const;
     const std::vector<KH_Vertex>& GetVertices() const;
     const std::vector<unsigned int>& GetIndices() const;
+    const std::vector<KH_Texture>& GetTextures() const;
     GLenum GetDrawMode() const;
 
     int GetMaterialSlotID(KH_ShaderFeatureType ShaderFeatureType) const;
     void SetMaterialSlotID(KH_ShaderFeatureType ShaderFeatureType, int InMaterialSlotID);
 
     void Create(std::vector<KH_Vertex>& Vertices, std::vector<unsigned int>& Indices, std::vector<KH_Texture>& Textures, GLenum DrawMode = GL_TRIANGLES);
+    // 数据与包围盒已就绪（如来自网格缓存）时直接接管，不再拷贝与重算包围盒
+    void Create(std::vector<KH_Vertex>&& Vertices, std::vector<unsigned int>&& Indices, std::vector<KH_Texture>&& Textures, const KH_AABB& LocalAABB, GLenum DrawMode = GL_TRIANGLES);
     void SetDrawMode(GLenum DrawMode);
 
     KH_PickResult Pick(
@@ -66,8 +69,11 @@ public:
         const glm::mat3& NormalMatrix,
         KH_ShaderFeatureType ShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF) const;
 
+    // 编码第 [FirstPrimitive, FirstPrimitive + Count) 个三角形，写入 outPrimitives
     void EncodePrimitives(
-        std::vector<KH_PrimitiveEncoded>& outPrimitives,
+        KH_PrimitiveEncoded* outPrimitives,
+        uint32_t FirstPrimitive,
+        uint32_t Count,
         const glm::mat4& ModelMatrix,
         const glm::mat3& NormalMatrix,
         KH_ShaderFeatureType ShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF) const;
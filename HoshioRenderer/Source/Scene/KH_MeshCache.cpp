@@ -0,0 +1,264 @@
+#include "KH_MeshCache.h"
+
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Algorithms.h"
+#include "Utils/KH_MappedFile.h"
+
+namespace
+{
+    constexpr uint32_t kMeshCacheMagic = 0x434D4B48; // "HKMC"
+    constexpr uint32_t kMeshCacheVersion = 1;
+    constexpr uint64_t kMeshCacheAlignment = 16;
+
+    struct KH_MeshCacheHeader
+    {
+        uint32_t Magic = kMeshCacheMagic;
+        uint32_t Version = kMeshCacheVersion;
+        uint64_t SourceSize = 0;
+        uint64_t SourceHash = 0;
+        uint64_t ImportKey = 0;
+        uint32_t VertexStride = sizeof(KH_Vertex);
+        uint32_t MeshCount = 0;
+    };
+
+    struct KH_MeshCacheRecord
+    {
+        uint64_t VertexOffset = 0;
+        uint64_t IndexOffset = 0;
+        uint64_t TextureOffset = 0;
+        uint32_t VertexCount = 0;
+        uint32_t IndexCount = 0;
+        uint32_t TextureCount = 0;
+        uint32_t DrawMode = GL_TRIANGLES;
+        float MinPos[3] = {};
+        float MaxPos[3] = {};
+    };
+
+    // 贴图表项：类型 + 路径长度，紧跟路径字节
+    struct KH_MeshCacheTexture
+    {
+        uint32_t Type = 0;
+        uint32_t PathLength = 0;
+    };
+
+    uint64_t AlignUp(uint64_t value)
+    {
+        return (value + kMeshCacheAlignment - 1) & ~(kMeshCacheAlignment - 1);
+    }
+
+    bool InRange(size_t fileSize, uint64_t offset, uint64_t count, uint64_t stride)
+    {
+        return offset <= fileSize && count <= (fileSize - offset) / stride;
+    }
+}
+
+bool KH_MeshCache::MakeKey(const std::string& sourcePath, uint64_t importKey, KH_MeshCacheKey& outKey) const
+{
+    if (!bEnabled)
+        return false;
+
+    KH_MappedFile source;
+    if (!source.Open(sourcePath))
+        return false;
+
+    outKey.SourceSize = source.GetSize();
+    outKey.SourceHash = KH_Hash::FNV1a64(source.GetData(), source.GetSize());
+    outKey.ImportKey = importKey;
+    outKey.CachePath = std::format("{}/{}_{:016x}_{:016x}.khmesh", Directory,
+        std::filesystem::path(sourcePath).stem().string(), outKey.SourceHash, importKey);
+    return true;
+}
+
+bool KH_MeshCache::Load(const KH_MeshCacheKey& key, const std::string& textureDirectory, std::vector<KH_CookedMesh>& outMeshes) const
+{
+    KH_MappedFile file;
+    if (!file.Open(key.CachePath))
+        return false;
+
+    const unsigned char* data = file.GetData();
+    const size_t size = file.GetSize();
+
+    KH_MeshCacheHeader header;
+    if (size < sizeof(header))
+        return false;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.Magic != kMeshCacheMagic
+        || header.Version != kMeshCacheVersion
+        || header.VertexStride != sizeof(KH_Vertex)
+        || header.SourceSize != key.SourceSize
+        || header.SourceHash != key.SourceHash
+        || header.ImportKey != key.ImportKey)
+    {
+        return false;
+    }
+
+    if (!InRange(size, sizeof(header), header.MeshCount, sizeof(KH_MeshCacheRecord)))
+    {
+        LOG_W(std::format("Mesh cache is truncated: {}", key.CachePath));
+        return false;
+    }
+
+    std::vector<KH_CookedMesh> meshes(header.MeshCount);
+
+    for (uint32_t meshIndex = 0; meshIndex < header.MeshCount; ++meshIndex)
+    {
+        KH_MeshCacheRecord record;
+        std::memcpy(&record, data + sizeof(header) + meshIndex * sizeof(record), sizeof(record));
+
+        if (!InRange(size, record.VertexOffset, record.VertexCount, sizeof(KH_Vertex))
+            || !InRange(size, record.IndexOffset, record.IndexCount, sizeof(unsigned int))
+            || !InRange(size, record.TextureOffset, record.TextureCount, sizeof(KH_MeshCacheTexture)))
+        {
+            LOG_W(std::format("Mesh cache is truncated: {}", key.CachePath));
+            return false;
+        }
+
+        KH_CookedMesh& mesh = meshes[meshIndex];
+
+        mesh.Vertices.resize(record.VertexCount);
+        std::memcpy(mesh.Vertices.data(), data + record.VertexOffset, mesh.Vertices.size() * sizeof(KH_Vertex));
+
+        mesh.Indices.resize(record.IndexCount);
+        std::memcpy(mesh.Indices.data(), data + record.IndexOffset, mesh.Indices.size() * sizeof(unsigned int));
+
+        uint64_t cursor = record.TextureOffset;
+        for (uint32_t textureIndex = 0; textureIndex < record.TextureCount; ++textureIndex)
+        {
+            KH_MeshCacheTexture entry;
+            if (!InRange(size, cursor, 1, sizeof(entry)))
+                return false;
+            std::memcpy(&entry, data + cursor, sizeof(entry));
+            cursor += sizeof(entry);
+
+            if (!InRange(size, cursor, entry.PathLength, 1))
+                return false;
+            const std::string relativePath(reinterpret_cast<const char*>(data + cursor), entry.PathLength);
+            cursor += entry.PathLength;
+
+            const std::filesystem::path fullPath = std::filesystem::path(textureDirectory) / relativePath;
+            mesh.Textures.push_back({ static_cast<KH_TEXTURE_TYPE>(entry.Type), fullPath.string() });
+        }
+
+        mesh.LocalAABB.MinPos = glm::vec3(record.MinPos[0], record.MinPos[1], record.MinPos[2]);
+        mesh.LocalAABB.MaxPos = glm::vec3(record.MaxPos[0], record.MaxPos[1], record.MaxPos[2]);
+        mesh.DrawMode = static_cast<GLenum>(record.DrawMode);
+    }
+
+    outMeshes = std::move(meshes);
+    return true;
+}
+
+bool KH_MeshCache::Save(const KH_MeshCacheKey& key, const std::string& textureDirectory, const std::vector<KH_CookedMesh>& meshes) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(Directory, error);
+    if (error)
+    {
+        LOG_W(std::format("Failed to create mesh cache directory {}: {}", Directory, error.message()));
+        return false;
+    }
+
+    KH_MeshCacheHeader header;
+    header.SourceSize = key.SourceSize;
+    header.SourceHash = key.SourceHash;
+    header.ImportKey = key.ImportKey;
+    header.MeshCount = static_cast<uint32_t>(meshes.size());
+
+    // 先排布所有段的偏移，再顺序写出
+    std::vector<KH_MeshCacheRecord> records(meshes.size());
+    std::vector<std::vector<std::pair<uint32_t, std::string>>> texturePaths(meshes.size());
+    uint64_t offset = AlignUp(sizeof(header) + records.size() * sizeof(KH_MeshCacheRecord));
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        const KH_CookedMesh& mesh = meshes[i];
+        KH_MeshCacheRecord& record = records[i];
+
+        record.VertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+        record.IndexCount = static_cast<uint32_t>(mesh.Indices.size());
+        record.DrawMode = mesh.DrawMode;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            record.MinPos[axis] = mesh.LocalAABB.MinPos[axis];
+            record.MaxPos[axis] = mesh.LocalAABB.MaxPos[axis];
+        }
+
+        record.VertexOffset = offset;
+        offset = AlignUp(offset + record.VertexCount * sizeof(KH_Vertex));
+        record.IndexOffset = offset;
+        offset = AlignUp(offset + record.IndexCount * sizeof(unsigned int));
+
+        record.TextureOffset = offset;
+        for (const KH_CookedTexture& texture : mesh.Textures)
+        {
+            const std::filesystem::path relative = std::filesystem::path(texture.Path).lexically_relative(textureDirectory);
+            const std::string path = relative.empty() ? texture.Path : relative.generic_string();
+
+            texturePaths[i].emplace_back(static_cast<uint32_t>(texture.Type), path);
+            offset += sizeof(KH_MeshCacheTexture) + path.size();
+        }
+        record.TextureCount = static_cast<uint32_t>(texturePaths[i].size());
+        offset = AlignUp(offset);
+    }
+
+    const std::string tempPath = key.CachePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_W(std::format("Failed to write mesh cache: {}", tempPath));
+            return false;
+        }
+
+        const char padding[kMeshCacheAlignment] = {};
+        auto PadTo = [&](uint64_t target)
+        {
+            const uint64_t position = static_cast<uint64_t>(file.tellp());
+            if (target > position)
+                file.write(padding, static_cast<std::streamsize>(target - position));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(KH_MeshCacheRecord));
+
+        for (size_t i = 0; i < meshes.size(); ++i)
+        {
+            const KH_CookedMesh& mesh = meshes[i];
+            const KH_MeshCacheRecord& record = records[i];
+
+            PadTo(record.VertexOffset);
+            file.write(reinterpret_cast<const char*>(mesh.Vertices.data()), record.VertexCount * sizeof(KH_Vertex));
+            PadTo(record.IndexOffset);
+            file.write(reinterpret_cast<const char*>(mesh.Indices.data()), record.IndexCount * sizeof(unsigned int));
+            PadTo(record.TextureOffset);
+
+            for (const auto& [type, path] : texturePaths[i])
+            {
+                KH_MeshCacheTexture entry;
+                entry.Type = type;
+                entry.PathLength = static_cast<uint32_t>(path.size());
+                file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+                file.write(path.data(), path.size());
+            }
+        }
+
+        PadTo(offset);
+
+        if (!file)
+        {
+            LOG_W(std::format("Failed to write mesh cache: {}", tempPath));
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, key.CachePath, error);
+    if (error)
+    {
+        LOG_W(std::format("Failed to replace mesh cache {}: {}", key.CachePath, error.message()));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "KH_Mesh.h"
+#include "Pipeline/KH_Texture.h"
+
+struct KH_CookedTexture
+{
+    KH_TEXTURE_TYPE Type = KH_TEXTURE_TYPE::DEFAULT;
+    std::string Path;
+};
+
+// 导入后、上传前的网格数据，不持有任何 GL 对象
+struct KH_CookedMesh
+{
+    std::vector<KH_Vertex> Vertices;
+    std::vector<unsigned int> Indices;
+    std::vector<KH_CookedTexture> Textures;
+    KH_AABB LocalAABB;
+    GLenum DrawMode = GL_TRIANGLES;
+};
+
+struct KH_MeshCacheKey
+{
+    std::string CachePath;
+    uint64_t SourceSize = 0;
+    uint64_t SourceHash = 0;
+    uint64_t ImportKey = 0;
+};
+
+// 烘焙后的网格缓存：Assimp 后处理的结果（顶点、索引、局部包围盒、材质贴图）按源文件内容哈希与
+// 导入参数落盘，再次载入时映射文件直接取出，跳过解析与后处理。
+// 顶点/索引段 16 字节对齐，布局与 KH_Vertex 一致，可直接从映射内存拷贝。不触碰 GL，可在工作线程调用
+class KH_MeshCache : public KH_Singleton<KH_MeshCache>
+{
+    friend class KH_Singleton<KH_MeshCache>;
+
+public:
+    bool IsEnabled() const { return bEnabled; }
+    void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+    const std::string& GetDirectory() const { return Directory; }
+
+    // 散列源文件内容；缓存关闭或源文件不可读时返回 false
+    bool MakeKey(const std::string& sourcePath, uint64_t importKey, KH_MeshCacheKey& outKey) const;
+
+    // 贴图路径相对 textureDirectory 存储与解析
+    bool Load(const KH_MeshCacheKey& key, const std::string& textureDirectory, std::vector<KH_CookedMesh>& outMeshes) const;
+    bool Save(const KH_MeshCacheKey& key, const std::string& textureDirectory, const std::vector<KH_CookedMesh>& meshes) const;
+
+private:
+    KH_MeshCache() = default;
+    ~KH_MeshCache() override = default;
+
+    KH_MeshCache(const KH_MeshCache&) = delete;
+    KH_MeshCache& operator=(const KH_MeshCache&) = delete;
+
+    bool bEnabled = true;
+    std::string Directory = "Cache/Meshes";
+};
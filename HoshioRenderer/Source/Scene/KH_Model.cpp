@@ -3,6 +3,7 @@
 #include "Hit/KH_Ray.h"
 #include "Pipeline/KH_Shader.h"
 #include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_Algorithms.h"
 
 
 KH_Model::KH_Model(const std::string& path)
@@ -69,6 +70,15 @@ void KH_Model::SetMeshMaterialSlotID(KH_ShaderFeatureType ShaderFeatureType, int
 
 
 void KH_Model::LoadModel(const std::string& path)
+{
+    SetSourceAsAsset(path);
+
+    KH_ModelImport import;
+    if (ImportModel(path, import))
+        ApplyImport(std::move(import));
+}
+
+void KH_Model::SetSourceAsAsset(const std::string& path)
 {
     SourceType = KH_ModelSourceType::Asset;
     BuiltinType = KH_BuiltinModelType::None;
@@ -76,12 +86,15 @@ void KH_Model::LoadModel(const std::string& path)
     BuiltinSectorCount = 64;
     BuiltinStackCount = 32;
     SourcePath = path;
+}
 
-    Assimp::Importer import;
-
-	import.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_NORMALS);
+bool KH_Model::ImportModel(const std::string& path, KH_ModelImport& outImport)
+{
+    const auto start = std::chrono::steady_clock::now();
 
-	import.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, 80.0f);
+    // 导入参数参与缓存键，改动任意一项都会重新烘焙
+    const int removeComponents = aiComponent_NORMALS;
+    const float smoothingAngle = 80.0f;
 
     const unsigned int flags =
         aiProcess_Triangulate |
@@ -91,19 +104,76 @@ void KH_Model::LoadModel(const std::string& path)
         aiProcess_GenSmoothNormals |
         aiProcess_CalcTangentSpace;
 
+    uint64_t importKey = KH_Hash::FNV1a64(&flags, sizeof(flags));
+    importKey = KH_Hash::FNV1a64(&removeComponents, sizeof(removeComponents), importKey);
+    importKey = KH_Hash::FNV1a64(&smoothingAngle, sizeof(smoothingAngle), importKey);
+
+    outImport.SourcePath = path;
+    outImport.Directory = std::filesystem::path(path).parent_path().string();
+    outImport.Meshes.clear();
+    outImport.bFromCache = false;
+
+    KH_MeshCache& cache = KH_MeshCache::Instance();
+    KH_MeshCacheKey cacheKey;
+    const bool bCacheable = cache.MakeKey(path, importKey, cacheKey);
+
+    if (bCacheable && cache.Load(cacheKey, outImport.Directory, outImport.Meshes))
+    {
+        outImport.bFromCache = true;
+        outImport.ImportMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    Assimp::Importer import;
+
+	import.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, removeComponents);
+
+	import.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, smoothingAngle);
+
     const aiScene* scene = import.ReadFile(path, flags);
 
     if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !scene->mRootNode)
     {
         LOG_E(std::format("ASSIMP::{}", import.GetErrorString()));
-        return;
+        return false;
     }
 
+    ProcessNode(scene->mRootNode, scene, outImport.Directory, outImport.Meshes);
+
+    if (bCacheable && cache.Save(cacheKey, outImport.Directory, outImport.Meshes))
+        LOG_D(std::format("Cooked {} into {}", path, cacheKey.CachePath));
+
+    outImport.ImportMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+void KH_Model::ApplyImport(KH_ModelImport&& import)
+{
     Meshes.clear();
-    AABB.Reset();
+    Meshes.reserve(import.Meshes.size());
+    Directory = import.Directory;
+
+    for (KH_CookedMesh& cooked : import.Meshes)
+    {
+        std::vector<KH_Texture> textures;
+        for (const KH_CookedTexture& cookedTexture : cooked.Textures)
+        {
+            KH_Texture tex = KH_TextureManager::Instance().LoadTexture(cookedTexture.Path, true, cookedTexture.Type, true);
+            if (tex.IsValid())
+            {
+                textures.push_back(tex);
+            }
+        }
+
+        Meshes.emplace_back().Create(std::move(cooked.Vertices), std::move(cooked.Indices), std::move(textures),
+            cooked.LocalAABB, cooked.DrawMode);
+    }
+
+    FinalizeLoadedMeshes();
+}
 
-    Directory = std::filesystem::path(path).parent_path().string();
-    ProcessNode(scene->mRootNode, scene);
+void KH_Model::FinalizeLoadedMeshes()
+{
     UpdateAABB();
     UpdateGizmoPivotLocal();
 
@@ -111,7 +181,6 @@ void KH_Model::LoadModel(const std::string& path)
     {
         Meshes[i].LocalMeshID = i;
     }
-
 }
 
 KH_PickResult KH_Model::Pick(const KH_Ray& Ray, KH_ShaderFeatureType ShaderFeatureType) const
@@ -220,17 +289,34 @@ uint32_t KH_Model::GetPrimitiveCount() const
     return NumPrimitive;
 }
 
+void KH_Model::CollectEncodeTasks(std::vector<KH_PrimitiveEncodeTask>& outTasks) const
+{
+    for (uint32_t meshIndex = 0; meshIndex < static_cast<uint32_t>(Meshes.size()); ++meshIndex)
+    {
+        const uint32_t count = Meshes[meshIndex].GetPrimitiveCount();
+
+        for (uint32_t first = 0; first < count; first += KH_PRIMITIVE_ENCODE_CHUNK)
+        {
+            KH_PrimitiveEncodeTask Task;
+            Task.Object = this;
+            Task.SubIndex = meshIndex;
+            Task.FirstPrimitive = first;
+            Task.Count = std::min(KH_PRIMITIVE_ENCODE_CHUNK, count - first);
+            outTasks.push_back(Task);
+        }
+    }
+}
+
 void KH_Model::EncodePrimitives(
-    std::vector<KH_PrimitiveEncoded>& outPrimitives,
+    KH_PrimitiveEncoded* outPrimitives,
+    const KH_PrimitiveEncodeTask& Task,
     KH_ShaderFeatureType ShaderFeatureType) const
 {
-    const glm::mat4 model = GetModelMatrix();
-    const glm::mat3 normal = GetNormalMatrix();
+    if (Task.SubIndex >= Meshes.size())
+        return;
 
-    for (const auto& mesh : Meshes)
-    {
-        mesh.EncodePrimitives(outPrimitives, model, normal, ShaderFeatureType);
-    }
+    Meshes[Task.SubIndex].EncodePrimitives(
+        outPrimitives, Task.FirstPrimitive, Task.Count, ModelMatrix, NormalMatrix, ShaderFeatureType);
 }
 
 void KH_Model::CollectPrimitives(std::vector<KH_ScenePrimitive>& outPrimitives) const
@@ -267,25 +353,26 @@ void KH_Model::Render(KH_Shader& Shader)
 }
 
 
-void KH_Model::ProcessNode(aiNode* node, const aiScene* scene)
+void KH_Model::ProcessNode(aiNode* node, const aiScene* scene, const std::string& directory, std::vector<KH_CookedMesh>& outMeshes)
 {
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
     {
         aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        Meshes.push_back(ProcessMesh(mesh, scene));
+        outMeshes.push_back(ProcessMesh(mesh, scene, directory));
     }
 
     for (unsigned int i = 0; i < node->mNumChildren; i++)
     {
-        ProcessNode(node->mChildren[i], scene);
+        ProcessNode(node->mChildren[i], scene, directory, outMeshes);
     }
 }
 
-KH_Mesh KH_Model::ProcessMesh(aiMesh* mesh, const aiScene* scene)
+KH_CookedMesh KH_Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, const std::string& directory)
 {
-		std::vector<KH_Vertex> vertices;
-        std::vector<unsigned int> indices;
-        std::vector<KH_Texture> textures;
+		KH_CookedMesh cooked;
+		std::vector<KH_Vertex>& vertices = cooked.Vertices;
+        std::vector<unsigned int>& indices = cooked.Indices;
+        std::vector<KH_CookedTexture>& textures = cooked.Textures;
 
         for(unsigned int i = 0; i < mesh->mNumVertices; i++)
         {
@@ -347,32 +434,40 @@ KH_Mesh KH_Model::ProcessMesh(aiMesh* mesh, const aiScene* scene)
         // normal: texture_normalN
 
         // 1. diffuse maps
-        std::vector<KH_Texture> diffuseMaps = LoadMaterialTextures(material, aiTextureType_DIFFUSE);
+        std::vector<KH_CookedTexture> diffuseMaps = LoadMaterialTextures(material, aiTextureType_DIFFUSE, directory);
         textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
         // 2. specular maps
-        std::vector<KH_Texture> specularMaps = LoadMaterialTextures(material, aiTextureType_SPECULAR);
+        std::vector<KH_CookedTexture> specularMaps = LoadMaterialTextures(material, aiTextureType_SPECULAR, directory);
         textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
         // 3. normal maps
-        std::vector<KH_Texture> normalMaps = LoadMaterialTextures(material, aiTextureType_HEIGHT);
+        std::vector<KH_CookedTexture> normalMaps = LoadMaterialTextures(material, aiTextureType_HEIGHT, directory);
         textures.insert(textures.end(), normalMaps.begin(), normalMaps.end());
         // 4. height maps
-        std::vector<KH_Texture> heightMaps = LoadMaterialTextures(material, aiTextureType_AMBIENT);
+        std::vector<KH_CookedTexture> heightMaps = LoadMaterialTextures(material, aiTextureType_AMBIENT, directory);
         textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
         
-        // return a mesh object created from the extracted mesh data
-        return KH_Mesh(vertices, indices, textures);
+        // 局部包围盒随导入一起算好，缓存命中时无需再遍历顶点
+        for (const KH_Vertex& vertex : vertices)
+        {
+            cooked.LocalAABB.MinPos = glm::min(cooked.LocalAABB.MinPos, vertex.Position);
+            cooked.LocalAABB.MaxPos = glm::max(cooked.LocalAABB.MaxPos, vertex.Position);
+        }
+        if (vertices.empty())
+            cooked.LocalAABB = KH_AABB(glm::vec3(0.0f), glm::vec3(0.0f));
+
+        return cooked;
 }
 
-std::vector<KH_Texture> KH_Model::LoadMaterialTextures(aiMaterial* mat, aiTextureType type)
+std::vector<KH_CookedTexture> KH_Model::LoadMaterialTextures(aiMaterial* mat, aiTextureType type, const std::string& directory)
 {
-    std::vector<KH_Texture> textures;
+    std::vector<KH_CookedTexture> textures;
 
     for (unsigned int i = 0; i < mat->GetTextureCount(type); i++)
     {
         aiString str;
         mat->GetTexture(type, i, &str);
 
-        std::filesystem::path fullPath = std::filesystem::path(Directory) / str.C_Str();
+        std::filesystem::path fullPath = std::filesystem::path(directory) / str.C_Str();
 
         KH_TEXTURE_TYPE khType = KH_TEXTURE_TYPE::DEFAULT;
         switch (type)
@@ -394,11 +489,8 @@ std::vector<KH_Texture> KH_Model::LoadMaterialTextures(aiMaterial* mat, aiTextur
             break;
         }
 
-        KH_Texture tex = KH_TextureManager::Instance().LoadTexture(fullPath.string(), true, khType, true);
-        if (tex.IsValid())
-        {
-            textures.push_back(tex);
-        }
+        // 贴图解码与上传在 ApplyImport 中进行，这里只记录路径
+        textures.push_back({ khType, fullPath.string() });
     }
 
     return textures;
@@ -407,6 +499,11 @@ std::vector<KH_Texture> KH_Model::LoadMaterialTextures(aiMaterial* mat, aiTextur
 void KH_Model::UpdateAABB()
 {
     AABB.Reset();
+
+    // 尚未载入网格的占位模型保持空包围盒，不能经变换矩阵放大成无穷
+    if (Meshes.empty())
+        return;
+
     const glm::mat4 model = GetModelMatrix();
     for (const auto& mesh : Meshes)
     {
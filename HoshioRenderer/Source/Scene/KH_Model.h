@@ -1,6 +1,7 @@
 #pragma once
 
 #include "KH_Mesh.h"
+#include "KH_MeshCache.h"
 #include "Pipeline/KH_Texture.h"
 
 enum class KH_ModelSourceType
@@ -20,6 +21,15 @@ enum class KH_BuiltinModelType
     Sphere
 };
 
+// 模型导入结果，只含 CPU 数据：ImportModel 可在工作线程生成，再由渲染线程 ApplyImport 上传
+struct KH_ModelImport
+{
+    std::string SourcePath;
+    std::string Directory;
+    std::vector<KH_CookedMesh> Meshes;
+    bool bFromCache = false;
+    float ImportMilliseconds = 0.0f;
+};
 
 class KH_Model : public KH_Hitable
 {
@@ -34,6 +44,11 @@ public:
 
     void LoadModel(const std::string& path);
 
+    // 读取缓存或经 Assimp 解析，不触碰 GL，可在任意线程调用
+    static bool ImportModel(const std::string& path, KH_ModelImport& outImport);
+    // 渲染线程：载入贴图并上传网格，替换现有网格
+    void ApplyImport(KH_ModelImport&& import);
+
     static KH_Model CreateBuiltin(
         KH_BuiltinModelType type,
         float size = 1.0f,
@@ -48,8 +63,10 @@ public:
 
     void AddMesh(KH_Mesh&& mesh);
     virtual uint32_t GetPrimitiveCount() const override;
+    virtual void CollectEncodeTasks(std::vector<KH_PrimitiveEncodeTask>& outTasks) const override;
     virtual void EncodePrimitives(
-        std::vector<KH_PrimitiveEncoded>& outPrimitives,
+        KH_PrimitiveEncoded* outPrimitives,
+        const KH_PrimitiveEncodeTask& Task,
         KH_ShaderFeatureType ShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF) const override;
     virtual void CollectPrimitives(std::vector<KH_ScenePrimitive>& outPrimitives) const override;
     virtual void CollectPrimitiveAABBCenters(std::vector<glm::vec4>& outCenters) const override;
@@ -66,6 +83,7 @@ public:
     const std::vector<KH_Mesh>& GetMeshes() const { return Meshes; }
 
     void SetSourceAsInline();
+    void SetSourceAsAsset(const std::string& path);
 
     void SetMeshMaterialSlotID(KH_ShaderFeatureType ShaderFeatureType, int MaterialSlotID = KH_MATERIAL_UNDEFINED_SLOT);
     void SetMeshMaterialSlotID(KH_ShaderFeatureType ShaderFeatureType, int MaterialSlotID, int MeshID);
@@ -83,9 +101,12 @@ private:
     unsigned int BuiltinSectorCount = 64;
     unsigned int BuiltinStackCount = 32;
 
-    void ProcessNode(aiNode* node, const aiScene* scene);
-    KH_Mesh ProcessMesh(aiMesh* mesh, const aiScene* scene);
-    std::vector<KH_Texture> LoadMaterialTextures(aiMaterial* mat, aiTextureType type);
+    static void ProcessNode(aiNode* node, const aiScene* scene, const std::string& directory, std::vector<KH_CookedMesh>& outMeshes);
+    static KH_CookedMesh ProcessMesh(aiMesh* mesh, const aiScene* scene, const std::string& directory);
+    static std::vector<KH_CookedTexture> LoadMaterialTextures(aiMaterial* mat, aiTextureType type, const std::string& directory);
+
+    // 载入（解析或缓存命中）后统一重建包围盒、Gizmo 支点与网格编号
+    void FinalizeLoadedMeshes();
 
     void UpdateAABB() override;
     void UpdateGizmoPivotLocal();
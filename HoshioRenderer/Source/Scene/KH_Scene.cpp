@@ -1,48 +1,233 @@
 #include "KH_Scene.h"
-#include "Editor/KH_Editor.h"
+#include "Editor/KH_Camera.h"
+#include "Pipeline/KH_RenderContext.h"
+#include "Pipeline/KH_Framebuffer.h"
 #include "Pipeline/KH_Shader.h"
 #include "Pipeline/KH_Texture.h"
+#include "Pipeline/KH_SobolSampler.h"
 #include "KH_SceneXmlSerializer.h"
+#include "Utils/KH_Algorithms.h"
+#include "Utils/KH_JobSystem.h"
+#include "Utils/KH_Profiler.h"
+
+namespace
+{
+    void AddDefaultMaterialToFeature(KH_ShaderFeatureBase* feature)
+    {
+        if (feature == nullptr || feature->GetMaterialCount() > 0)
+            return;
+
+        if (auto* brdf = dynamic_cast<KH_DisneyBRDF*>(feature))
+        {
+            KH_BRDFMaterial mat{};
+            mat.BaseColor = glm::vec3(0.8f);
+            mat.Emissive = glm::vec3(0.0f);
+            mat.Specular = 0.5f;
+            mat.Roughness = 0.5f;
+            brdf->AddMaterial(mat);
+        }
+        else if (auto* bssrdf = dynamic_cast<KH_BSSRDF*>(feature))
+        {
+            KH_BSSRDFMaterial mat{};
+            mat.Emissive = glm::vec3(0.0f);
+            mat.BaseColor = glm::vec3(0.8f);
+            mat.Radius = glm::vec3(1.0f, 0.2f, 0.1f);
+            mat.Eta = 1.3f;
+            mat.Scale = 0.05f;
+            bssrdf->AddMaterial(mat);
+        }
+        else if (auto* bsdf = dynamic_cast<KH_DisneyBSDF*>(feature))
+        {
+            KH_BSDFMaterial mat{};
+            mat.BaseColor = glm::vec3(0.8f);
+            mat.Emissive = glm::vec3(0.0f);
+            mat.Specular = 0.5f;
+            mat.Roughness = 0.5f;
+            mat.IOR = 1.5f;
+            bsdf->AddMaterial(mat);
+        }
+    }
+}
 
 void KH_SceneBase::SetCameraParamUBO()
 {
     KH_CameraParam CameraParam;
-    const KH_Camera& Camera = KH_Editor::Instance().Camera;
+    const KH_Camera& Camera = KH_RenderContext::Current().GetCamera();
     CameraParam.AspectAndFovy = glm::vec4(Camera.Aspect, Camera.Fovy, 0.0f, 0.0f);
     CameraParam.Position = glm::vec4(Camera.Position, 1.0f);
     CameraParam.Right = glm::vec4(Camera.Right, 1.0f);
     CameraParam.Up = glm::vec4(Camera.Up, 1.0f);
     CameraParam.Front = glm::vec4(Camera.Front, 1.0f);
 
+    CameraParam.PrevViewProj = PrevViewProj;
+
     CameraParam_UB0.SetSingleData(CameraParam);
 }
 
+void KH_SceneBase::BeginFrame()
+{
+    const KH_Camera& Camera = KH_RenderContext::Current().GetCamera();
+    PrevViewProj = FrameViewProj;
+    FrameViewProj = Camera.GetProjMatrix() * Camera.GetViewMatrix();
+    bCameraMoved = FrameViewProj != PrevViewProj;
+}
+
+void KH_SceneBase::ResetCameraHistory()
+{
+    const KH_Camera& Camera = KH_RenderContext::Current().GetCamera();
+    FrameViewProj = Camera.GetProjMatrix() * Camera.GetViewMatrix();
+    PrevViewProj = FrameViewProj;
+    bCameraMoved = false;
+}
+
 void KH_SceneBase::SetAndBindCameraParamUB0()
 {
     SetCameraParamUBO();
     CameraParam_UB0.Bind();
 }
 
-std::vector<KH_PrimitiveEncoded> KH_SceneBase::EncodePrimitives()
+void KH_SceneBase::EncodePrimitives()
 {
-    std::vector<KH_PrimitiveEncoded> Encoded;
+    KH_PROFILE_SCOPE("EncodePrimitives");
+
+    std::vector<KH_PrimitiveEncodeTask> Tasks;
 
     PrimitiveCount = 0;
+    ObjectPrimitiveOffsets.assign(Objects.size() + 1, 0);
     for (int i = 0; i < static_cast<int>(Objects.size()); i++)
     {
-        PrimitiveCount += Objects[i]->GetPrimitiveCount();
+        ObjectPrimitiveOffsets[i] = PrimitiveCount;
+
+        const size_t FirstTask = Tasks.size();
+        Objects[i]->CollectEncodeTasks(Tasks);
+        for (size_t t = FirstTask; t < Tasks.size(); t++)
+        {
+            Tasks[t].Offset = PrimitiveCount;
+            PrimitiveCount += Tasks[t].Count;
+        }
+    }
+    ObjectPrimitiveOffsets[Objects.size()] = PrimitiveCount;
+
+    EncodedShaderFeatureType = GetActiveShaderFeatureType();
+
+    KH_PrimitiveEncoded* Mapped = Primitive_SSBO.MapForWrite(PrimitiveCount);
+    RunEncodeTasks(Tasks, Mapped, EncodedShaderFeatureType);
+    InvalidatePrimitiveHash();
+
+    DirtyObjects.clear();
+}
+
+bool KH_SceneBase::EncodeObjectPrimitives(size_t ObjectIndex)
+{
+    if (ObjectIndex >= Objects.size() ||
+        ObjectPrimitiveOffsets.size() != Objects.size() + 1 ||
+        Primitive_SSBO.GetCount() != PrimitiveCount ||
+        EncodedShaderFeatureType != GetActiveShaderFeatureType())
+        return false;
+
+    const uint32_t Begin = ObjectPrimitiveOffsets[ObjectIndex];
+    const uint32_t Count = ObjectPrimitiveOffsets[ObjectIndex + 1] - Begin;
+    if (Objects[ObjectIndex]->GetPrimitiveCount() != Count)
+        return false;
+
+    std::vector<KH_PrimitiveEncodeTask> Tasks;
+    Objects[ObjectIndex]->CollectEncodeTasks(Tasks);
+
+    uint32_t Offset = 0;
+    for (KH_PrimitiveEncodeTask& Task : Tasks)
+    {
+        Task.Offset = Offset;
+        Offset += Task.Count;
     }
+    if (Offset != Count)
+        return false;
+
+    KH_PrimitiveEncoded* Mapped = Primitive_SSBO.MapRange(Begin, Count);
+    if (!Mapped && Count > 0)
+        return false;
+
+    RunEncodeTasks(Tasks, Mapped, EncodedShaderFeatureType);
+    return true;
+}
+
+void KH_SceneBase::RunEncodeTasks(
+    const std::vector<KH_PrimitiveEncodeTask>& Tasks,
+    KH_PrimitiveEncoded* outPrimitives,
+    KH_ShaderFeatureType ShaderFeatureType)
+{
+    if (!outPrimitives)
+        return;
 
-    Encoded.reserve(PrimitiveCount);
+    // 各任务写入互不重叠的区间，无需额外同步
+    KH_JobSystem::Instance().ParallelFor(0, static_cast<uint32_t>(Tasks.size()), 1, [&](uint32_t i)
+    {
+        const KH_PrimitiveEncodeTask& Task = Tasks[i];
+        Task.Object->EncodePrimitives(outPrimitives + Task.Offset, Task, ShaderFeatureType);
+    });
+}
 
-    const KH_ShaderFeatureType ActiveType = GetActiveShaderFeatureType();
+void KH_SceneBase::EnsureDefaultMaterials()
+{
+    for (size_t i = 0; i < KH_ShaderFeatureTypeCount; ++i)
+    {
+        AddDefaultMaterialToFeature(GetShaderFeature(static_cast<KH_ShaderFeatureType>(i)));
+    }
+}
 
-    for (const auto& sceneObject : Objects)
+void KH_SceneBase::EncodePrimitivesTo(std::vector<KH_PrimitiveEncoded>& outPrimitives, KH_ShaderFeatureType ShaderFeatureType) const
+{
+    std::vector<KH_PrimitiveEncodeTask> Tasks;
+
+    uint32_t Count = 0;
+    for (const KH_SceneObject& Object : Objects)
     {
-        sceneObject->EncodePrimitives(Encoded, ActiveType);
+        const size_t FirstTask = Tasks.size();
+        Object->CollectEncodeTasks(Tasks);
+        for (size_t t = FirstTask; t < Tasks.size(); t++)
+        {
+            Tasks[t].Offset = Count;
+            Count += Tasks[t].Count;
+        }
     }
 
-    return Encoded;
+    outPrimitives.resize(Count);
+    RunEncodeTasks(Tasks, outPrimitives.data(), ShaderFeatureType);
+}
+
+uint64_t KH_SceneBase::GetPrimitiveHash(KH_ShaderFeatureType ShaderFeatureType) const
+{
+    if (bPrimitiveHashValid && PrimitiveHashType == ShaderFeatureType)
+        return PrimitiveHash;
+
+    std::vector<KH_PrimitiveEncoded> Primitives;
+    EncodePrimitivesTo(Primitives, ShaderFeatureType);
+
+    PrimitiveHash = KH_Hash::FNV1a64(Primitives.data(), Primitives.size() * sizeof(KH_PrimitiveEncoded));
+    PrimitiveHashType = ShaderFeatureType;
+    bPrimitiveHashValid = true;
+    return PrimitiveHash;
+}
+
+void KH_SceneBase::InvalidatePrimitiveHash()
+{
+    bPrimitiveHashValid = false;
+}
+
+void KH_SceneBase::MarkObjectDirty(size_t ObjectIndex)
+{
+    if (ObjectIndex < Objects.size())
+        DirtyObjects.insert(ObjectIndex);
+    InvalidatePrimitiveHash();
+}
+
+bool KH_SceneBase::HasDirtyObjects() const
+{
+    return !DirtyObjects.empty();
+}
+
+size_t KH_SceneBase::GetLastPrimitiveUploadBytes() const
+{
+    return LastPrimitiveUploadBytes;
 }
 
 void KH_SceneBase::InitializeModelMaterialSlots(KH_Model& model, int defaultMaterialSlotID)
@@ -90,6 +275,8 @@ void KH_SceneBase::RemapMaterialSlots(
             }
         }
     }
+
+    InvalidatePrimitiveHash();
 }
 
 std::vector<KH_SceneObject>& KH_SceneBase::GetObjects()
@@ -146,6 +333,7 @@ KH_Model& KH_SceneBase::AddModel(int MaterialSlotID, const std::string& Path)
     InitializeModelMaterialSlots(ref, MaterialSlotID);
 
     Objects.push_back(std::move(obj));
+    InvalidatePrimitiveHash();
     return ref;
 }
 
@@ -157,6 +345,7 @@ KH_Model& KH_SceneBase::AddModel(int MaterialSlotID, KH_Model&& Model)
     InitializeModelMaterialSlots(ref, MaterialSlotID);
 
     Objects.push_back(std::move(obj));
+    InvalidatePrimitiveHash();
     return ref;
 }
 
@@ -168,6 +357,7 @@ KH_Model& KH_SceneBase::AddEmptyModel(int MaterialSlotID)
     InitializeModelMaterialSlots(ref, MaterialSlotID);
 
     Objects.push_back(std::move(obj));
+    InvalidatePrimitiveHash();
     return ref;
 }
 
@@ -191,6 +381,7 @@ bool KH_SceneBase::RemoveObjectAt(size_t Index)
         return false;
 
     Objects.erase(Objects.begin() + static_cast<std::ptrdiff_t>(Index));
+    InvalidatePrimitiveHash();
     return true;
 }
 
@@ -199,6 +390,7 @@ void KH_SceneBase::Clear()
     Objects.clear();
     PrimitiveCount = 0;
     AABB.Reset();
+    InvalidatePrimitiveHash();
 
     for (auto& feature : ShaderFeatures)
     {
@@ -246,8 +438,7 @@ KH_PickResult KH_SceneBase::Pick(const KH_Ray& ray) const
 
 void KH_GpuLBVHScene::SetSSBOs()
 {
-    std::vector<KH_PrimitiveEncoded> PrimitiveEncodeds = EncodePrimitives();
-    Primitive_SSBO.SetData(PrimitiveEncodeds);
+    UpdatePrimitiveSSBO();
 
     for (size_t i = 0; i < KH_ShaderFeatureTypeCount; ++i)
     {
@@ -258,28 +449,31 @@ void KH_GpuLBVHScene::SetSSBOs()
     }
 }
 
-void KH_GpuLBVHScene::SetRayTracingParam(KH_Shader& Shader)
+void KH_GpuLBVHScene::BindTraversalBuffers() const
 {
-    Shader.Use();
-
     Primitive_SSBO.Bind();
     BVH.Morton3DSSBO.Bind();
     BVH.LBVHNodeSSBO.Bind();
     BVH.AuxiliarySSBO.Bind();
+}
+
+void KH_GpuLBVHScene::SetRayTracingParam(KH_Shader& Shader)
+{
+    Shader.Use();
 
-    Shader.SetInt("uLBVHNodeCount", BVH.LBVHNodeCount);
-    Shader.SetUint("uFrameCounter", KH_Editor::Instance().GetFrameCounter());
-    Shader.SetUvec2(
-        "uResolution",
-        glm::uvec2(KH_Editor::GetCanvasWidth(), KH_Editor::GetCanvasHeight()));
+    BindTraversalBuffers();
+    KH_SobolSampler::Instance().Bind();
 
-    KH_Editor::Instance().GetLastFramebuffer().BindColorAttachment(0, 0);
+    const KH_Framebuffer& LastFramebuffer = KH_RenderContext::Current().GetLastFramebuffer();
+    LastFramebuffer.BindColorAttachment(0, 0);
     KH_ExampleTextures::Instance().SkyboxHDR.Bind(1);
     KH_ExampleTextures::Instance().SkyboxHDRCache.Bind(2);
+    LastFramebuffer.BindColorAttachment(1, 3);
 
     Shader.SetInt("uLastFrame", 0);
     Shader.SetInt("uSkybox", 1);
     Shader.SetInt("uHDRCache", 2);
+    Shader.SetInt("uLastGBuffer", 3);
 
     KH_ShaderFeatureBase* feature = GetActiveShaderFeature();
     if (feature)
@@ -288,7 +482,32 @@ void KH_GpuLBVHScene::SetRayTracingParam(KH_Shader& Shader)
         feature->ApplyUniforms();
     }
 
+    // 环境贴图仍在后台加载时退回 SkyColor；特化的变体已把天空盒编译为关闭，只有 uniform 路径需要覆盖
+    if (!KH_ShaderFeatureBase::IsSpecializationEnabled() && !KH_ExampleTextures::Instance().IsSkyboxReady())
+    {
+        Shader.SetInt("uEnableSkybox", 0);
+    }
+
     SetAndBindCameraParamUB0();
+    SetAndBindFrameParamUBO();
+}
+
+void KH_GpuLBVHScene::SetAndBindFrameParamUBO()
+{
+    const KH_RenderContext& Context = KH_RenderContext::Current();
+
+    // bCameraMoved 由本帧的 BeginFrame 算出
+    KH_FrameParam FrameParam;
+    FrameParam.Resolution = Context.GetRenderExtent();
+    FrameParam.FrameCounter = Context.GetFrameCounter();
+    FrameParam.SobolDimensionCount = KH_SobolSampler::Instance().GetDimensionCount();
+    FrameParam.LBVHNodeCount = BVH.LBVHNodeCount;
+    FrameParam.ReprojectHistory = (Context.IsTemporalReprojectionEnabled() && bCameraMoved) ? 1 : 0;
+    FrameParam.HistoryClamp = Context.GetHistoryClamp();
+    FrameParam.SampleLimit = static_cast<float>(Context.GetSampleTarget());
+
+    FrameParam_UBO.SetSingleData(FrameParam);
+    FrameParam_UBO.Bind();
 }
 
 void KH_GpuLBVHScene::UpdateAABB()
@@ -302,6 +521,8 @@ void KH_GpuLBVHScene::UpdateAABB()
 
 void KH_GpuLBVHScene::BindAndBuild()
 {
+    KH_PROFILE_GPU_SCOPE("SceneBuild");
+
     SetSSBOs();
     UpdateAABB();
     BVH.BindAndBuild(this);
@@ -316,29 +537,82 @@ void KH_GpuLBVHScene::UpdateMaterialSSBO()
     }
 }
 
+void KH_GpuLBVHScene::UpdateMaterialSSBO(int MaterialID)
+{
+    KH_ShaderFeatureBase* feature = GetActiveShaderFeature();
+    if (feature)
+    {
+        feature->UploadMaterial(MaterialID);
+    }
+}
+
 void KH_GpuLBVHScene::UpdatePrimitiveSSBO()
 {
-    std::vector<KH_PrimitiveEncoded> PrimitiveEncodeds = EncodePrimitives();
-    Primitive_SSBO.SetData(PrimitiveEncodeds);
+    EncodePrimitives();
+    LastPrimitiveUploadBytes = static_cast<size_t>(PrimitiveCount) * sizeof(KH_PrimitiveEncoded);
+}
+
+void KH_GpuLBVHScene::UpdatePrimitiveSSBO(size_t ObjectIndex)
+{
+    MarkObjectDirty(ObjectIndex);
+    FlushDirtyObjects();
+}
+
+void KH_GpuLBVHScene::FlushDirtyObjects()
+{
+    KH_PROFILE_SCOPE("EncodeDirtyObjects");
+
+    const std::set<size_t> Pending = std::move(DirtyObjects);
+    DirtyObjects.clear();
+
+    size_t UploadBytes = 0;
+    for (size_t ObjectIndex : Pending)
+    {
+        if (!EncodeObjectPrimitives(ObjectIndex))
+        {
+            UpdatePrimitiveSSBO();
+            return;
+        }
+
+        const uint32_t Count = ObjectPrimitiveOffsets[ObjectIndex + 1] - ObjectPrimitiveOffsets[ObjectIndex];
+        UploadBytes += static_cast<size_t>(Count) * sizeof(KH_PrimitiveEncoded);
+    }
+
+    LastPrimitiveUploadBytes = UploadBytes;
+}
+
+void KH_GpuLBVHScene::RebuildDirtyObjects()
+{
+    KH_PROFILE_GPU_SCOPE("SceneRebuildDirty");
+
+    FlushDirtyObjects();
+    UpdateAABB();
+    BVH.BindAndBuild(this);
 }
 
 void KH_GpuLBVHScene::Render()
 {
+    KH_PROFILE_GPU_SCOPE("PathTrace");
+
     KH_ShaderFeatureBase* feature = GetActiveShaderFeature();
-    if (!feature || !feature->GetShader().IsValid())
+    if (!feature)
+        return;
+
+    feature->UpdatePermutation();
+    if (!feature->GetShader().IsValid())
         return;
 
     SetRayTracingParam(feature->GetShader());
 
-    KH_Editor::Instance().BindCanvasFramebuffer();
+    KH_Framebuffer& SceneFramebuffer = KH_RenderContext::Current().GetSceneFramebuffer();
+    SceneFramebuffer.Bind();
 
-    glBindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
+    KH_GLState::Instance().BindVertexArray(KH_DefaultModels::Instance().FullscreenQuad.GetVAO());
     glDrawElements(
         GL_TRIANGLES,
         KH_DefaultModels::Instance().FullscreenQuad.GetNumIndices(),
         GL_UNSIGNED_INT,
         0);
-    glBindVertexArray(0);
 
-    KH_Editor::Instance().UnbindCanvasFramebuffer();
+    SceneFramebuffer.Unbind();
 }
@@ -16,6 +16,18 @@ struct KH_CameraParam {
     glm::vec4 Right;
     glm::vec4 Up;
     glm::vec4 Front;
+    glm::mat4 PrevViewProj;
+};
+
+// 每帧只更新一次的参数，std140 布局与 shader 中 FrameBlock 一致
+struct KH_FrameParam {
+    glm::uvec2 Resolution = glm::uvec2(0);
+    uint32_t FrameCounter = 0;
+    uint32_t SobolDimensionCount = 0;
+    int32_t LBVHNodeCount = 0;
+    int32_t ReprojectHistory = 0;
+    float HistoryClamp = 0.0f;
+    float SampleLimit = 0.0f;
 };
 
 class KH_SceneBase
@@ -23,19 +35,48 @@ class KH_SceneBase
     friend class KH_GpuLBVH;
 
 protected:
-    KH_SSBO<KH_PrimitiveEncoded> Primitive_SSBO;
-    KH_UBO<KH_CameraParam> CameraParam_UB0;
+    // 图元只在编辑后改写，单区段：等待 fence 后直接编码进映射内存，不需要 CPU 副本与多份显存
+    KH_PersistentSSBO<KH_PrimitiveEncoded> Primitive_SSBO{ 0 };
+    KH_PersistentUBO<KH_CameraParam> CameraParam_UB0{ 5, KH_BUFFER_FRAMES_IN_FLIGHT };
+    KH_PersistentUBO<KH_FrameParam> FrameParam_UBO{ 6, KH_BUFFER_FRAMES_IN_FLIGHT };
 
     std::vector<KH_SceneObject> Objects;
     uint32_t PrimitiveCount = 0;
 
+    // 第 i 个物体的图元位于 Primitive_SSBO 的 [ObjectPrimitiveOffsets[i], ObjectPrimitiveOffsets[i + 1])
+    std::vector<uint32_t> ObjectPrimitiveOffsets;
+    KH_ShaderFeatureType EncodedShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF;
+    std::set<size_t> DirtyObjects;
+    size_t LastPrimitiveUploadBytes = 0;
+
+    // GetPrimitiveHash 的缓存，物体增删、重编码或标脏时失效
+    mutable bool bPrimitiveHashValid = false;
+    mutable KH_ShaderFeatureType PrimitiveHashType = KH_ShaderFeatureType::DisneyBRDF;
+    mutable uint64_t PrimitiveHash = 0;
+
+    void InvalidatePrimitiveHash();
+
     std::array<std::unique_ptr<KH_ShaderFeatureBase>, KH_ShaderFeatureTypeCount> ShaderFeatures;
     KH_ShaderFeatureType ActiveShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF;
 
+    // 由 BeginFrame 每帧推进一次，上传相机参数时只读
+    glm::mat4 PrevViewProj = glm::mat4(1.0f);
+    glm::mat4 FrameViewProj = glm::mat4(1.0f);
+    bool bCameraMoved = false;
+
     void SetCameraParamUBO();
     void SetAndBindCameraParamUB0();
 
-    std::vector<KH_PrimitiveEncoded> EncodePrimitives();
+    // 多线程编码全部图元，写入 Primitive_SSBO 后提交
+    void EncodePrimitives();
+
+    // 布局（物体数量、图元数量、着色特性）未变时原地重编码单个物体，否则返回 false
+    bool EncodeObjectPrimitives(size_t ObjectIndex);
+
+    static void RunEncodeTasks(
+        const std::vector<KH_PrimitiveEncodeTask>& Tasks,
+        KH_PrimitiveEncoded* outPrimitives,
+        KH_ShaderFeatureType ShaderFeatureType);
 
     void InitializeModelMaterialSlots(KH_Model& model, int defaultMaterialSlotID);
     void RemapMaterialSlots(KH_ShaderFeatureType type, int removedMaterialID);
@@ -86,6 +127,9 @@ public:
 
     bool DeleteMaterial(KH_ShaderFeatureType type, int materialID);
 
+    // 为没有任何材质的着色特性补一个默认材质，保证材质槽 0 可用
+    void EnsureDefaultMaterials();
+
     void Clear();
 
     bool RemoveObjectAt(size_t Index);
@@ -95,6 +139,22 @@ public:
 
     KH_PickResult Pick(const KH_Ray& ray) const;
 
+    // 将全部图元按指定着色特性编码到 CPU 内存，供 CPU 后端使用
+    void EncodePrimitivesTo(std::vector<KH_PrimitiveEncoded>& outPrimitives, KH_ShaderFeatureType ShaderFeatureType) const;
+
+    // 按指定着色特性编码后全部图元的哈希，只在场景改动后的第一次调用时重新编码
+    uint64_t GetPrimitiveHash(KH_ShaderFeatureType ShaderFeatureType) const;
+
+    void MarkObjectDirty(size_t ObjectIndex);
+    bool HasDirtyObjects() const;
+    size_t GetLastPrimitiveUploadBytes() const;
+
+    // 每帧开始、相机输入处理完后调用一次：本帧相机与上一帧比较，决定是否重投影历史
+    void BeginFrame();
+
+    // 直接写回累积历史后调用：把当前相机记为上一帧相机，下一帧不会当作相机移动去重投影
+    void ResetCameraHistory();
+
     virtual void BindAndBuild() = 0;
 };
 
@@ -105,6 +165,7 @@ class KH_GpuLBVHScene : public KH_SceneBase
 private:
     void SetSSBOs();
     void SetRayTracingParam(KH_Shader& Shader);
+    void SetAndBindFrameParamUBO();
     void UpdateAABB();
 
 public:
@@ -114,6 +175,7 @@ public:
     {
         Primitive_SSBO.SetBindPoint(0);
         CameraParam_UB0.SetBindPoint(5);
+        FrameParam_UBO.SetBindPoint(6);
 
         auto& DisneyBRDF_Feature =
             EmplaceShaderFeature<KH_DisneyBRDF>(KH_ShaderFeatureType::DisneyBRDF);
@@ -132,6 +194,16 @@ public:
 
     void BindAndBuild() override;
     void UpdateMaterialSSBO();
+    void UpdateMaterialSSBO(int MaterialID);
     void UpdatePrimitiveSSBO();
+    void UpdatePrimitiveSSBO(size_t ObjectIndex);
+
+    // 只上传被标记物体的图元范围，再重建 BVH
+    void FlushDirtyObjects();
+    void RebuildDirtyObjects();
     void Render();
+
+    // 绑定图元与 LBVH 缓冲（binding 0-3），供独立的遍历着色器使用
+    void BindTraversalBuffers() const;
+    int GetLBVHNodeCount() const { return BVH.LBVHNodeCount; }
 };
@@ -0,0 +1,235 @@
+#include "KH_SceneLoader.h"
+#include "KH_Scene.h"
+
+#include "Utils/KH_DebugUtils.h"
+#include "Utils/KH_JobSystem.h"
+
+namespace
+{
+    float MillisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Assimp 导入以内存与单线程计算为主，最多占满作业系统的工作线程
+    uint32_t GetMaxConcurrentImports()
+    {
+        return std::max(KH_JobSystem::Instance().GetWorkerCount(), 1u);
+    }
+}
+
+KH_SceneLoader::~KH_SceneLoader()
+{
+    Cancel();
+}
+
+bool KH_SceneLoader::Begin(KH_SceneBase& scene, const std::string& filePath)
+{
+    Cancel();
+
+    StartTime = std::chrono::steady_clock::now();
+    Progress = KH_SceneLoadProgress();
+
+    std::vector<KH_DeferredModelLoad> deferred;
+    if (!KH_SceneXmlSerializer::LoadScene(scene, filePath, &deferred))
+        return false;
+
+    Progress.ParseMilliseconds = MillisecondsSince(StartTime);
+    Progress.TotalModels = static_cast<uint32_t>(deferred.size());
+
+    Scene = &scene;
+    FilePath = filePath;
+
+    std::unordered_map<std::string, size_t> importByPath;
+    for (KH_DeferredModelLoad& load : deferred)
+    {
+        auto [it, bInserted] = importByPath.try_emplace(load.Path, Imports.size());
+        if (bInserted)
+        {
+            Imports.push_back(std::make_unique<KH_PendingImport>());
+            Imports.back()->Path = load.Path;
+        }
+
+        Imports[it->second]->Targets.push_back(std::move(load));
+    }
+
+    bLoading = true;
+
+    LOG_D(std::format("Scene: parsed {} in {:.1f} ms, streaming {} models ({} unique)",
+        filePath, Progress.ParseMilliseconds, Progress.TotalModels, Imports.size()));
+
+    DispatchImports();
+    FinishIfDone();
+    return true;
+}
+
+bool KH_SceneLoader::Update(float budgetMilliseconds)
+{
+    if (!bLoading)
+        return false;
+
+    const bool bAdded = ApplyCompletedImports(budgetMilliseconds);
+    if (bAdded)
+        RebuildScene();
+
+    FinishIfDone();
+    return bAdded;
+}
+
+void KH_SceneLoader::Wait()
+{
+    while (bLoading && InFlightImports > 0)
+    {
+        for (const auto& pending : Imports)
+        {
+            if (!pending->bApplied && pending->Result.valid())
+            {
+                pending->Result.wait();
+                break;
+            }
+        }
+
+        ApplyCompletedImports(0.0f);
+        FinishIfDone();
+    }
+}
+
+void KH_SceneLoader::Cancel()
+{
+    // 作业系统的 future 析构时不会等待，导入结果写回 KH_PendingImport，须等运行中的导入结束再释放
+    for (const auto& pending : Imports)
+    {
+        if (pending->Result.valid())
+            pending->Result.wait();
+    }
+
+    Imports.clear();
+    NextDispatch = 0;
+    InFlightImports = 0;
+
+    if (bLoading)
+        LOG_W(std::format("Scene: cancelled streaming of {}", FilePath));
+
+    Scene = nullptr;
+    bLoading = false;
+}
+
+void KH_SceneLoader::DispatchImports()
+{
+    const uint32_t maxInFlight = GetMaxConcurrentImports();
+
+    while (NextDispatch < Imports.size() && InFlightImports < maxInFlight)
+    {
+        KH_PendingImport* pending = Imports[NextDispatch++].get();
+
+        pending->Result = KH_JobSystem::Instance().Async([pending]()
+        {
+            return KH_Model::ImportModel(pending->Path, pending->Import);
+        });
+
+        ++InFlightImports;
+    }
+}
+
+bool KH_SceneLoader::ApplyCompletedImports(float budgetMilliseconds)
+{
+    const auto start = std::chrono::steady_clock::now();
+    bool bAdded = false;
+
+    for (const auto& pending : Imports)
+    {
+        if (pending->bApplied || !pending->Result.valid())
+            continue;
+
+        if (pending->Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        // 每帧至少上传一个，避免大模型永远超出预算
+        if (budgetMilliseconds > 0.0f && bAdded && MillisecondsSince(start) > budgetMilliseconds)
+            break;
+
+        bAdded |= ApplyImport(*pending);
+        pending->bApplied = true;
+        --InFlightImports;
+    }
+
+    DispatchImports();
+    return bAdded;
+}
+
+bool KH_SceneLoader::ApplyImport(KH_PendingImport& pending)
+{
+    const uint32_t targetCount = static_cast<uint32_t>(pending.Targets.size());
+
+    if (!pending.Result.get())
+    {
+        LOG_E(std::format("Scene: failed to import {}", pending.Path));
+        Progress.FailedModels += targetCount;
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool bFromCache = pending.Import.bFromCache;
+    const float importMilliseconds = pending.Import.ImportMilliseconds;
+    Progress.ImportMilliseconds += importMilliseconds;
+
+    bool bAdded = false;
+    for (uint32_t i = 0; i < targetCount; ++i)
+    {
+        KH_DeferredModelLoad& target = pending.Targets[i];
+
+        // 载入期间占位可能已被删除，只写回仍在场景中的同一个占位
+        const auto& objects = Scene->GetObjects();
+        const bool bAlive = std::any_of(objects.begin(), objects.end(),
+            [&](const KH_SceneObject& object) { return object.get() == target.Model; });
+
+        if (!bAlive || target.Model->GetSourcePath() != pending.Path || !target.Model->GetMeshes().empty())
+        {
+            Progress.FailedModels++;
+            continue;
+        }
+
+        // 最后一个实例直接接管导入结果，其余实例各拷贝一份
+        if (i + 1 == targetCount)
+            target.Model->ApplyImport(std::move(pending.Import));
+        else
+            target.Model->ApplyImport(KH_ModelImport(pending.Import));
+
+        for (const KH_MeshMaterialSlot& slot : target.MaterialSlots)
+            target.Model->SetMeshMaterialSlotID(slot.Type, slot.MaterialSlotID, slot.MeshID);
+
+        Progress.LoadedModels++;
+        bAdded = true;
+    }
+
+    const float uploadMilliseconds = MillisecondsSince(start);
+    Progress.UploadMilliseconds += uploadMilliseconds;
+
+    LOG_D(std::format("Scene: loaded {} x{} from {} (import {:.1f} ms, upload {:.1f} ms)",
+        pending.Path, targetCount, bFromCache ? "cache" : "Assimp", importMilliseconds, uploadMilliseconds));
+
+    return bAdded;
+}
+
+void KH_SceneLoader::RebuildScene()
+{
+    const auto start = std::chrono::steady_clock::now();
+    Scene->BindAndBuild();
+    Progress.BuildMilliseconds += MillisecondsSince(start);
+}
+
+void KH_SceneLoader::FinishIfDone()
+{
+    Progress.ElapsedMilliseconds = MillisecondsSince(StartTime);
+
+    if (!bLoading || NextDispatch < Imports.size() || InFlightImports > 0)
+        return;
+
+    LOG_D(std::format("Scene: {} ready in {:.1f} ms (parse {:.1f} ms, import {:.1f} ms, upload {:.1f} ms, build {:.1f} ms, {} failed)",
+        FilePath, Progress.ElapsedMilliseconds, Progress.ParseMilliseconds, Progress.ImportMilliseconds,
+        Progress.UploadMilliseconds, Progress.BuildMilliseconds, Progress.FailedModels));
+
+    Imports.clear();
+    NextDispatch = 0;
+    bLoading = false;
+}
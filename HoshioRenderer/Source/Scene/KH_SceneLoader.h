@@ -0,0 +1,87 @@
+#pragma once
+
+#include "KH_Common.h"
+#include "KH_Model.h"
+#include "KH_SceneXmlSerializer.h"
+
+class KH_SceneBase;
+
+struct KH_SceneLoadProgress
+{
+    uint32_t TotalModels = 0;
+    uint32_t LoadedModels = 0;
+    uint32_t FailedModels = 0;
+
+    float ParseMilliseconds = 0.0f;
+    // 各工作线程导入耗时之和，并发时大于墙钟时间
+    float ImportMilliseconds = 0.0f;
+    float UploadMilliseconds = 0.0f;
+    float BuildMilliseconds = 0.0f;
+    float ElapsedMilliseconds = 0.0f;
+
+    float GetFraction() const
+    {
+        return TotalModels == 0 ? 1.0f : static_cast<float>(LoadedModels + FailedModels) / TotalModels;
+    }
+};
+
+// 分阶段场景载入：XML、内置与内联模型在调用线程同步解析，资产模型先以空占位加入场景；
+// 文件读取与 Assimp 导入（或网格缓存）在工作线程并发执行，渲染线程按时间预算批量上传，
+// 每批上传后重建一次 BVH，场景随之逐步出现。同一路径的模型只导入一次
+class KH_SceneLoader
+{
+public:
+    KH_SceneLoader() = default;
+    ~KH_SceneLoader();
+
+    KH_SceneLoader(const KH_SceneLoader&) = delete;
+    KH_SceneLoader& operator=(const KH_SceneLoader&) = delete;
+
+    // 取消上一次载入，清空场景并解析 XML，随后派发资产导入
+    bool Begin(KH_SceneBase& scene, const std::string& filePath);
+
+    // 渲染线程每帧调用：上传已完成的导入，累计超过 budgetMilliseconds 后留到下一帧（<= 0 不限）。
+    // 有模型加入时重建场景并返回 true
+    bool Update(float budgetMilliseconds = 0.0f);
+
+    // 阻塞直到全部导入完成并上传，不重建场景，由调用方在之后统一构建，供离线渲染使用
+    void Wait();
+
+    // 丢弃未上传的结果；已开始的导入会等其结束
+    void Cancel();
+
+    bool IsLoading() const { return bLoading; }
+    const KH_SceneLoadProgress& GetProgress() const { return Progress; }
+    const std::string& GetFilePath() const { return FilePath; }
+
+private:
+    struct KH_PendingImport
+    {
+        std::string Path;
+        std::vector<KH_DeferredModelLoad> Targets;
+        KH_ModelImport Import;
+        std::future<bool> Result;
+        bool bApplied = false;
+    };
+
+    KH_SceneBase* Scene = nullptr;
+    std::string FilePath;
+
+    // 按 XML 中首次出现的顺序排列
+    std::vector<std::unique_ptr<KH_PendingImport>> Imports;
+    size_t NextDispatch = 0;
+    uint32_t InFlightImports = 0;
+
+    std::chrono::steady_clock::time_point StartTime;
+    KH_SceneLoadProgress Progress;
+    bool bLoading = false;
+
+    void DispatchImports();
+
+    // 上传已完成的导入，返回是否有模型加入场景
+    bool ApplyCompletedImports(float budgetMilliseconds);
+    bool ApplyImport(KH_PendingImport& pending);
+
+    void RebuildScene();
+    void FinishIfDone();
+};
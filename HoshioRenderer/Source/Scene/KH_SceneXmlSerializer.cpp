@@ -497,7 +497,7 @@ namespace
         modelElem->InsertEndChild(slotsElem);
     }
 
-    bool ReadMeshMaterialSlots(const XMLElement* modelElem, KH_Model& model, KH_SceneBase& scene)
+    bool ReadMeshMaterialSlots(const XMLElement* modelElem, KH_SceneBase& scene, std::vector<KH_MeshMaterialSlot>& outSlots)
     {
         const XMLElement* slotsElem = modelElem->FirstChildElement("MeshMaterialSlots");
         if (slotsElem == nullptr)
@@ -522,8 +522,11 @@ namespace
                 if (!EnsureShaderFeatureExists(scene, type))
                     return false;
 
-                const int materialSlotID = slotElem->IntAttribute("material", KH_MATERIAL_UNDEFINED_SLOT);
-                model.SetMeshMaterialSlotID(type, materialSlotID, meshID);
+                KH_MeshMaterialSlot slot;
+                slot.MeshID = meshID;
+                slot.Type = type;
+                slot.MaterialSlotID = slotElem->IntAttribute("material", KH_MATERIAL_UNDEFINED_SLOT);
+                outSlots.push_back(slot);
             }
         }
 
@@ -683,7 +686,7 @@ namespace
         objectsElem->InsertEndChild(modelElem);
     }
 
-    bool ReadModel(const XMLElement* modelElem, KH_SceneBase& scene)
+    bool ReadModel(const XMLElement* modelElem, KH_SceneBase& scene, std::vector<KH_DeferredModelLoad>* outDeferred)
     {
         if (modelElem == nullptr)
             return false;
@@ -700,8 +703,17 @@ namespace
             if (path == nullptr || path[0] == '\0')
                 return false;
 
-            KH_Model& modelRef = scene.AddModel(KH_MATERIAL_UNDEFINED_SLOT, path);
-            createdModel = &modelRef;
+            if (outDeferred != nullptr)
+            {
+                KH_Model& modelRef = scene.AddEmptyModel(KH_MATERIAL_UNDEFINED_SLOT);
+                modelRef.SetSourceAsAsset(path);
+                createdModel = &modelRef;
+            }
+            else
+            {
+                KH_Model& modelRef = scene.AddModel(KH_MATERIAL_UNDEFINED_SLOT, path);
+                createdModel = &modelRef;
+            }
         }
         else if (std::strcmp(sourceType, "Builtin") == 0)
         {
@@ -728,9 +740,19 @@ namespace
 
         ReadTransform(modelElem->FirstChildElement("Transform"), *createdModel);
 
-        if (!ReadMeshMaterialSlots(modelElem, *createdModel, scene))
+        std::vector<KH_MeshMaterialSlot> slots;
+        if (!ReadMeshMaterialSlots(modelElem, scene, slots))
             return false;
 
+        if (outDeferred != nullptr && createdModel->GetSourceType() == KH_ModelSourceType::Asset)
+        {
+            outDeferred->push_back({ createdModel, createdModel->GetSourcePath(), std::move(slots) });
+            return true;
+        }
+
+        for (const KH_MeshMaterialSlot& slot : slots)
+            createdModel->SetMeshMaterialSlotID(slot.Type, slot.MaterialSlotID, slot.MeshID);
+
         return true;
     }
 
@@ -749,7 +771,7 @@ namespace
         }
     }
 
-    bool ReadObjects(const XMLElement* root, KH_SceneBase& scene)
+    bool ReadObjects(const XMLElement* root, KH_SceneBase& scene, std::vector<KH_DeferredModelLoad>* outDeferred)
     {
         const XMLElement* objectsElem = root->FirstChildElement("Objects");
         if (objectsElem == nullptr)
@@ -765,7 +787,7 @@ namespace
 
             if (std::strcmp(name, "Model") == 0)
             {
-                if (!ReadModel(objectElem, scene))
+                if (!ReadModel(objectElem, scene, outDeferred))
                     return false;
             }
         }
@@ -795,7 +817,7 @@ namespace KH_SceneXmlSerializer
         return doc.SaveFile(filePath.c_str()) == tinyxml2::XML_SUCCESS;
     }
 
-    bool LoadScene(KH_SceneBase& scene, const std::string& filePath)
+    bool LoadScene(KH_SceneBase& scene, const std::string& filePath, std::vector<KH_DeferredModelLoad>* outDeferred)
     {
         tinyxml2::XMLDocument doc;
         if (doc.LoadFile(filePath.c_str()) != tinyxml2::XML_SUCCESS)
@@ -814,7 +836,7 @@ namespace KH_SceneXmlSerializer
         if (!ReadShaderFeatures(root, scene))
             return false;
 
-        if (!ReadObjects(root, scene))
+        if (!ReadObjects(root, scene, outDeferred))
             return false;
 
         if (!scene.SetActiveShaderFeature(activeType))
@@ -1,10 +1,28 @@
 #pragma once
 #include <KH_Common.h>
+#include "KH_Shape.h"
 
 class KH_SceneBase;
+class KH_Model;
+
+struct KH_MeshMaterialSlot
+{
+    int MeshID = -1;
+    KH_ShaderFeatureType Type = KH_ShaderFeatureType::DisneyBRDF;
+    int MaterialSlotID = KH_MATERIAL_UNDEFINED_SLOT;
+};
+
+// 延迟载入的资产模型：场景中先放入空的占位模型（变换已应用），网格到达后再写入材质槽
+struct KH_DeferredModelLoad
+{
+    KH_Model* Model = nullptr;
+    std::string Path;
+    std::vector<KH_MeshMaterialSlot> MaterialSlots;
+};
 
 namespace KH_SceneXmlSerializer
 {
     bool SaveScene(const KH_SceneBase& scene, const std::string& filePath);
-    bool LoadScene(KH_SceneBase& scene, const std::string& filePath);
+    // outDeferred 非空时资产模型不在此处导入，改为返回占位与待载入路径
+    bool LoadScene(KH_SceneBase& scene, const std::string& filePath, std::vector<KH_DeferredModelLoad>* outDeferred = nullptr);
 }
\ No newline at end of file
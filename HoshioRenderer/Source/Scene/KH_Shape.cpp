@@ -22,6 +22,14 @@ glm::vec3 KH_Object::QuatToEulerDegreesXYZ(const glm::quat& q)
     return glm::degrees(glm::eulerAngles(glm::normalize(q)));
 }
 
+void KH_Object::CollectEncodeTasks(std::vector<KH_PrimitiveEncodeTask>& outTasks) const
+{
+    KH_PrimitiveEncodeTask Task;
+    Task.Object = this;
+    Task.Count = GetPrimitiveCount();
+    outTasks.push_back(Task);
+}
+
 KH_InspectorEditResult KH_Object::DrawInspector()
 {
     KH_InspectorEditResult result;
@@ -103,9 +111,6 @@ KH_InspectorEditResult KH_Object::DrawInspector()
                     MaterialID = std::clamp(MaterialID, 0, MaterialCount - 1);
                     ApplyMaterial(MaterialID);
 
-                    scene.UpdatePrimitiveSSBO();
-                    editor.RequestFrameReset();
-
                     result.bValueChanged = true;
                     result.CommitType = KH_InspectorCommitType::UpdateMaterial;
                 }
@@ -510,9 +515,13 @@ uint32_t KH_Triangle::GetPrimitiveCount() const
 }
 
 void KH_Triangle::EncodePrimitives(
-    std::vector<KH_PrimitiveEncoded>& outPrimitives,
+    KH_PrimitiveEncoded* outPrimitives,
+    const KH_PrimitiveEncodeTask& Task,
     KH_ShaderFeatureType ShaderFeatureType) const
 {
+    if (Task.Count == 0)
+        return;
+
     KH_TriangleWorldData Data = GetWorldData();
 
     KH_PrimitiveEncoded primitive{};
@@ -528,7 +537,7 @@ void KH_Triangle::EncodePrimitives(
     primitive.PrimitiveType = glm::ivec2(static_cast<int>(KH_PrimitiveType::Triangle), 0);
     primitive.MaterialSlotID = glm::ivec2(GetMaterialSlotID(ShaderFeatureType), 0);
 
-    outPrimitives.push_back(primitive);
+    outPrimitives[0] = primitive;
 }
 
 void KH_Triangle::CollectPrimitives(std::vector<KH_ScenePrimitive>& outPrimitives) const
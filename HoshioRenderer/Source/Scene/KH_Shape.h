@@ -56,6 +56,21 @@ struct KH_PrimitiveEncoded
     glm::ivec2 MaterialSlotID;
 };
 
+class KH_Object;
+
+// 一段可独立编码的图元：Object 内第 SubIndex 个子网格的 [FirstPrimitive, FirstPrimitive + Count)，
+// 写到输出缓冲的 Offset 处。大网格会被切成多段以便并行
+struct KH_PrimitiveEncodeTask
+{
+    const KH_Object* Object = nullptr;
+    uint32_t SubIndex = 0;
+    uint32_t FirstPrimitive = 0;
+    uint32_t Count = 0;
+    uint32_t Offset = 0;
+};
+
+constexpr uint32_t KH_PRIMITIVE_ENCODE_CHUNK = 16384;
+
 class KH_Object
 {
 protected:
@@ -77,8 +92,11 @@ public:
     KH_Object& operator=(KH_Object&&) noexcept = default;
 
     virtual uint32_t GetPrimitiveCount() const = 0;
+    virtual void CollectEncodeTasks(std::vector<KH_PrimitiveEncodeTask>& outTasks) const;
+    // 向 outPrimitives 写入 Task.Count 个图元，可在多个线程中同时调用
     virtual void EncodePrimitives(
-        std::vector<KH_PrimitiveEncoded>& outPrimitives,
+        KH_PrimitiveEncoded* outPrimitives,
+        const KH_PrimitiveEncodeTask& Task,
         KH_ShaderFeatureType ShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF) const = 0;
     virtual void CollectPrimitives(std::vector<KH_ScenePrimitive>& outPrimitives) const = 0;
     virtual void CollectPrimitiveAABBCenters(std::vector<glm::vec4>& outCenters) const = 0;
@@ -217,7 +235,8 @@ public:
 
     virtual uint32_t GetPrimitiveCount() const override;
     virtual void EncodePrimitives(
-        std::vector<KH_PrimitiveEncoded>& outPrimitives,
+        KH_PrimitiveEncoded* outPrimitives,
+        const KH_PrimitiveEncodeTask& Task,
         KH_ShaderFeatureType ShaderFeatureType = KH_ShaderFeatureType::DisneyBRDF) const override;
     virtual void CollectPrimitives(std::vector<KH_ScenePrimitive>& outPrimitives) const override;
     virtual void CollectPrimitiveAABBCenters(std::vector<glm::vec4>& outCenters) const override;
@@ -1,8 +1,8 @@
 #include "KH_Algorithms.h"
 #include "KH_DebugUtils.h"
 
-KH_ScanCPU::KH_ScanCPU(std::vector<int>& Data)
-	:Data(Data)
+KH_ScanCPU::KH_ScanCPU(std::vector<int>& Data, bool bPrintStages)
+	:Data(Data), bPrintStages(bPrintStages)
 {
 	size_t n = Data.size();
 	Depth = static_cast<int>(glm::ceil(glm::log2(static_cast<float>(n))));
@@ -67,6 +67,9 @@ void KH_ScanCPU::DownsweepCPU()
 
 void KH_ScanCPU::PrintArray(int level, KH_SCAN_STAGE stage)
 {
+	if (!bPrintStages)
+		return;
+
 	std::cout << std::format(
 		"\nArray State (size = {})\nStage: {} | Level: {}\n",
 		Data.size(),
@@ -461,13 +464,6 @@ std::vector<float> KH_Sobol::GenerateSobols(uint32_t D, uint32_t S, uint32_t A,
 		Sobols[i] = Sobol(V, GrayCode(i));
 	}
 
-	std::cout << std::format("Sobols[0]-[30]:\n");
-	for (int i = 0; i < 30; i++)
-	{
-		std::cout << Sobols[i] << std::endl;
-	}
-	std::cout << std::endl;
-
 	return Sobols;
 }
 
@@ -481,13 +477,6 @@ std::vector<uint32_t> KH_Sobol::GenerateDirectionNumbers(uint32_t D, uint32_t S,
 			V[i] = (1 << (32 - i));
 		}
 
-		std::cout << std::format("V[1]-[32]:\n");
-		for (int i = 1; i <= 32; i++)
-		{
-			std::cout << V[i] << std::endl;
-		}
-		std::cout << std::endl;
-
 		return V;
 	}
 
@@ -502,44 +491,111 @@ std::vector<uint32_t> KH_Sobol::GenerateDirectionNumbers(uint32_t D, uint32_t S,
 		A >>= 1;
 	}
 
-	std::cout << std::format("A_component[1]-[{}]:\n", S-1);
-	for (int i = 1; i < S; i++)
-	{
-		std::cout << A_component[i] << " ";
-	}
-	std::cout << std::endl << std::endl;
-
-
 	// Generate M
 	for (int i = S + 1; i <= 32; i++)
 	{
 		GenerateM(i, S, A_component, M);
 	}
 
-	std::cout << std::format("M[1]-[32]:\n");
+	// Generate Direction Numbers
 	for (int i = 1; i <= 32; i++)
 	{
-		std::cout << M[i] << std::endl;
+		V[i] = M[i] * (1 << (32 - i));
 	}
-	std::cout << std::endl;
 
-	// Generate Direction Numbers
-	for (int i = 1; i <= 32; i++)
+	return V;
+}
+
+bool KH_Sobol::LoadDirectionNumbers(const std::string& JoeKuoPath, uint32_t NumDimensions, std::vector<uint32_t>& OutTable)
+{
+	OutTable.clear();
+
+	std::ifstream File(JoeKuoPath);
+	if (!File.is_open())
 	{
-		V[i] = M[i] * (1 << (32 - i));
+		LOG_E(std::format("Failed to open Sobol direction numbers '{}'", JoeKuoPath));
+		return false;
 	}
 
-	std::cout << std::format("V[1]-[32]:\n");
-	for (int i = 1; i <=32;i++)
+	OutTable.reserve(static_cast<size_t>(NumDimensions) * 32);
+
+	std::vector<uint32_t> M;
+
+	// 第 0 维不在表中，方向数为 V[i] = 2^(32-i)
+	std::vector<uint32_t> V = GenerateDirectionNumbers(0, 0, 0, M);
+	OutTable.insert(OutTable.end(), V.begin() + 1, V.end());
+	uint32_t Dimensions = 1;
+
+	std::string Line;
+	std::getline(File, Line); // 跳过表头 "d s a m_i"
+
+	while (Dimensions < NumDimensions && std::getline(File, Line))
 	{
-		std::cout << V[i] << ", ";
+		std::istringstream Stream(Line);
+
+		uint32_t d = 0, s = 0, a = 0;
+		if (!(Stream >> d >> s >> a) || s == 0 || s > 32)
+			continue;
 
-		if (i % 6 == 0)
-			std::cout << std::endl;
+		M.assign(33, 0);
+		for (uint32_t i = 1; i <= s; i++)
+		{
+			Stream >> M[i];
+		}
 
+		V = GenerateDirectionNumbers(Dimensions, s, a, M);
+		OutTable.insert(OutTable.end(), V.begin() + 1, V.end());
+		Dimensions++;
 	}
-	std::cout << std::endl;
-	return V;
+
+	if (Dimensions < NumDimensions)
+	{
+		LOG_W(std::format("Sobol direction numbers: only {} of {} dimensions loaded", Dimensions, NumDimensions));
+	}
+
+	return true;
+}
+
+bool KH_Sobol::ExportDirectionTable(const std::string& JoeKuoPath, const std::string& OutputPath, uint32_t NumDimensions)
+{
+	std::vector<uint32_t> Table;
+	if (!LoadDirectionNumbers(JoeKuoPath, NumDimensions, Table))
+		return false;
+
+	std::ofstream File(OutputPath);
+	if (!File.is_open())
+	{
+		LOG_E(std::format("Failed to write Sobol direction table '{}'", OutputPath));
+		return false;
+	}
+
+	const size_t Dimensions = Table.size() / 32;
+
+	File << "#pragma once\n\n";
+	File << "#include <cstdint>\n\n";
+	File << "// Generated by KH_Sobol::ExportDirectionTable from new-joe-kuo-6.21201, do not edit.\n";
+	File << "// 32 direction numbers V[1]-V[32] per dimension, stored contiguously.\n";
+	File << std::format("constexpr uint32_t KH_SOBOL_TABLE_DIMENSIONS = {};\n\n", Dimensions);
+	File << "constexpr uint32_t KH_SobolDirectionTable[KH_SOBOL_TABLE_DIMENSIONS * 32] = {\n";
+
+	for (size_t d = 0; d < Dimensions; d++)
+	{
+		File << std::format("\t// dimension {}\n", d);
+		for (size_t Row = 0; Row < 4; Row++)
+		{
+			File << "\t";
+			for (size_t k = 0; k < 8; k++)
+			{
+				File << std::format("0x{:08X}u,", Table[d * 32 + Row * 8 + k]);
+				File << (k == 7 ? "\n" : " ");
+			}
+		}
+	}
+
+	File << "};\n";
+
+	LOG_D(std::format("Exported {} Sobol dimensions to '{}'", Dimensions, OutputPath));
+	return true;
 }
 
 float KH_LowDiscrepancySequence::Halton(int Dimension, int Index)
@@ -555,4 +611,75 @@ float KH_LowDiscrepancySequence::Hammersley(int Dimension, int Index, int NumSam
 		return RadicalInverse(NthPrimeNumber(Dimension - 1), Index);
 }
 
+float KH_AliasTable::Build(const float* Weights, uint32_t Count, std::vector<float>& OutThreshold, std::vector<uint32_t>& OutAlias)
+{
+	OutThreshold.assign(Count, 1.0f);
+	OutAlias.resize(Count);
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		OutAlias[i] = i;
+	}
+
+	double Sum = 0.0;
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		Sum += Weights[i];
+	}
+
+	if (Count == 0 || Sum <= 0.0)
+		return 0.0f;
+
+	std::vector<float> Scaled(Count);
+	std::vector<uint32_t> Small;
+	std::vector<uint32_t> Large;
+	Small.reserve(Count);
+	Large.reserve(Count);
+
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		Scaled[i] = static_cast<float>(Weights[i] * Count / Sum);
+		if (Scaled[i] < 1.0f)
+			Small.push_back(i);
+		else
+			Large.push_back(i);
+	}
+
+	while (!Small.empty() && !Large.empty())
+	{
+		uint32_t S = Small.back();
+		Small.pop_back();
+		uint32_t L = Large.back();
+
+		OutThreshold[S] = Scaled[S];
+		OutAlias[S] = L;
+
+		Scaled[L] = (Scaled[L] + Scaled[S]) - 1.0f;
+		if (Scaled[L] < 1.0f)
+		{
+			Large.pop_back();
+			Small.push_back(L);
+		}
+	}
+
+	// 剩余项只受浮点误差影响，直接保留自身
+	for (uint32_t i : Small)
+		OutThreshold[i] = 1.0f;
+	for (uint32_t i : Large)
+		OutThreshold[i] = 1.0f;
+
+	return static_cast<float>(Sum);
+}
+
+uint64_t KH_Hash::FNV1a64(const void* Data, size_t Size, uint64_t Seed)
+{
+	const uint8_t* Bytes = static_cast<const uint8_t*>(Data);
 
+	uint64_t Hash = Seed;
+	for (size_t i = 0; i < Size; i++)
+	{
+		Hash ^= Bytes[i];
+		Hash *= 1099511628211ull;
+	}
+
+	return Hash;
+}
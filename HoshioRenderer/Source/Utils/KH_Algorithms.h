@@ -7,11 +7,13 @@
 class KH_ScanCPU
 {
 public:
-	KH_ScanCPU(std::vector<int>& Data);
+	// bPrintStages 为 false 时不打印每一层的中间结果（计时用）
+	KH_ScanCPU(std::vector<int>& Data, bool bPrintStages = true);
 	~KH_ScanCPU() = default;
 
 	std::vector<int> Data;
 	int Depth;
+	bool bPrintStages;
 
 	void ProcessScanCPU();
 
@@ -110,4 +112,23 @@ public:
 
 	static std::vector<uint32_t> GenerateDirectionNumbers(uint32_t D, uint32_t S, uint32_t A, std::vector<uint32_t>& M);
 
+	// 解析 joe-kuo 文本，得到前 NumDimensions 维的方向数（每维 32 个）
+	static bool LoadDirectionNumbers(const std::string& JoeKuoPath, uint32_t NumDimensions, std::vector<uint32_t>& OutTable);
+
+	// 生成 KH_SobolTable.h，运行时无需再解析文本
+	static bool ExportDirectionTable(const std::string& JoeKuoPath, const std::string& OutputPath, uint32_t NumDimensions);
+
+};
+
+class KH_AliasTable
+{
+public:
+	// Vose 算法，Threshold[i] 为保留 i 的概率，否则取 Alias[i]；权重和为 0 时退化为均匀分布
+	static float Build(const float* Weights, uint32_t Count, std::vector<float>& OutThreshold, std::vector<uint32_t>& OutAlias);
+};
+
+class KH_Hash
+{
+public:
+	static uint64_t FNV1a64(const void* Data, size_t Size, uint64_t Seed = 14695981039346656037ull);
 };
@@ -0,0 +1,406 @@
+#include "KH_JobSystem.h"
+
+#include "KH_DebugUtils.h"
+#include "KH_Profiler.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+struct KH_Job
+{
+	std::function<void()> Function;
+	KH_JobQueue Queue = KH_JobQueue::Worker;
+
+	// 初值 1 是提交者持有的引用，登记完依赖后释放
+	std::atomic<uint32_t> PendingDependencies = 1;
+	std::atomic<bool> bDone = false;
+
+	std::mutex Mutex;
+	bool bFinished = false;
+	std::vector<std::shared_ptr<KH_Job>> Successors;
+};
+
+namespace
+{
+	// 工作线程的编号，非工作线程为 -1
+	thread_local int tWorkerIndex = -1;
+
+	void PinThread(std::thread& thread, uint32_t core)
+	{
+#ifdef _WIN32
+		SetThreadAffinityMask(static_cast<HANDLE>(thread.native_handle()), DWORD_PTR(1) << (core % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(core, &set);
+		pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+		(void)thread;
+		(void)core;
+#endif
+	}
+}
+
+bool KH_JobHandle::IsDone() const
+{
+	return !Job || Job->bDone.load(std::memory_order_acquire);
+}
+
+KH_JobSystem::~KH_JobSystem()
+{
+	Shutdown();
+}
+
+void KH_JobSystem::Initialize(const KH_JobSystemSettings& settings)
+{
+	std::lock_guard lock(LifecycleMutex);
+
+	if (bInitialized)
+		StopWorkers();
+
+	MainThreadID = std::this_thread::get_id();
+	StartWorkers(settings);
+	bInitialized = true;
+}
+
+void KH_JobSystem::Shutdown()
+{
+	std::lock_guard lock(LifecycleMutex);
+
+	if (!bInitialized)
+		return;
+
+	StopWorkers();
+	bInitialized = false;
+}
+
+void KH_JobSystem::EnsureInitialized()
+{
+	std::lock_guard lock(LifecycleMutex);
+
+	if (bInitialized)
+		return;
+
+	// 未显式初始化时按默认设置启动，首次提交任务的线程不一定是渲染线程，保留已有记录
+	if (MainThreadID == std::thread::id())
+		MainThreadID = std::this_thread::get_id();
+
+	StartWorkers({});
+	bInitialized = true;
+}
+
+uint32_t KH_JobSystem::GetWorkerCount() const
+{
+	return static_cast<uint32_t>(Workers.size());
+}
+
+bool KH_JobSystem::IsMainThread() const
+{
+	return std::this_thread::get_id() == MainThreadID;
+}
+
+void KH_JobSystem::StartWorkers(const KH_JobSystemSettings& settings)
+{
+	const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+	const uint32_t workerCount = settings.WorkerCount > 0 ? settings.WorkerCount : hardwareThreads - 1;
+
+	bStopping = false;
+
+	WorkerQueues.clear();
+	for (uint32_t i = 0; i < workerCount; ++i)
+		WorkerQueues.push_back(std::make_unique<KH_WorkerQueue>());
+
+	Workers.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		Workers.emplace_back([this, i]() { WorkerLoop(static_cast<int>(i)); });
+
+		if (settings.bPinWorkers)
+			PinThread(Workers.back(), (i + 1) % hardwareThreads);
+	}
+
+	LOG_D(std::format("Job system: {} worker threads{}", workerCount, settings.bPinWorkers ? " (pinned)" : ""));
+}
+
+void KH_JobSystem::StopWorkers()
+{
+	{
+		std::lock_guard lock(WakeMutex);
+		bStopping = true;
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& worker : Workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+
+	Workers.clear();
+	WorkerQueues.clear();
+}
+
+KH_JobHandle KH_JobSystem::Schedule(std::function<void()> function, KH_JobQueue queue, std::initializer_list<KH_JobHandle> dependencies)
+{
+	EnsureInitialized();
+
+	auto job = std::make_shared<KH_Job>();
+	job->Function = std::move(function);
+	job->Queue = queue;
+
+	for (const KH_JobHandle& dependency : dependencies)
+	{
+		if (!dependency.Job)
+			continue;
+
+		std::lock_guard lock(dependency.Job->Mutex);
+		if (dependency.Job->bFinished)
+			continue;
+
+		job->PendingDependencies.fetch_add(1, std::memory_order_relaxed);
+		dependency.Job->Successors.push_back(job);
+	}
+
+	if (job->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		Enqueue(job);
+
+	return KH_JobHandle(job);
+}
+
+void KH_JobSystem::Enqueue(const std::shared_ptr<KH_Job>& job)
+{
+	if (job->Queue == KH_JobQueue::MainThread)
+	{
+		std::lock_guard lock(MainThreadMutex);
+		MainThreadQueue.push_back(job);
+		return;
+	}
+
+	// 先计数再入队，计数只会多不会少，工作线程不会在有任务时睡下
+	QueuedJobs.fetch_add(1, std::memory_order_release);
+
+	if (job->Queue == KH_JobQueue::Background)
+	{
+		std::lock_guard lock(BackgroundMutex);
+		BackgroundQueue.push_back(job);
+	}
+	else if (tWorkerIndex >= 0 && tWorkerIndex < static_cast<int>(WorkerQueues.size()))
+	{
+		// 工作线程产生的任务留在自己的队列里，缓存更热
+		KH_WorkerQueue& local = *WorkerQueues[tWorkerIndex];
+		std::lock_guard lock(local.Mutex);
+		local.Jobs.push_back(job);
+	}
+	else
+	{
+		std::lock_guard lock(InjectionMutex);
+		InjectionQueue.push_back(job);
+	}
+
+	{
+		// 经过一次 WakeMutex，避免工作线程检查完条件、尚未睡下时错过唤醒
+		std::lock_guard lock(WakeMutex);
+	}
+	WakeCondition.notify_one();
+}
+
+void KH_JobSystem::Execute(const std::shared_ptr<KH_Job>& job)
+{
+	if (job->Function)
+		job->Function();
+
+	// 先释放闭包持有的资源，句柄可能比任务存活得久
+	job->Function = nullptr;
+
+	std::vector<std::shared_ptr<KH_Job>> successors;
+	{
+		std::lock_guard lock(job->Mutex);
+		job->bFinished = true;
+		successors.swap(job->Successors);
+	}
+	job->bDone.store(true, std::memory_order_release);
+
+	for (const std::shared_ptr<KH_Job>& successor : successors)
+	{
+		if (successor->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			Enqueue(successor);
+	}
+}
+
+std::shared_ptr<KH_Job> KH_JobSystem::PopWorkerJob(int workerIndex)
+{
+	const int queueCount = static_cast<int>(WorkerQueues.size());
+
+	if (workerIndex >= 0 && workerIndex < queueCount)
+	{
+		KH_WorkerQueue& local = *WorkerQueues[workerIndex];
+		std::lock_guard lock(local.Mutex);
+		if (!local.Jobs.empty())
+		{
+			std::shared_ptr<KH_Job> job = std::move(local.Jobs.back());
+			local.Jobs.pop_back();
+			QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	{
+		std::lock_guard lock(InjectionMutex);
+		if (!InjectionQueue.empty())
+		{
+			std::shared_ptr<KH_Job> job = std::move(InjectionQueue.front());
+			InjectionQueue.pop_front();
+			QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	// 从相邻的队列开始窃取，分散竞争
+	for (int offset = 1; offset <= queueCount; ++offset)
+	{
+		const int victim = (std::max(workerIndex, 0) + offset) % queueCount;
+		if (victim == workerIndex)
+			continue;
+
+		KH_WorkerQueue& queue = *WorkerQueues[victim];
+		std::lock_guard lock(queue.Mutex);
+		if (!queue.Jobs.empty())
+		{
+			std::shared_ptr<KH_Job> job = std::move(queue.Jobs.front());
+			queue.Jobs.pop_front();
+			QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	return nullptr;
+}
+
+bool KH_JobSystem::TryTakeJob(const std::shared_ptr<KH_Job>& job)
+{
+	auto take = [&](std::deque<std::shared_ptr<KH_Job>>& jobs)
+	{
+		auto it = std::find(jobs.begin(), jobs.end(), job);
+		if (it == jobs.end())
+			return false;
+
+		jobs.erase(it);
+		QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	};
+
+	{
+		std::lock_guard lock(InjectionMutex);
+		if (take(InjectionQueue))
+			return true;
+	}
+
+	// 依赖完成时由工作线程入队的任务会进入该工作线程的队列
+	for (const std::unique_ptr<KH_WorkerQueue>& queue : WorkerQueues)
+	{
+		std::lock_guard lock(queue->Mutex);
+		if (take(queue->Jobs))
+			return true;
+	}
+
+	return false;
+}
+
+std::shared_ptr<KH_Job> KH_JobSystem::PopBackgroundJob()
+{
+	std::lock_guard lock(BackgroundMutex);
+	if (BackgroundQueue.empty())
+		return nullptr;
+
+	std::shared_ptr<KH_Job> job = std::move(BackgroundQueue.front());
+	BackgroundQueue.pop_front();
+	QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+	return job;
+}
+
+void KH_JobSystem::WorkerLoop(int workerIndex)
+{
+	tWorkerIndex = workerIndex;
+	KH_Profiler::Instance().SetThreadName(std::format("Worker {}", workerIndex));
+
+	for (;;)
+	{
+		std::shared_ptr<KH_Job> job = PopWorkerJob(workerIndex);
+		if (!job)
+			job = PopBackgroundJob();
+
+		if (job)
+		{
+			Execute(job);
+			continue;
+		}
+
+		std::unique_lock lock(WakeMutex);
+		// 停止前先把队列清空，已提交的任务都会执行
+		if (bStopping && QueuedJobs.load(std::memory_order_acquire) == 0)
+			return;
+
+		WakeCondition.wait(lock, [this]()
+		{
+			return bStopping || QueuedJobs.load(std::memory_order_acquire) > 0;
+		});
+	}
+}
+
+void KH_JobSystem::Wait(const KH_JobHandle& handle)
+{
+	while (!handle.IsDone())
+	{
+		if (tWorkerIndex >= 0)
+		{
+			if (std::shared_ptr<KH_Job> job = PopWorkerJob(tWorkerIndex))
+			{
+				Execute(job);
+				continue;
+			}
+		}
+		else if (handle.Job->Queue == KH_JobQueue::Worker && TryTakeJob(handle.Job))
+		{
+			Execute(handle.Job);
+			continue;
+		}
+
+		std::this_thread::yield();
+	}
+}
+
+uint32_t KH_JobSystem::RunMainThreadJobs(float budgetMilliseconds)
+{
+	const auto start = std::chrono::steady_clock::now();
+	uint32_t executed = 0;
+
+	for (;;)
+	{
+		if (budgetMilliseconds > 0.0f && executed > 0 &&
+			std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count() > budgetMilliseconds)
+		{
+			break;
+		}
+
+		std::shared_ptr<KH_Job> job;
+		{
+			std::lock_guard lock(MainThreadMutex);
+			if (MainThreadQueue.empty())
+				break;
+
+			job = std::move(MainThreadQueue.front());
+			MainThreadQueue.pop_front();
+		}
+
+		Execute(job);
+		++executed;
+	}
+
+	return executed;
+}
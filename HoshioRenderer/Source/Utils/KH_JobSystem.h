@@ -0,0 +1,192 @@
+#pragma once
+
+#include "KH_Common.h"
+
+#include <deque>
+#include <condition_variable>
+
+enum class KH_JobQueue : uint8_t
+{
+	// 短小的计算任务：进入各工作线程的双端队列，空闲线程从队首窃取；等待者会帮忙执行
+	Worker,
+	// 长时间或阻塞 IO 的任务（解码、导入、写盘），只由空闲的工作线程领取，等待者不会代为执行
+	Background,
+	// 需要 GL 上下文的任务，由渲染线程在 RunMainThreadJobs 中执行
+	MainThread
+};
+
+struct KH_JobSystemSettings
+{
+	// 0 表示 hardware_concurrency - 1，至少 1 个
+	uint32_t WorkerCount = 0;
+	// 把第 i 个工作线程绑定到第 i + 1 个逻辑核，核 0 留给渲染线程
+	bool bPinWorkers = false;
+};
+
+struct KH_Job;
+
+class KH_JobHandle
+{
+public:
+	KH_JobHandle() = default;
+
+	bool IsValid() const { return Job != nullptr; }
+	bool IsDone() const;
+
+private:
+	friend class KH_JobSystem;
+
+	explicit KH_JobHandle(std::shared_ptr<KH_Job> job) : Job(std::move(job)) {}
+
+	std::shared_ptr<KH_Job> Job;
+};
+
+// 全局作业系统：线程数与绑核只在这里决定。每个工作线程持有自己的双端队列，
+// 本线程产生的任务压入队尾并从队尾取（LIFO），空闲线程从其他队列的队首窃取；
+// 非工作线程提交的任务进入共享注入队列。任务可依赖其他任务，依赖全部完成后才进入对应队列
+class KH_JobSystem : public KH_Singleton<KH_JobSystem>
+{
+	friend class KH_Singleton<KH_JobSystem>;
+
+public:
+	// 调用线程记为渲染线程。重复调用会先等待现有任务完成再按新设置重建线程
+	void Initialize(const KH_JobSystemSettings& settings = {});
+	// 执行完所有已排队的工作与后台任务后退出工作线程
+	void Shutdown();
+
+	uint32_t GetWorkerCount() const;
+	bool IsMainThread() const;
+
+	KH_JobHandle Schedule(std::function<void()> function,
+		KH_JobQueue queue = KH_JobQueue::Worker,
+		std::initializer_list<KH_JobHandle> dependencies = {});
+
+	// 等待 handle 完成。工作线程会协助执行工作队列中的任意任务；非工作线程（如渲染线程）只会代为执行
+	// handle 自己尚未被领取的任务，不会领到其他线程提交的长任务而卡住一帧。不会代为执行后台任务与主线程任务
+	void Wait(const KH_JobHandle& handle);
+
+	// 渲染线程每帧调用；超过 budgetMilliseconds 后留到下一帧（<= 0 不限），返回执行的任务数
+	uint32_t RunMainThreadJobs(float budgetMilliseconds = 0.0f);
+
+	// 以后台任务执行 function，结果通过 future 取回
+	template<typename F>
+	auto Async(F&& function) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+	{
+		using TResult = std::invoke_result_t<std::decay_t<F>>;
+
+		auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<F>(function));
+		std::future<TResult> future = task->get_future();
+		Schedule([task]() { (*task)(); }, KH_JobQueue::Background);
+		return future;
+	}
+
+	// 把 [begin, end) 按 grain 切块，调用线程与工作线程通过原子游标动态领取，body(i) 逐个调用
+	template<typename F>
+	void ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, F&& body)
+	{
+		if (end <= begin)
+			return;
+
+		EnsureInitialized();
+
+		grain = std::max(grain, 1u);
+		const uint64_t chunkCount = (static_cast<uint64_t>(end - begin) + grain - 1) / grain;
+		const uint32_t helperCount = static_cast<uint32_t>(std::min<uint64_t>(chunkCount, GetWorkerCount() + 1)) - 1;
+
+		std::atomic<uint64_t> next = begin;
+		auto runChunks = [&]()
+		{
+			for (;;)
+			{
+				const uint64_t first = next.fetch_add(grain, std::memory_order_relaxed);
+				if (first >= end)
+					return;
+
+				const uint32_t last = static_cast<uint32_t>(std::min<uint64_t>(first + grain, end));
+				for (uint32_t i = static_cast<uint32_t>(first); i < last; ++i)
+					body(i);
+			}
+		};
+
+		std::vector<KH_JobHandle> helpers;
+		helpers.reserve(helperCount);
+		for (uint32_t i = 0; i < helperCount; ++i)
+			helpers.push_back(Schedule(runChunks));
+
+		runChunks();
+
+		for (const KH_JobHandle& helper : helpers)
+			Wait(helper);
+	}
+
+	// 每块 map(first, last) 得到部分结果，再按块序用 reduce 合并，结果与线程数无关
+	template<typename T, typename MapF, typename ReduceF>
+	T ParallelReduce(uint32_t begin, uint32_t end, uint32_t grain, T identity, MapF&& map, ReduceF&& reduce)
+	{
+		if (end <= begin)
+			return identity;
+
+		grain = std::max(grain, 1u);
+		const uint32_t chunkCount = static_cast<uint32_t>((static_cast<uint64_t>(end - begin) + grain - 1) / grain);
+
+		std::vector<T> partials(chunkCount, identity);
+		ParallelFor(0, chunkCount, 1, [&](uint32_t chunk)
+		{
+			const uint32_t first = begin + chunk * grain;
+			const uint32_t last = static_cast<uint32_t>(std::min<uint64_t>(static_cast<uint64_t>(first) + grain, end));
+			partials[chunk] = map(first, last);
+		});
+
+		T result = identity;
+		for (const T& partial : partials)
+			result = reduce(result, partial);
+		return result;
+	}
+
+private:
+	KH_JobSystem() = default;
+	~KH_JobSystem() override;
+
+	KH_JobSystem(const KH_JobSystem&) = delete;
+	KH_JobSystem& operator=(const KH_JobSystem&) = delete;
+
+	struct KH_WorkerQueue
+	{
+		std::mutex Mutex;
+		std::deque<std::shared_ptr<KH_Job>> Jobs;
+	};
+
+	std::vector<std::thread> Workers;
+	std::vector<std::unique_ptr<KH_WorkerQueue>> WorkerQueues;
+	std::thread::id MainThreadID;
+	bool bInitialized = false;
+	std::mutex LifecycleMutex;
+
+	std::mutex InjectionMutex;
+	std::deque<std::shared_ptr<KH_Job>> InjectionQueue;
+
+	std::mutex BackgroundMutex;
+	std::deque<std::shared_ptr<KH_Job>> BackgroundQueue;
+
+	std::mutex MainThreadMutex;
+	std::deque<std::shared_ptr<KH_Job>> MainThreadQueue;
+
+	// 工作线程可领取的任务数（不含主线程队列），用于休眠与唤醒
+	std::atomic<uint32_t> QueuedJobs = 0;
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+	bool bStopping = false;
+
+	void EnsureInitialized();
+	void StartWorkers(const KH_JobSystemSettings& settings);
+	void StopWorkers();
+
+	void Enqueue(const std::shared_ptr<KH_Job>& job);
+	void Execute(const std::shared_ptr<KH_Job>& job);
+
+	std::shared_ptr<KH_Job> PopWorkerJob(int workerIndex);
+	// 若 job 仍在注入队列或某个工作线程队列中，将其取出
+	bool TryTakeJob(const std::shared_ptr<KH_Job>& job);
+	std::shared_ptr<KH_Job> PopBackgroundJob();
+	void WorkerLoop(int workerIndex);
+};
@@ -0,0 +1,120 @@
+#include "KH_MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+KH_MappedFile::~KH_MappedFile()
+{
+	Close();
+}
+
+#ifdef _WIN32
+
+bool KH_MappedFile::Open(const std::string& path)
+{
+	Close();
+
+	const std::wstring widePath = std::filesystem::path(path).wstring();
+	HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize{};
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	FileHandle = file;
+	MappingHandle = mapping;
+	Data = static_cast<const unsigned char*>(view);
+	Size = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void KH_MappedFile::Close()
+{
+	if (Data)
+		UnmapViewOfFile(Data);
+	if (MappingHandle)
+		CloseHandle(MappingHandle);
+	if (FileHandle)
+		CloseHandle(FileHandle);
+
+	Data = nullptr;
+	Size = 0;
+	MappingHandle = nullptr;
+	FileHandle = nullptr;
+}
+
+#else
+
+bool KH_MappedFile::Open(const std::string& path)
+{
+	Close();
+
+	const int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat info {};
+	if (fstat(fd, &info) != 0 || info.st_size <= 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	if (view == MAP_FAILED)
+	{
+		close(fd);
+		return false;
+	}
+
+	// 只做一次顺序扫描后上传，提示内核预读
+	madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+	FileDescriptor = fd;
+	Data = static_cast<const unsigned char*>(view);
+	Size = static_cast<size_t>(info.st_size);
+	return true;
+}
+
+void KH_MappedFile::Close()
+{
+	if (Data)
+		munmap(const_cast<unsigned char*>(Data), Size);
+	if (FileDescriptor >= 0)
+		close(FileDescriptor);
+
+	Data = nullptr;
+	Size = 0;
+	FileDescriptor = -1;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "KH_Common.h"
+
+// 只读内存映射文件，析构或 Close 时解除映射
+class KH_MappedFile
+{
+public:
+	KH_MappedFile() = default;
+	~KH_MappedFile();
+
+	KH_MappedFile(const KH_MappedFile&) = delete;
+	KH_MappedFile& operator=(const KH_MappedFile&) = delete;
+
+	bool Open(const std::string& path);
+	void Close();
+
+	bool IsOpen() const { return Data != nullptr; }
+	const unsigned char* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	const unsigned char* Data = nullptr;
+	size_t Size = 0;
+
+#ifdef _WIN32
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+#else
+	int FileDescriptor = -1;
+#endif
+};
@@ -0,0 +1,355 @@
+#include "KH_Profiler.h"
+
+#include "KH_DebugUtils.h"
+
+namespace
+{
+	struct KH_OpenCpuScope
+	{
+		const char* Name = "";
+		double BeginMicroseconds = 0.0;
+	};
+
+	thread_local std::vector<KH_OpenCpuScope> tCpuScopes;
+	thread_local uint32_t tThreadIndex = std::numeric_limits<uint32_t>::max();
+
+	void AppendJsonString(std::string& out, std::string_view text)
+	{
+		out += '"';
+		for (const char c : text)
+		{
+			switch (c)
+			{
+			case '"':  out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+					out += std::format("\\u{:04x}", static_cast<unsigned int>(c));
+				else
+					out += c;
+				break;
+			}
+		}
+		out += '"';
+	}
+}
+
+KH_Profiler::KH_Profiler()
+	: Origin(std::chrono::steady_clock::now())
+{
+}
+
+void KH_Profiler::Shutdown()
+{
+	bRequestedEnabled = false;
+	bEnabled.store(false, std::memory_order_relaxed);
+	GpuScopeStack.clear();
+
+	for (KH_GpuFrameSlot& slot : GpuSlots)
+	{
+		if (!slot.Queries.empty())
+			glDeleteQueries(static_cast<GLsizei>(slot.Queries.size()), slot.Queries.data());
+
+		slot.Queries.clear();
+		slot.Scopes.clear();
+		slot.bIssued = false;
+		slot.LastQuery = 0;
+	}
+}
+
+double KH_Profiler::NowMicroseconds() const
+{
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - Origin).count();
+}
+
+uint32_t KH_Profiler::GetThreadIndex()
+{
+	if (tThreadIndex == std::numeric_limits<uint32_t>::max())
+	{
+		std::lock_guard lock(NameMutex);
+		tThreadIndex = static_cast<uint32_t>(ThreadNames.size());
+		ThreadNames.push_back(std::format("Thread {}", tThreadIndex));
+	}
+
+	return tThreadIndex;
+}
+
+void KH_Profiler::SetThreadName(const std::string& name)
+{
+	const uint32_t index = GetThreadIndex();
+
+	std::lock_guard lock(NameMutex);
+	ThreadNames[index] = name;
+}
+
+std::vector<std::string> KH_Profiler::GetThreadNames() const
+{
+	std::lock_guard lock(NameMutex);
+	return ThreadNames;
+}
+
+const char* KH_Profiler::InternName(const std::string& name)
+{
+	std::lock_guard lock(NameMutex);
+	return InternedNames.insert(name).first->c_str();
+}
+
+void KH_Profiler::BeginFrame()
+{
+	RenderThreadIndex = GetThreadIndex();
+
+	CloseFrame();
+
+	for (KH_GpuFrameSlot& slot : GpuSlots)
+		ResolveGpuSlot(slot);
+
+	bEnabled.store(bRequestedEnabled, std::memory_order_relaxed);
+	if (bRequestedEnabled)
+		OpenFrame();
+}
+
+void KH_Profiler::OpenFrame()
+{
+	++FrameIndex;
+
+	// 轮到的查询槽仍未取回说明 GPU 落后超过 GpuFrameLatency 帧，默认丢弃那一帧的 GPU 数据而不是等待
+	KH_GpuFrameSlot& slot = GpuSlots[FrameIndex % GpuFrameLatency];
+	ResolveGpuSlot(slot, bWaitForGpuResults);
+
+	slot.Scopes.clear();
+	slot.FrameIndex = FrameIndex;
+	slot.bIssued = false;
+	slot.LastQuery = 0;
+	glGetInteger64v(GL_TIMESTAMP, &slot.GpuReference);
+	slot.CpuReference = NowMicroseconds();
+
+	GpuScopeStack.clear();
+
+	std::lock_guard lock(CpuMutex);
+	CurrentFrame = KH_ProfileFrame();
+	CurrentFrame.FrameIndex = FrameIndex;
+	CurrentFrame.BeginMicroseconds = slot.CpuReference;
+	bFrameOpen = true;
+}
+
+void KH_Profiler::CloseFrame()
+{
+	KH_ProfileFrame frame;
+	{
+		std::lock_guard lock(CpuMutex);
+		if (!bFrameOpen)
+			return;
+
+		CurrentFrame.EndMicroseconds = NowMicroseconds();
+		frame = std::move(CurrentFrame);
+		CurrentFrame = KH_ProfileFrame();
+		bFrameOpen = false;
+	}
+
+	frame.bGpuResolved = !GpuSlots[frame.FrameIndex % GpuFrameLatency].bIssued;
+
+	if (bPaused)
+		return;
+
+	History.push_back(std::move(frame));
+	while (History.size() > HistoryFrames)
+		History.pop_front();
+}
+
+void KH_Profiler::BeginCpuScope(const char* name)
+{
+	tCpuScopes.push_back({ name, NowMicroseconds() });
+}
+
+void KH_Profiler::EndCpuScope()
+{
+	if (tCpuScopes.empty())
+		return;
+
+	const KH_OpenCpuScope scope = tCpuScopes.back();
+	tCpuScopes.pop_back();
+
+	KH_ProfileEvent event;
+	event.Name = scope.Name;
+	event.Depth = static_cast<uint32_t>(tCpuScopes.size());
+	event.ThreadIndex = GetThreadIndex();
+	event.BeginMicroseconds = scope.BeginMicroseconds;
+	event.EndMicroseconds = NowMicroseconds();
+
+	std::lock_guard lock(CpuMutex);
+	if (bFrameOpen)
+		CurrentFrame.CpuEvents.push_back(event);
+}
+
+void KH_Profiler::BeginGpuScope(const char* name)
+{
+	KH_GpuFrameSlot& slot = GpuSlots[FrameIndex % GpuFrameLatency];
+
+	if (!bFrameOpen || slot.Scopes.size() >= MaxGpuScopesPerFrame)
+	{
+		GpuScopeStack.push_back(-1);
+		return;
+	}
+
+	if (slot.Queries.empty())
+	{
+		slot.Queries.resize(MaxGpuScopesPerFrame * 2);
+		glCreateQueries(GL_TIMESTAMP, static_cast<GLsizei>(slot.Queries.size()), slot.Queries.data());
+	}
+
+	const uint32_t index = static_cast<uint32_t>(slot.Scopes.size());
+
+	KH_GpuScope scope;
+	scope.Name = name;
+	scope.Depth = static_cast<uint32_t>(GpuScopeStack.size());
+	scope.BeginQuery = index * 2;
+	scope.EndQuery = index * 2 + 1;
+
+	glQueryCounter(slot.Queries[scope.BeginQuery], GL_TIMESTAMP);
+
+	slot.Scopes.push_back(scope);
+	GpuScopeStack.push_back(static_cast<int>(index));
+}
+
+void KH_Profiler::EndGpuScope()
+{
+	if (GpuScopeStack.empty())
+		return;
+
+	const int index = GpuScopeStack.back();
+	GpuScopeStack.pop_back();
+	if (index < 0)
+		return;
+
+	KH_GpuFrameSlot& slot = GpuSlots[FrameIndex % GpuFrameLatency];
+	const uint32_t query = slot.Scopes[index].EndQuery;
+
+	glQueryCounter(slot.Queries[query], GL_TIMESTAMP);
+	slot.LastQuery = query;
+	slot.bIssued = true;
+}
+
+bool KH_Profiler::ResolveGpuSlot(KH_GpuFrameSlot& slot, bool bWait)
+{
+	if (!slot.bIssued)
+		return true;
+
+	if (!bWait)
+	{
+		GLint available = 0;
+		glGetQueryObjectiv(slot.Queries[slot.LastQuery], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			return false;
+	}
+
+	std::vector<KH_ProfileEvent> events;
+	events.reserve(slot.Scopes.size());
+
+	for (const KH_GpuScope& scope : slot.Scopes)
+	{
+		GLuint64 begin = 0;
+		GLuint64 end = 0;
+		glGetQueryObjectui64v(slot.Queries[scope.BeginQuery], GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(slot.Queries[scope.EndQuery], GL_QUERY_RESULT, &end);
+
+		KH_ProfileEvent event;
+		event.Name = scope.Name;
+		event.Depth = scope.Depth;
+		event.ThreadIndex = GpuThreadIndex;
+		event.BeginMicroseconds = slot.CpuReference + static_cast<double>(static_cast<GLint64>(begin) - slot.GpuReference) / 1000.0;
+		event.EndMicroseconds = slot.CpuReference + static_cast<double>(static_cast<GLint64>(end) - slot.GpuReference) / 1000.0;
+		events.push_back(event);
+	}
+
+	slot.bIssued = false;
+
+	for (auto it = History.rbegin(); it != History.rend(); ++it)
+	{
+		if (it->FrameIndex == slot.FrameIndex)
+		{
+			it->GpuEvents = std::move(events);
+			it->bGpuResolved = true;
+			break;
+		}
+	}
+
+	return true;
+}
+
+const KH_ProfileFrame* KH_Profiler::GetLatestFrame() const
+{
+	for (auto it = History.rbegin(); it != History.rend(); ++it)
+	{
+		if (it->bGpuResolved)
+			return &*it;
+	}
+
+	return nullptr;
+}
+
+bool KH_Profiler::ExportChromeTrace(const std::string& filePath) const
+{
+	std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool bFirst = true;
+
+	auto AppendSeparator = [&]()
+	{
+		if (!bFirst)
+			json += ",\n";
+		bFirst = false;
+	};
+
+	auto AppendThreadName = [&](uint32_t threadIndex, std::string_view name)
+	{
+		AppendSeparator();
+		json += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":", threadIndex);
+		AppendJsonString(json, name);
+		json += "}}";
+	};
+
+	auto AppendEvent = [&](std::string_view name, const char* category, uint32_t threadIndex, double begin, double end)
+	{
+		AppendSeparator();
+		json += "{\"name\":";
+		AppendJsonString(json, name);
+		json += std::format(",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+			category, threadIndex, begin, std::max(end - begin, 0.0));
+	};
+
+	const std::vector<std::string> threadNames = GetThreadNames();
+	for (uint32_t i = 0; i < threadNames.size(); ++i)
+		AppendThreadName(i, threadNames[i]);
+	AppendThreadName(GpuThreadIndex, "GPU");
+
+	for (const KH_ProfileFrame& frame : History)
+	{
+		AppendEvent(std::format("Frame {}", frame.FrameIndex), "Frame", RenderThreadIndex, frame.BeginMicroseconds, frame.EndMicroseconds);
+
+		for (const KH_ProfileEvent& event : frame.CpuEvents)
+			AppendEvent(event.Name, "CPU", event.ThreadIndex, event.BeginMicroseconds, event.EndMicroseconds);
+
+		for (const KH_ProfileEvent& event : frame.GpuEvents)
+			AppendEvent(event.Name, "GPU", GpuThreadIndex, event.BeginMicroseconds, event.EndMicroseconds);
+	}
+
+	json += "\n]}\n";
+
+	std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		LOG_E(std::format("Profiler: failed to open {}", filePath));
+		return false;
+	}
+
+	file.write(json.data(), static_cast<std::streamsize>(json.size()));
+	if (!file)
+	{
+		LOG_E(std::format("Profiler: failed to write {}", filePath));
+		return false;
+	}
+
+	LOG_D(std::format("Profiler: exported {} frames to {}", History.size(), filePath));
+	return true;
+}
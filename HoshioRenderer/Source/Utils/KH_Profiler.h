@@ -0,0 +1,209 @@
+#pragma once
+
+#include "KH_Common.h"
+
+#include <deque>
+
+struct KH_ProfileEvent
+{
+	const char* Name = "";
+	uint32_t Depth = 0;
+	uint32_t ThreadIndex = 0;
+
+	// 相对 profiler 创建时刻的微秒，GPU 事件已换算到 CPU 时间轴
+	double BeginMicroseconds = 0.0;
+	double EndMicroseconds = 0.0;
+
+	double GetMilliseconds() const { return (EndMicroseconds - BeginMicroseconds) / 1000.0; }
+};
+
+struct KH_ProfileFrame
+{
+	uint64_t FrameIndex = 0;
+	double BeginMicroseconds = 0.0;
+	double EndMicroseconds = 0.0;
+
+	std::vector<KH_ProfileEvent> CpuEvents;
+	std::vector<KH_ProfileEvent> GpuEvents;
+
+	// GPU 结果要晚几帧才能取回；查询槽被复用前仍未就绪时丢弃，GpuEvents 保持为空
+	bool bGpuResolved = false;
+
+	double GetMilliseconds() const { return (EndMicroseconds - BeginMicroseconds) / 1000.0; }
+};
+
+// 分层帧分析器：CPU 作用域可在任意线程记录，按线程维护嵌套深度；
+// GPU 作用域只在渲染线程记录，用 glQueryCounter 时间戳，查询按帧轮换，
+// GpuFrameLatency 帧之后才读取结果，读取前先检查可用性，不会阻塞管线。
+// 保留最近 HistoryFrames 帧，可导出为 Chrome trace（chrome://tracing、Perfetto）
+class KH_Profiler : public KH_Singleton<KH_Profiler>
+{
+	friend class KH_Singleton<KH_Profiler>;
+
+public:
+	static constexpr uint32_t GpuFrameLatency = 3;
+	static constexpr uint32_t MaxGpuScopesPerFrame = 128;
+	static constexpr uint32_t HistoryFrames = 240;
+	// Chrome trace 中 GPU 时间线使用的线程号
+	static constexpr uint32_t GpuThreadIndex = 1000;
+
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+	// 在下一次 BeginFrame 时生效，避免同一帧内作用域不成对
+	void SetEnabled(bool bInEnabled) { bRequestedEnabled = bInEnabled; }
+
+	// 暂停时停止追加历史，面板与导出都停在暂停那一刻
+	bool IsPaused() const { return bPaused; }
+	void SetPaused(bool bInPaused) { bPaused = bInPaused; }
+
+	// 查询槽被复用时若结果未就绪则等待而不是丢弃。离线渲染不在乎停顿，开启后每帧都有 GPU 数据
+	void SetWaitForGpuResults(bool bWait) { bWaitForGpuResults = bWait; }
+
+	// 渲染线程每帧开始时调用：收尾上一帧，取回已就绪的 GPU 时间戳
+	void BeginFrame();
+
+	// 停止记录并删除 GPU 查询，须在 GL 上下文销毁前调用；析构函数不再调用 GL
+	void Shutdown();
+
+	void BeginCpuScope(const char* name);
+	void EndCpuScope();
+
+	// 需要 GL 上下文，只能在渲染线程调用
+	void BeginGpuScope(const char* name);
+	void EndGpuScope();
+
+	// 动态名称（如后处理 pass 名）转成常驻指针，供事件引用
+	const char* InternName(const std::string& name);
+	void SetThreadName(const std::string& name);
+	std::vector<std::string> GetThreadNames() const;
+	uint32_t GetRenderThreadIndex() const { return RenderThreadIndex; }
+
+	// 最近一帧 CPU 与 GPU 数据都已齐全的帧，没有时返回 nullptr；仅限渲染线程访问
+	const KH_ProfileFrame* GetLatestFrame() const;
+	const std::deque<KH_ProfileFrame>& GetHistory() const { return History; }
+
+	bool ExportChromeTrace(const std::string& filePath) const;
+
+	double NowMicroseconds() const;
+
+private:
+	KH_Profiler();
+	~KH_Profiler() override = default;
+
+	KH_Profiler(const KH_Profiler&) = delete;
+	KH_Profiler& operator=(const KH_Profiler&) = delete;
+
+	struct KH_GpuScope
+	{
+		const char* Name = "";
+		uint32_t Depth = 0;
+		uint32_t BeginQuery = 0;
+		uint32_t EndQuery = 0;
+	};
+
+	struct KH_GpuFrameSlot
+	{
+		std::vector<GLuint> Queries;
+		std::vector<KH_GpuScope> Scopes;
+		uint64_t FrameIndex = 0;
+		bool bIssued = false;
+		// 最后写入的时间戳查询，它可用时同一帧之前的查询都已可用
+		uint32_t LastQuery = 0;
+
+		// 同一时刻的 GPU 与 CPU 时钟，用于把时间戳换算到 CPU 时间轴
+		GLint64 GpuReference = 0;
+		double CpuReference = 0.0;
+	};
+
+	std::chrono::steady_clock::time_point Origin;
+
+	std::atomic<bool> bEnabled = false;
+	bool bRequestedEnabled = false;
+	bool bPaused = false;
+	bool bWaitForGpuResults = false;
+
+	uint64_t FrameIndex = 0;
+	uint32_t RenderThreadIndex = 0;
+
+	// 各线程结束的 CPU 作用域写入当前帧
+	mutable std::mutex CpuMutex;
+	KH_ProfileFrame CurrentFrame;
+	bool bFrameOpen = false;
+
+	std::array<KH_GpuFrameSlot, GpuFrameLatency> GpuSlots;
+	// 超出每帧上限的作用域记为 -1，仍然入栈以保持成对
+	std::vector<int> GpuScopeStack;
+
+	std::deque<KH_ProfileFrame> History;
+
+	mutable std::mutex NameMutex;
+	std::unordered_set<std::string> InternedNames;
+	std::vector<std::string> ThreadNames;
+
+	uint32_t GetThreadIndex();
+
+	void CloseFrame();
+	void OpenFrame();
+	// bWait 为 false 时结果未就绪直接返回 false
+	bool ResolveGpuSlot(KH_GpuFrameSlot& slot, bool bWait = false);
+};
+
+// RAII 作用域，构造时决定是否记录，析构与之成对
+class KH_CpuProfileScope
+{
+public:
+	explicit KH_CpuProfileScope(const char* name)
+		: bActive(KH_Profiler::Instance().IsEnabled())
+	{
+		if (bActive)
+			KH_Profiler::Instance().BeginCpuScope(name);
+	}
+
+	~KH_CpuProfileScope()
+	{
+		if (bActive)
+			KH_Profiler::Instance().EndCpuScope();
+	}
+
+	KH_CpuProfileScope(const KH_CpuProfileScope&) = delete;
+	KH_CpuProfileScope& operator=(const KH_CpuProfileScope&) = delete;
+
+private:
+	bool bActive;
+};
+
+// 同时记录 CPU 提交耗时与 GPU 执行耗时
+class KH_GpuProfileScope
+{
+public:
+	explicit KH_GpuProfileScope(const char* name)
+		: bActive(KH_Profiler::Instance().IsEnabled())
+	{
+		if (bActive)
+		{
+			KH_Profiler::Instance().BeginCpuScope(name);
+			KH_Profiler::Instance().BeginGpuScope(name);
+		}
+	}
+
+	~KH_GpuProfileScope()
+	{
+		if (bActive)
+		{
+			KH_Profiler::Instance().EndGpuScope();
+			KH_Profiler::Instance().EndCpuScope();
+		}
+	}
+
+	KH_GpuProfileScope(const KH_GpuProfileScope&) = delete;
+	KH_GpuProfileScope& operator=(const KH_GpuProfileScope&) = delete;
+
+private:
+	bool bActive;
+};
+
+#define KH_PROFILE_CONCAT_INNER(a, b) a##b
+#define KH_PROFILE_CONCAT(a, b) KH_PROFILE_CONCAT_INNER(a, b)
+
+// name 须为字符串常量或 InternName 的结果
+#define KH_PROFILE_SCOPE(name) KH_CpuProfileScope KH_PROFILE_CONCAT(khProfileScope, __LINE__)(name)
+#define KH_PROFILE_GPU_SCOPE(name) KH_GpuProfileScope KH_PROFILE_CONCAT(khGpuProfileScope, __LINE__)(name)
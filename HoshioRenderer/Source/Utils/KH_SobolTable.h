@@ -0,0 +1,650 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by KH_Sobol::ExportDirectionTable from new-joe-kuo-6.21201, do not edit.
+// 32 direction numbers V[1]-V[32] per dimension, stored contiguously.
+constexpr uint32_t KH_SOBOL_TABLE_DIMENSIONS = 128;
+
+constexpr uint32_t KH_SobolDirectionTable[KH_SOBOL_TABLE_DIMENSIONS * 32] = {
+	// dimension 0
+	0x80000000u, 0x40000000u, 0x20000000u, 0x10000000u, 0x08000000u, 0x04000000u, 0x02000000u, 0x01000000u,
+	0x00800000u, 0x00400000u, 0x00200000u, 0x00100000u, 0x00080000u, 0x00040000u, 0x00020000u, 0x00010000u,
+	0x00008000u, 0x00004000u, 0x00002000u, 0x00001000u, 0x00000800u, 0x00000400u, 0x00000200u, 0x00000100u,
+	0x00000080u, 0x00000040u, 0x00000020u, 0x00000010u, 0x00000008u, 0x00000004u, 0x00000002u, 0x00000001u,
+	// dimension 1
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0xF0000000u, 0x88000000u, 0xCC000000u, 0xAA000000u, 0xFF000000u,
+	0x80800000u, 0xC0C00000u, 0xA0A00000u, 0xF0F00000u, 0x88880000u, 0xCCCC0000u, 0xAAAA0000u, 0xFFFF0000u,
+	0x80008000u, 0xC000C000u, 0xA000A000u, 0xF000F000u, 0x88008800u, 0xCC00CC00u, 0xAA00AA00u, 0xFF00FF00u,
+	0x80808080u, 0xC0C0C0C0u, 0xA0A0A0A0u, 0xF0F0F0F0u, 0x88888888u, 0xCCCCCCCCu, 0xAAAAAAAAu, 0xFFFFFFFFu,
+	// dimension 2
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x90000000u, 0xE8000000u, 0x5C000000u, 0x8E000000u, 0xC5000000u,
+	0x68800000u, 0x9CC00000u, 0xEE600000u, 0x55900000u, 0x80680000u, 0xC09C0000u, 0x60EE0000u, 0x90550000u,
+	0xE8808000u, 0x5CC0C000u, 0x8E606000u, 0xC5909000u, 0x6868E800u, 0x9C9C5C00u, 0xEEEE8E00u, 0x5555C500u,
+	0x8000E880u, 0xC0005CC0u, 0x60008E60u, 0x9000C590u, 0xE8006868u, 0x5C009C9Cu, 0x8E00EEEEu, 0xC5005555u,
+	// dimension 3
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x50000000u, 0xF8000000u, 0x74000000u, 0xA2000000u, 0x93000000u,
+	0xD8800000u, 0x25400000u, 0x59E00000u, 0xE6D00000u, 0x78080000u, 0xB40C0000u, 0x82020000u, 0xC3050000u,
+	0x208F8000u, 0x51474000u, 0xFBEA2000u, 0x75D93000u, 0xA0858800u, 0x914E5400u, 0xDBE79E00u, 0x25DB6D00u,
+	0x58800080u, 0xE54000C0u, 0x79E00020u, 0xB6D00050u, 0x800800F8u, 0xC00C0074u, 0x200200A2u, 0x50050093u,
+	// dimension 4
+	0x80000000u, 0x40000000u, 0x20000000u, 0xB0000000u, 0xF8000000u, 0xDC000000u, 0x7A000000u, 0x9D000000u,
+	0x5A800000u, 0x2FC00000u, 0xA1600000u, 0xF0B00000u, 0xDA880000u, 0x6FC40000u, 0x81620000u, 0x40BB0000u,
+	0x22878000u, 0xB3C9C000u, 0xFB65A000u, 0xDDB2D000u, 0x78022800u, 0x9C0B3C00u, 0x5A0FB600u, 0x2D0DDB00u,
+	0xA2878080u, 0xF3C9C040u, 0xDB65A020u, 0x6DB2D0B0u, 0x800228F8u, 0x400B3CDCu, 0x200FB67Au, 0xB00DDB9Du,
+	// dimension 5
+	0x80000000u, 0x40000000u, 0x60000000u, 0x30000000u, 0xC8000000u, 0x24000000u, 0x56000000u, 0xFB000000u,
+	0xE0800000u, 0x70400000u, 0xA8600000u, 0x14300000u, 0x9EC80000u, 0xDF240000u, 0xB6D60000u, 0x8BBB0000u,
+	0x48008000u, 0x64004000u, 0x36006000u, 0xCB003000u, 0x2880C800u, 0x54402400u, 0xFE605600u, 0xEF30FB00u,
+	0x7E48E080u, 0xAF647040u, 0x1EB6A860u, 0x9F8B1430u, 0xD6C81EC8u, 0xBB249F24u, 0x80D6D6D6u, 0x40BBBBBBu,
+	// dimension 6
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0xD0000000u, 0x58000000u, 0x94000000u, 0x3E000000u, 0xE3000000u,
+	0xBE800000u, 0x23C00000u, 0x1E200000u, 0xF3100000u, 0x46780000u, 0x67840000u, 0x78460000u, 0x84670000u,
+	0xC6788000u, 0xA784C000u, 0xD846A000u, 0x5467D000u, 0x9E78D800u, 0x33845400u, 0xE6469E00u, 0xB7673300u,
+	0x20F86680u, 0x104477C0u, 0xF8668020u, 0x4477C010u, 0x668020F8u, 0x77C01044u, 0x8020F866u, 0xC0104477u,
+	// dimension 7
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0x88000000u, 0x24000000u, 0x12000000u, 0x2D000000u,
+	0x76800000u, 0x9E400000u, 0x08200000u, 0x64100000u, 0xB2280000u, 0x7D140000u, 0xFEA20000u, 0xBA490000u,
+	0x1A248000u, 0x491B4000u, 0xC4B5A000u, 0xE3739000u, 0xF6800800u, 0xDE400400u, 0xA8200A00u, 0x34100500u,
+	0x3A280880u, 0x59140240u, 0xECA20120u, 0x974902D0u, 0x6CA48768u, 0xD75B49E4u, 0xCC95A082u, 0x87639641u,
+	// dimension 8
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0x28000000u, 0xD4000000u, 0x6A000000u, 0x71000000u,
+	0x38800000u, 0x58400000u, 0xEA200000u, 0x31100000u, 0x98A80000u, 0x08540000u, 0xC22A0000u, 0xE5250000u,
+	0xF2B28000u, 0x79484000u, 0xFAA42000u, 0xBD731000u, 0x18A80800u, 0x48540400u, 0x622A0A00u, 0xB5250500u,
+	0xDAB28280u, 0xAD484D40u, 0x90A426A0u, 0xCC731710u, 0x20280B88u, 0x10140184u, 0x880A04A2u, 0x84350611u,
+	// dimension 9
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xB0000000u, 0x98000000u, 0x94000000u, 0x8A000000u, 0x5B000000u,
+	0x33800000u, 0xD9C00000u, 0x72200000u, 0x3F100000u, 0xC1B80000u, 0xA6EC0000u, 0x53860000u, 0x29F50000u,
+	0x0A3A8000u, 0x1B2AC000u, 0xD392E000u, 0x69FF7000u, 0xEA380800u, 0xAB2C0400u, 0x4BA60E00u, 0xFDE50B00u,
+	0x60028980u, 0xF006C940u, 0x7834E8A0u, 0x241A75B0u, 0x123A8B38u, 0xCF2AC99Cu, 0xB992E922u, 0x82FF78F1u,
+	// dimension 10
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x10000000u, 0x08000000u, 0x6C000000u, 0x9E000000u, 0x23000000u,
+	0x57800000u, 0xADC00000u, 0x7FA00000u, 0x91D00000u, 0x49880000u, 0xCED40000u, 0x880A0000u, 0x2C0F0000u,
+	0x3E0D8000u, 0x3317C000u, 0x5FB06000u, 0xC1F8B000u, 0xE18D8800u, 0xB2D7C400u, 0x1E106A00u, 0x6328B100u,
+	0xF7858880u, 0xBDC3C2C0u, 0x77BA63E0u, 0xFDF7B330u, 0xD7800DF8u, 0xEDC0081Cu, 0xDFA0041Au, 0x81D00A2Du,
+	// dimension 11
+	0x80000000u, 0x40000000u, 0x20000000u, 0x30000000u, 0x58000000u, 0xAC000000u, 0x96000000u, 0x2B000000u,
+	0xD4800000u, 0x09400000u, 0xE2A00000u, 0x52500000u, 0x4E280000u, 0xC71C0000u, 0x629E0000u, 0x12670000u,
+	0x6E138000u, 0xF731C000u, 0x3A98A000u, 0xBE449000u, 0xF83B8800u, 0xDC2DC400u, 0xEE06A200u, 0xB7239300u,
+	0x1AA80D80u, 0x8E5C0EC0u, 0xA03E0B60u, 0x703701B0u, 0x783B88C8u, 0x9C2DCA54u, 0xCE06A74Au, 0x87239795u,
+	// dimension 12
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x50000000u, 0xF8000000u, 0x8C000000u, 0xE2000000u, 0x33000000u,
+	0x0F800000u, 0x21400000u, 0x95A00000u, 0x5E700000u, 0xD8080000u, 0x1C240000u, 0xBA160000u, 0xEF370000u,
+	0x15868000u, 0x9E6FC000u, 0x781B6000u, 0x4C349000u, 0x420E8800u, 0x630BCC00u, 0xF7AD6A00u, 0xAD739500u,
+	0x77800780u, 0x6D4004C0u, 0xD7A00420u, 0x3D700630u, 0x2F880F78u, 0xB1640AD4u, 0xCDB6077Au, 0x824706D7u,
+	// dimension 13
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x90000000u, 0x38000000u, 0xC4000000u, 0x42000000u, 0xA3000000u,
+	0xF1800000u, 0xAA400000u, 0xFCE00000u, 0x85100000u, 0xE0080000u, 0x500C0000u, 0x58060000u, 0x54090000u,
+	0x7A038000u, 0x670C4000u, 0xB3842000u, 0x094A3000u, 0x0D6F1800u, 0x2F5AA400u, 0x1CE7CE00u, 0xD5145100u,
+	0xB8000080u, 0x040000C0u, 0x22000060u, 0x33000090u, 0xC9800038u, 0x6E4000C4u, 0xBEE00042u, 0x261000A3u,
+	// dimension 14
+	0x80000000u, 0x40000000u, 0x20000000u, 0xF0000000u, 0xA8000000u, 0x54000000u, 0x9A000000u, 0x9D000000u,
+	0x1E800000u, 0x5CC00000u, 0x7D200000u, 0x8D100000u, 0x24880000u, 0x71C40000u, 0xEBA20000u, 0x75DF0000u,
+	0x6BA28000u, 0x35D14000u, 0x4BA3A000u, 0xC5D2D000u, 0xE3A16800u, 0x91DB8C00u, 0x79AEF200u, 0x0CDF4100u,
+	0x672A8080u, 0x50154040u, 0x1A01A020u, 0xDD0DD0F0u, 0x3E83E8A8u, 0xACCACC54u, 0xD52D529Au, 0xD91D919Du,
+	// dimension 15
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xD0000000u, 0xD8000000u, 0xC4000000u, 0x46000000u, 0x85000000u,
+	0xA5800000u, 0x76C00000u, 0xADA00000u, 0x6AB00000u, 0x2DA80000u, 0xAABC0000u, 0x0DAA0000u, 0x7AB10000u,
+	0xD5A78000u, 0xBEBD4000u, 0x93A3E000u, 0x3BB51000u, 0x3629B800u, 0x4D727C00u, 0x9B836200u, 0x27C4D700u,
+	0xB629B880u, 0x8D727CC0u, 0xBB836220u, 0xF7C4D7D0u, 0x6E29B858u, 0x49727C04u, 0xFD836266u, 0x72C4D755u,
+	// dimension 16
+	0x80000000u, 0x40000000u, 0x20000000u, 0xF0000000u, 0x38000000u, 0x14000000u, 0xF6000000u, 0x67000000u,
+	0x8F800000u, 0x50400000u, 0x8AA00000u, 0x0FF00000u, 0x12A80000u, 0xABF40000u, 0xFCAA0000u, 0x28FB0000u,
+	0xBD298000u, 0x0BBA4000u, 0x4E06E000u, 0x330C3000u, 0x59861800u, 0xC74D3400u, 0x3D2CB200u, 0x4BB2CB00u,
+	0x6E061880u, 0xC30D3440u, 0x618CB220u, 0xD342CBF0u, 0xCB2E18B8u, 0x2CB93454u, 0xE186B2D6u, 0x9349CB97u,
+	// dimension 17
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xF0000000u, 0x68000000u, 0x64000000u, 0x36000000u, 0x6D000000u,
+	0x41800000u, 0xE0400000u, 0xD2E00000u, 0x9BF00000u, 0x0CE80000u, 0x52FC0000u, 0x5B6A0000u, 0x2FB30000u,
+	0xA00C8000u, 0x30054000u, 0x4807E000u, 0x940F9000u, 0x5E01F800u, 0x090E9400u, 0x778A5600u, 0x8D416B00u,
+	0x9369F880u, 0x7BB294C0u, 0xDE005620u, 0xC9026BF0u, 0x578D78E8u, 0x7D4BD4A4u, 0xFB6DB616u, 0x1FBEFB9Du,
+	// dimension 18
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0x98000000u, 0xF4000000u, 0xAE000000u, 0xBB000000u,
+	0xE7800000u, 0x95C00000u, 0x1C200000u, 0xD0300000u, 0xDBA80000u, 0x55F40000u, 0xFF820000u, 0x21C10000u,
+	0x12238000u, 0x3B3A4000u, 0xA42B6000u, 0x3430F000u, 0x4DA69800u, 0x4AF3EC00u, 0x2E043A00u, 0xFB0A1F00u,
+	0x47851880u, 0xC5C9AC40u, 0x842F5AA0u, 0x243AEF50u, 0x75A38018u, 0xEEFA40B4u, 0x180B600Eu, 0xB400F0EBu,
+	// dimension 19
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xB0000000u, 0xB8000000u, 0x3C000000u, 0xCE000000u, 0x41000000u,
+	0x21800000u, 0x51C00000u, 0x09600000u, 0x85700000u, 0xF2780000u, 0x8E9C0000u, 0x60020000u, 0x70030000u,
+	0x58038000u, 0x8C02C000u, 0x7602E000u, 0x7D00F000u, 0xEF833800u, 0x10C10400u, 0x28E08600u, 0xD4B14700u,
+	0xFB182580u, 0x0BEE15C0u, 0x9279C9E0u, 0xFE9D3A70u, 0x38000008u, 0xFC00000Cu, 0x2E00000Eu, 0xF100000Bu,
+	// dimension 20
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xD0000000u, 0x68000000u, 0x3C000000u, 0x8A000000u, 0x51000000u,
+	0xA9800000u, 0xDDC00000u, 0x5BA00000u, 0x39D00000u, 0x95F80000u, 0x56D40000u, 0x0A020000u, 0x91030000u,
+	0x49838000u, 0x0DC34000u, 0x33A1A000u, 0x05D0F000u, 0x1FFA2800u, 0x07D54400u, 0xA380A600u, 0x4CC07700u,
+	0x1222EE80u, 0x3413A740u, 0xA65BF7E0u, 0x5305AB50u, 0x15F80008u, 0x96D4000Cu, 0xEA02000Eu, 0x4103000Du,
+	// dimension 21
+	0x80000000u, 0x40000000u, 0x60000000u, 0xD0000000u, 0x38000000u, 0x8C000000u, 0x7E000000u, 0x71000000u,
+	0xC8800000u, 0x04C00000u, 0x1BA00000u, 0xBB700000u, 0x4A980000u, 0xC3BC0000u, 0xA6020000u, 0x6D010000u,
+	0xEE818000u, 0x29C34000u, 0x9520E000u, 0x42B23000u, 0xE7B9F800u, 0x0D0DC400u, 0x3FB92200u, 0x110D1300u,
+	0x19BBEE80u, 0x3C0CADC0u, 0x973A4A60u, 0xC5CF7EF0u, 0x3A180008u, 0x0B7C0004u, 0xA3A20006u, 0x7771000Du,
+	// dimension 22
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x90000000u, 0x08000000u, 0x64000000u, 0x6A000000u, 0x89000000u,
+	0xA5800000u, 0xCB400000u, 0x18200000u, 0xAD900000u, 0xAF880000u, 0x72F40000u, 0x25820000u, 0x0B430000u,
+	0xB8228000u, 0x3D924000u, 0xA7882000u, 0x16F59000u, 0x4F83A800u, 0x82412400u, 0x1DA01600u, 0xF6D16D00u,
+	0xBFA84080u, 0xBB672640u, 0xE0091620u, 0xF0B4EFD0u, 0x38228008u, 0xFD92400Cu, 0x0788200Au, 0x86F59009u,
+	// dimension 23
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xD0000000u, 0x48000000u, 0x8C000000u, 0xD6000000u, 0x39000000u,
+	0xD5800000u, 0x32400000u, 0xB2A00000u, 0x72100000u, 0x53D80000u, 0x82CC0000u, 0xCB820000u, 0x47430000u,
+	0x91208000u, 0xA9534000u, 0x7CF92000u, 0x4E9E3000u, 0xFCF95800u, 0x8E9FE400u, 0xDCF9D600u, 0x5E9C8900u,
+	0x94F96A80u, 0xD29FB840u, 0x42F9B760u, 0xEB9C9F30u, 0x97788008u, 0xD9DF400Cu, 0x25DB2002u, 0xABCD300Du,
+	// dimension 24
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x50000000u, 0xD8000000u, 0xF4000000u, 0x3E000000u, 0x95000000u,
+	0x8F800000u, 0x3D400000u, 0xF3200000u, 0x2EF00000u, 0xADC80000u, 0x0A0C0000u, 0x8B220000u, 0x4AF30000u,
+	0x6BC88000u, 0x3B0D4000u, 0xE2A16000u, 0x16B0D000u, 0x29687800u, 0xBDBF1400u, 0x33CB5E00u, 0x0F0C2500u,
+	0xFCA1B480u, 0xD3B0AFC0u, 0x7EEB6920u, 0x74FE4D30u, 0xFEE87808u, 0xB4FF140Cu, 0xDEEB5E02u, 0xE4FC2505u,
+	// dimension 25
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xB0000000u, 0x98000000u, 0xA4000000u, 0x7A000000u, 0xD5000000u,
+	0x02800000u, 0x60400000u, 0x51E00000u, 0x88700000u, 0x8C280000u, 0x47C40000u, 0x0BE20000u, 0xAD710000u,
+	0xB6AA8000u, 0x3386C000u, 0xB8006000u, 0x54039000u, 0x42036800u, 0xC1019400u, 0xE0826A00u, 0x11431100u,
+	0x2960AF80u, 0x3D3175C0u, 0xDF4A3AA0u, 0xAFF49E10u, 0xD62B6808u, 0x62C59404u, 0x31606A0Au, 0xD932110Bu,
+	// dimension 26
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x30000000u, 0x18000000u, 0x34000000u, 0x8A000000u, 0x9D000000u,
+	0x67800000u, 0x82400000u, 0x40E00000u, 0x60F00000u, 0x91480000u, 0x29440000u, 0x2D620000u, 0xBFB30000u,
+	0x162A8000u, 0xFBF4C000u, 0xE4CA6000u, 0xC207D000u, 0x2002A800u, 0xF001B400u, 0xB8037E00u, 0x04021900u,
+	0x92034B80u, 0xA90327C0u, 0xED81F320u, 0x1F40D810u, 0x27602808u, 0xE2B1740Cu, 0xD1AB1E0Au, 0x49B6C903u,
+	// dimension 27
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xD0000000u, 0x08000000u, 0x4C000000u, 0x02000000u, 0xB5000000u,
+	0x36800000u, 0xC2C00000u, 0x14200000u, 0x07500000u, 0x1BF80000u, 0x50340000u, 0x48A20000u, 0xAC910000u,
+	0xD35B8000u, 0xBCA74000u, 0x7BFA2000u, 0xC0343000u, 0xA0A18800u, 0x30909400u, 0xD95B7A00u, 0x45A57B00u,
+	0x4F7A7880u, 0xB7F6F940u, 0x82013DE0u, 0xF502DFD0u, 0xD6820808u, 0x12C3D404u, 0x1C235A0Eu, 0x4B504B0Du,
+	// dimension 28
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x50000000u, 0x68000000u, 0x4C000000u, 0x76000000u, 0xF7000000u,
+	0x36800000u, 0xD7400000u, 0x87E00000u, 0xEF300000u, 0xA3A80000u, 0xD5440000u, 0x23AA0000u, 0x15470000u,
+	0xC3A98000u, 0x45464000u, 0xABA82000u, 0x09477000u, 0xDDA9F800u, 0xFE44AC00u, 0xEB292200u, 0x2907F100u,
+	0x6CCB3D80u, 0xC6344DC0u, 0xCF61B320u, 0x137318D0u, 0xECCB3D88u, 0x06344DCCu, 0x2F61B32Eu, 0x437318D5u,
+	// dimension 29
+	0x80000000u, 0x40000000u, 0x60000000u, 0x90000000u, 0xC8000000u, 0x74000000u, 0x52000000u, 0x03000000u,
+	0xEB800000u, 0x6F400000u, 0x64600000u, 0xDAF00000u, 0x17980000u, 0x297C0000u, 0xA59A0000u, 0xFA7D0000u,
+	0xE61B8000u, 0x713F4000u, 0x1878A000u, 0xDCCE9000u, 0xB661E800u, 0x99F29C00u, 0x9C184600u, 0xD63E2100u,
+	0x09FA5780u, 0x548E0AC0u, 0xA380A9E0u, 0x5B413F30u, 0x56625788u, 0x49F20AC4u, 0x341AA9E6u, 0x323C3F39u,
+	// dimension 30
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0xD0000000u, 0xB8000000u, 0x04000000u, 0x6E000000u, 0x97000000u,
+	0xF2800000u, 0xEDC00000u, 0x13600000u, 0x5C900000u, 0xDB580000u, 0x31E40000u, 0x09DA0000u, 0xCC270000u,
+	0x02B88000u, 0x44B44000u, 0x0FE26000u, 0xE6505000u, 0x9AB9D800u, 0x50B50C00u, 0x79E29200u, 0xA552FB00u,
+	0xBE38BF80u, 0x2E77D940u, 0xF6000AE0u, 0x830112D0u, 0x84803F88u, 0xAEC3994Cu, 0x37E26AEAu, 0x225142DDu,
+	// dimension 31
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x30000000u, 0x68000000u, 0xEC000000u, 0x22000000u, 0x2B000000u,
+	0x36800000u, 0x9D400000u, 0x6A200000u, 0x16700000u, 0x4DE80000u, 0x330C0000u, 0x936A0000u, 0x824F0000u,
+	0x3B498000u, 0x8F3FC000u, 0x28202000u, 0xCD707000u, 0xF36AA800u, 0x724FDC00u, 0xB34BF200u, 0x533E6900u,
+	0x62207A80u, 0x0A7140C0u, 0xE7EA6520u, 0xC40D90F0u, 0xEFE9FA88u, 0xD80E80CCu, 0x45EA452Eu, 0x2F0DE0F3u,
+	// dimension 32
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x30000000u, 0x28000000u, 0xD4000000u, 0x8A000000u, 0xFF000000u,
+	0x84800000u, 0x73C00000u, 0x13200000u, 0xC2B00000u, 0xFB380000u, 0x361C0000u, 0x401A0000u, 0xE0AF0000u,
+	0x11228000u, 0x19B3C000u, 0xFDB82000u, 0x5EDF9000u, 0x75B88800u, 0x7ADFAC00u, 0xF7BABA00u, 0x61DDF300u,
+	0xD1387E80u, 0x391E55C0u, 0xCC9BA860u, 0x776CBEB0u, 0xA000F688u, 0xF001F9CCu, 0x08011262u, 0xE4014DB3u,
+	// dimension 33
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0xB8000000u, 0x84000000u, 0x1A000000u, 0xAF000000u,
+	0xBD800000u, 0xDFC00000u, 0x14E00000u, 0x43500000u, 0xDA380000u, 0x4E1C0000u, 0x4CDA0000u, 0x364D0000u,
+	0x29608000u, 0xDC904000u, 0x6ED86000u, 0x5D4F5000u, 0x2EE08800u, 0xFC51AC00u, 0x7FB81E00u, 0x45DC8300u,
+	0xFA3A4580u, 0x5E1D6240u, 0x54DBD360u, 0xE24EC930u, 0x8B62CD88u, 0xF790CE44u, 0xC959CD6Au, 0x2D8F4A35u,
+	// dimension 34
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x70000000u, 0x08000000u, 0xF4000000u, 0xF6000000u, 0x8B000000u,
+	0xC9800000u, 0x55400000u, 0x67200000u, 0xF3F00000u, 0x34780000u, 0x57440000u, 0x1ADA0000u, 0xB1F50000u,
+	0xA9818000u, 0x6540C000u, 0x8F23A000u, 0x77F21000u, 0xCA7BF800u, 0x2845FC00u, 0x255AFE00u, 0x6FB67900u,
+	0x07233A80u, 0xC3F25AC0u, 0xDC7AED60u, 0xD34482D0u, 0xE4D94288u, 0xCEF766C4u, 0x9603B36Eu, 0xBB00EBD7u,
+	// dimension 35
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x90000000u, 0x68000000u, 0xF4000000u, 0x62000000u, 0xDF000000u,
+	0x79800000u, 0xDD400000u, 0x76E00000u, 0x2CF00000u, 0xCFB80000u, 0x51EC0000u, 0xC8DA0000u, 0x845D0000u,
+	0x9B818000u, 0x42434000u, 0xEF622000u, 0x61B19000u, 0xD1582800u, 0x891CAC00u, 0x65626E00u, 0x0AB10900u,
+	0x2ADBBD80u, 0x1B5D86C0u, 0x02014560u, 0x0F032470u, 0xF1821588u, 0xB9426AC4u, 0x7CE10B6Eu, 0x07F3BD79u,
+	// dimension 36
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x50000000u, 0x18000000u, 0xDC000000u, 0x42000000u, 0x37000000u,
+	0x20800000u, 0xF1400000u, 0x28600000u, 0x94900000u, 0x87880000u, 0xA83C0000u, 0x556A0000u, 0xE6EF0000u,
+	0xF8038000u, 0x4C024000u, 0x3A01E000u, 0xBB023000u, 0x7A816800u, 0x1A43AC00u, 0x4AE18A00u, 0x52D31900u,
+	0x8F682380u, 0xCDED9740u, 0xFA80BFA0u, 0xDA43F2B0u, 0x2AE2CB88u, 0x02D07B4Cu, 0x976AD5A6u, 0x11EDDBB5u,
+	// dimension 37
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xF0000000u, 0xF8000000u, 0x34000000u, 0x62000000u, 0xF5000000u,
+	0xA8800000u, 0xFCC00000u, 0x8E200000u, 0x53F00000u, 0xC7780000u, 0x95740000u, 0xB8020000u, 0xD4E50000u,
+	0xB2808000u, 0xFDC0C000u, 0x64A02000u, 0xAA30F000u, 0x19D8F800u, 0x0E443400u, 0x935A6200u, 0xE761F500u,
+	0x657A2880u, 0x40913CC0u, 0xE0022E20u, 0xD0E563F0u, 0x08809F78u, 0xCCC09174u, 0x56200202u, 0x97F0E5E5u,
+	// dimension 38
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0xF0000000u, 0xF8000000u, 0xEC000000u, 0x7E000000u, 0x61000000u,
+	0x5C800000u, 0xE6C00000u, 0xDDA00000u, 0x2A700000u, 0x93380000u, 0x13CC0000u, 0xD3CE0000u, 0x73790000u,
+	0x83A08000u, 0x7B70C000u, 0x97B8A000u, 0xE90CF000u, 0x886EF800u, 0xD409EC00u, 0x3218FE00u, 0xEF7CA100u,
+	0xC556FC80u, 0x56C516C0u, 0x4556A5A0u, 0x96C50670u, 0xE556CD38u, 0x66C542CCu, 0x1D56574Eu, 0x8AC549B9u,
+	// dimension 39
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xB0000000u, 0x58000000u, 0x2C000000u, 0x9A000000u, 0xF9000000u,
+	0x3C800000u, 0xB2C00000u, 0xAD200000u, 0x3A300000u, 0x89980000u, 0x448C0000u, 0x2EEA0000u, 0x6F810000u,
+	0xEF208000u, 0x2F30C000u, 0x0F182000u, 0xBF4CB000u, 0xE74A5800u, 0xCB712C00u, 0x51981A00u, 0xA88C3900u,
+	0x94EA1C80u, 0x268102C0u, 0x8BA07520u, 0xB1F0D630u, 0x38383398u, 0x7C7C0D8Cu, 0x52524A6Au, 0x3D3DF141u,
+	// dimension 40
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xB0000000u, 0xD8000000u, 0xAC000000u, 0x8E000000u, 0x09000000u,
+	0x9E800000u, 0xA1C00000u, 0xCAA00000u, 0x33700000u, 0x95780000u, 0x085C0000u, 0x24B60000u, 0x6A350000u,
+	0x43788000u, 0x6D5CC000u, 0x14362000u, 0x72F5B000u, 0xCF585800u, 0x53EC6C00u, 0xC5EEAE00u, 0x40D9B900u,
+	0xE016C680u, 0x9045CDC0u, 0x6880E4A0u, 0x74C04A70u, 0x2220F3F8u, 0x87B0B59Cu, 0x9758B816u, 0x3FECFC45u,
+	// dimension 41
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xF0000000u, 0xA8000000u, 0x2C000000u, 0xA2000000u, 0x2D000000u,
+	0xDA800000u, 0xF9400000u, 0xEC600000u, 0x02B00000u, 0x3D480000u, 0x825C0000u, 0x7D4A0000u, 0x62610000u,
+	0x8DC88000u, 0xCA1C4000u, 0xA1AAE000u, 0x6891F000u, 0x8C602800u, 0xB2B06C00u, 0x75484200u, 0x5E5CDD00u,
+	0x774A7280u, 0x6361D540u, 0xF548CE60u, 0x1E5C6FB0u, 0x974A07C8u, 0x93618B1Cu, 0x5D48B92Au, 0x325C0CD1u,
+	// dimension 42
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x30000000u, 0xC8000000u, 0x7C000000u, 0x82000000u, 0x4F000000u,
+	0xBE800000u, 0xEDC00000u, 0x21600000u, 0xAB700000u, 0x78680000u, 0x746C0000u, 0x1E9A0000u, 0xFDCB0000u,
+	0x39088000u, 0x2F1CC000u, 0x4EF2E000u, 0xC5A73000u, 0x6D924800u, 0xE1D7BC00u, 0x4B7AE200u, 0x487BBF00u,
+	0xBC801680u, 0x62C061C0u, 0x7FE08B60u, 0x76B0A870u, 0x91088CE8u, 0xA31CAAACu, 0xE4F2037Au, 0xC6A7F47Bu,
+	// dimension 43
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x10000000u, 0x98000000u, 0x2C000000u, 0x06000000u, 0xCD000000u,
+	0x8A800000u, 0x1BC00000u, 0xFFA00000u, 0xAD500000u, 0x7AF80000u, 0xB3DC0000u, 0x5B2E0000u, 0x1F290000u,
+	0x9D588000u, 0xF28CC000u, 0x07D62000u, 0x71F51000u, 0xD4F61800u, 0xDA65EC00u, 0x632EA600u, 0xE3291D00u,
+	0x2358B280u, 0x038CE7C0u, 0x135641A0u, 0x8B355C50u, 0xA7D6EE78u, 0xA1F5891Cu, 0x6CF6880Eu, 0xE665B4B9u,
+	// dimension 44
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x90000000u, 0x98000000u, 0x54000000u, 0x3A000000u, 0x9D000000u,
+	0x7E800000u, 0x7F400000u, 0x17200000u, 0xAB500000u, 0x6DF80000u, 0x96A40000u, 0x83D20000u, 0x71E10000u,
+	0xC0D88000u, 0xE0F44000u, 0x30AAA000u, 0x08059000u, 0xCC2A1800u, 0x6E451400u, 0xA78A1A00u, 0xE3554D00u,
+	0x01D2C680u, 0x68E1FB40u, 0xBC589520u, 0xC6B4B250u, 0xFB0A1178u, 0x1515B0E4u, 0xF272C872u, 0xB1F12CF1u,
+	// dimension 45
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xB0000000u, 0x08000000u, 0x84000000u, 0xB2000000u, 0xB9000000u,
+	0xBE800000u, 0x4FC00000u, 0x55600000u, 0xF8F00000u, 0xAC280000u, 0x66D40000u, 0xB30A0000u, 0x8BB50000u,
+	0xC7C88000u, 0x11E4C000u, 0xAA42E000u, 0xA591B000u, 0xD0EA8800u, 0x78854400u, 0x6C80D200u, 0x86C0C900u,
+	0x03E05680u, 0x83307BC0u, 0x4348EF60u, 0xA324C5F0u, 0x13A2A0A8u, 0x1BA19014u, 0x9F22D8EAu, 0x2D61FC85u,
+	// dimension 46
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x30000000u, 0x78000000u, 0x24000000u, 0x9E000000u, 0x47000000u,
+	0x67800000u, 0xF7400000u, 0xDF200000u, 0xB3100000u, 0x71680000u, 0x8C4C0000u, 0x32520000u, 0xE5D50000u,
+	0xAA528000u, 0x31D5C000u, 0x2C52E000u, 0x62D5F000u, 0xADD29800u, 0xF695D400u, 0x8B720600u, 0xF5C59300u,
+	0x42BA6180u, 0x3DD96440u, 0xDEA0BEA0u, 0xE750D750u, 0x37C84FC8u, 0xBF1C9B1Cu, 0x839A1D9Au, 0x09C94EC9u,
+	// dimension 47
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xB0000000u, 0x78000000u, 0x9C000000u, 0xEE000000u, 0x1B000000u,
+	0xCB800000u, 0xC3400000u, 0xC7A00000u, 0x05100000u, 0x88680000u, 0xC4740000u, 0x225A0000u, 0x3DA10000u,
+	0x345A8000u, 0x7AA1C000u, 0xF1DA6000u, 0x12E17000u, 0x85FA1800u, 0x48B1EC00u, 0x2432F600u, 0x92D5F700u,
+	0x45803D80u, 0xA8403440u, 0x94207A20u, 0xEA50F150u, 0xD9C81248u, 0x46648524u, 0x8FB24812u, 0x21952485u,
+	// dimension 48
+	0x80000000u, 0x40000000u, 0x60000000u, 0x10000000u, 0x58000000u, 0x7C000000u, 0xC2000000u, 0xE1000000u,
+	0x0D800000u, 0xD7C00000u, 0x2AA00000u, 0xF5300000u, 0x9BA80000u, 0xC0F40000u, 0x20C60000u, 0x702F0000u,
+	0x48668000u, 0x241F4000u, 0xBE4EE000u, 0x232B5000u, 0xEC28B800u, 0xDA342C00u, 0xFDE6FA00u, 0xDFDF8D00u,
+	0x6EEE1780u, 0x5B1B0AC0u, 0xE0000520u, 0x500093F0u, 0x38008488u, 0x6C008E04u, 0x9A000BCEu, 0x9D00D8EBu,
+	// dimension 49
+	0x80000000u, 0x40000000u, 0x20000000u, 0x30000000u, 0xB8000000u, 0xAC000000u, 0x72000000u, 0xB1000000u,
+	0x03800000u, 0xD2C00000u, 0xC1600000u, 0x9B900000u, 0x4E480000u, 0x0B740000u, 0x864E0000u, 0x3F0B0000u,
+	0x68068000u, 0x447F4000u, 0x7648A000u, 0xE7747000u, 0xD44E9800u, 0xBE0B9C00u, 0xD3864A00u, 0x3ABF5D00u,
+	0xC528D180u, 0xCDE413C0u, 0x99865AE0u, 0x67BFD550u, 0x94A8C528u, 0x9E24CDE4u, 0xE3669986u, 0x82EF67BFu,
+	// dimension 50
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x70000000u, 0x88000000u, 0x44000000u, 0x4A000000u, 0x47000000u,
+	0xDD800000u, 0x42400000u, 0xC3200000u, 0x77100000u, 0x75B80000u, 0x966C0000u, 0x715E0000u, 0xFC950000u,
+	0xA6E68000u, 0xD9F9C000u, 0x28386000u, 0x142CB000u, 0x527E6800u, 0xFB853400u, 0x5B5E4200u, 0x0B95C300u,
+	0x1366F780u, 0xAFB9B540u, 0x2918F6A0u, 0x603CC150u, 0xB0469498u, 0x68A9927Cu, 0x34A09B66u, 0xC250EBB9u,
+	// dimension 51
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x50000000u, 0xD8000000u, 0xFC000000u, 0xF6000000u, 0xD5000000u,
+	0xBF800000u, 0x2C400000u, 0xEEE00000u, 0x09700000u, 0x19080000u, 0x21640000u, 0xAD6A0000u, 0xD3130000u,
+	0x22828000u, 0x9707C000u, 0x98E0A000u, 0x1C709000u, 0x8688F800u, 0x5D24AC00u, 0x9B8A2E00u, 0x26632900u,
+	0xCD8AC980u, 0x63633940u, 0x8A0AF160u, 0xE323B530u, 0x4AEA8FE8u, 0xC3534414u, 0x1A623A62u, 0x1B774B77u,
+	// dimension 52
+	0x80000000u, 0x40000000u, 0x60000000u, 0x50000000u, 0x58000000u, 0xAC000000u, 0x6A000000u, 0x85000000u,
+	0xFB800000u, 0xA8C00000u, 0x84200000u, 0xAE300000u, 0x4B080000u, 0xE0740000u, 0x10860000u, 0x388F0000u,
+	0xFC2E8000u, 0x320B4000u, 0x2980E000u, 0x91C01000u, 0x2DA03800u, 0x7FF0FC00u, 0x06A83200u, 0xCF842900u,
+	0x4E2E9180u, 0x5B0B2DC0u, 0xD800FFA0u, 0xEC0046F0u, 0x0A00AF28u, 0xD5001E44u, 0xA380038Eu, 0x04C074FBu,
+	// dimension 53
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x50000000u, 0xE8000000u, 0x44000000u, 0x5E000000u, 0xAD000000u,
+	0xEF800000u, 0x68400000u, 0x84600000u, 0xFE500000u, 0xFD280000u, 0x07F40000u, 0x2C620000u, 0xDA4F0000u,
+	0x53068000u, 0x12DFC000u, 0x6F802000u, 0xA8403000u, 0x24602800u, 0xAE501400u, 0x15283A00u, 0x43F41100u,
+	0x72621780u, 0x774F2B40u, 0xBC86BBE0u, 0x7A9FDA10u, 0xEBE00118u, 0x56100F94u, 0xD948174Au, 0xA9A415FDu,
+	// dimension 54
+	0x80000000u, 0xC0000000u, 0x60000000u, 0xB0000000u, 0x18000000u, 0x04000000u, 0xDA000000u, 0x09000000u,
+	0x22800000u, 0xE8400000u, 0xBC600000u, 0x0E300000u, 0x7B580000u, 0x378C0000u, 0x14C20000u, 0x874D0000u,
+	0x99D48000u, 0xBFB94000u, 0x18802000u, 0x91403000u, 0xE6E01800u, 0x52702C00u, 0x05380600u, 0x34BC0100u,
+	0x971A3680u, 0x51810240u, 0x13F688A0u, 0xDE847A10u, 0x466C8F18u, 0x1745738Cu, 0x91FA26D6u, 0x73F111E3u,
+	// dimension 55
+	0x80000000u, 0x40000000u, 0x20000000u, 0x50000000u, 0x88000000u, 0x9C000000u, 0x2E000000u, 0x05000000u,
+	0xAB800000u, 0x1C400000u, 0x6E200000u, 0x25100000u, 0xFBA80000u, 0x94040000u, 0xF26E0000u, 0x0B070000u,
+	0xFEAA8000u, 0x3FD1C000u, 0xEE202000u, 0x65101000u, 0xDBA80800u, 0xC4041400u, 0x7A6E2200u, 0x97072700u,
+	0xD0AA8B80u, 0x3AD1C140u, 0x45A00AE0u, 0x79501710u, 0xB5881388u, 0xE1141D44u, 0x81C61CEAu, 0x03030201u,
+	// dimension 56
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x50000000u, 0xC8000000u, 0x3C000000u, 0x3E000000u, 0x67000000u,
+	0xF9800000u, 0xCC400000u, 0x66600000u, 0xB3100000u, 0xABA80000u, 0x5D240000u, 0xC4FE0000u, 0xB8CF0000u,
+	0x66BB8000u, 0x71A8C000u, 0x10602000u, 0x28103000u, 0x4C280800u, 0xA6641400u, 0x931E3200u, 0xFB9F0F00u,
+	0x95738F80u, 0xF89CD9C0u, 0x86B61E60u, 0x01BB0310u, 0x880D9198u, 0xDC13F8C4u, 0x4E6DB8EAu, 0xFF03E849u,
+	// dimension 57
+	0x80000000u, 0x40000000u, 0x20000000u, 0xB0000000u, 0x58000000u, 0x44000000u, 0x7E000000u, 0x69000000u,
+	0x5B800000u, 0xDC400000u, 0x5A200000u, 0x87100000u, 0xDAD80000u, 0x9BEC0000u, 0xBC420000u, 0xCA0F0000u,
+	0x6F7C8000u, 0xC6D9C000u, 0xA1A02000u, 0xAB501000u, 0xF8F80800u, 0xE8FC2C00u, 0x409A1600u, 0x7CE31100u,
+	0xF6BE9F80u, 0xB996DA40u, 0xCF7CB6E0u, 0x36D9E710u, 0xD9A03E88u, 0x5F501DC4u, 0xDEF828B6u, 0xC5FC1BFBu,
+	// dimension 58
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xB0000000u, 0x48000000u, 0x74000000u, 0xC2000000u, 0xE7000000u,
+	0xB5800000u, 0xBA400000u, 0x9B200000u, 0xA3D00000u, 0x2F180000u, 0x81840000u, 0xD82A0000u, 0xCC190000u,
+	0x5E078000u, 0xE138C000u, 0xD8982000u, 0x9CC41000u, 0x568A2800u, 0x65892C00u, 0xA23F9200u, 0xB76CDD00u,
+	0xEDAA1080u, 0x365929C0u, 0x65278560u, 0xF2E8C290u, 0xBF8014C8u, 0x694025F4u, 0x4CA01346u, 0x4E9035A1u,
+	// dimension 59
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xF0000000u, 0x98000000u, 0xB4000000u, 0x52000000u, 0x07000000u,
+	0xBF800000u, 0x5A400000u, 0x3B200000u, 0x91D00000u, 0xD3380000u, 0xFDEC0000u, 0x954A0000u, 0x58F10000u,
+	0xB5DF8000u, 0x091DC000u, 0x86B82000u, 0xA4AC1000u, 0x7BEA2800u, 0xD0613C00u, 0x2847A600u, 0x8C61ED00u,
+	0x166A3480u, 0xCD2111C0u, 0x0CE787E0u, 0xB7F1EA90u, 0x667208C8u, 0x151D1974u, 0x1895884Eu, 0x15ECC2BBu,
+	// dimension 60
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x70000000u, 0xF8000000u, 0x4C000000u, 0xA6000000u, 0x89000000u,
+	0x6E800000u, 0x1A400000u, 0x17600000u, 0x4BF00000u, 0xA2F80000u, 0x7C5C0000u, 0x7E360000u, 0x551B0000u,
+	0x40808000u, 0x272D4000u, 0x93982000u, 0x7EAC3000u, 0x524E3800u, 0x43071C00u, 0xD1D6BE00u, 0x75C65300u,
+	0xD7E08980u, 0xACDD5240u, 0xD16003A0u, 0x72F02A90u, 0xD47803D8u, 0x5A1C1DFCu, 0x37563F3Eu, 0xDBEB2E57u,
+	// dimension 61
+	0x80000000u, 0x40000000u, 0x20000000u, 0x30000000u, 0xB8000000u, 0x3C000000u, 0xDE000000u, 0xDF000000u,
+	0x29800000u, 0x32400000u, 0xE9200000u, 0x62900000u, 0x71D80000u, 0x5E3C0000u, 0x9F2E0000u, 0x09E70000u,
+	0x026B8000u, 0x5176C000u, 0x5EF82000u, 0xAFAC1000u, 0x81760800u, 0xB69B0C00u, 0x3BE5AE00u, 0xEB41CF00u,
+	0x33EB9780u, 0x2F36E7C0u, 0xF1D82260u, 0x1E3C1090u, 0xBF2E1C48u, 0x39E71BA4u, 0xBA6B85F6u, 0x6D76EF4Fu,
+	// dimension 62
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xD0000000u, 0xF8000000u, 0x3C000000u, 0x6E000000u, 0x19000000u,
+	0x50800000u, 0xCA400000u, 0x7B200000u, 0xAFD00000u, 0x97A80000u, 0x4B9C0000u, 0x55AE0000u, 0x64EF0000u,
+	0xF0288000u, 0x68524000u, 0x64082000u, 0x820C1000u, 0x8F262800u, 0x75A33400u, 0xF4AEBE00u, 0xA8614F00u,
+	0x842EBB80u, 0xF2215640u, 0xA70E9C20u, 0xB1F15690u, 0xA6A6A8C8u, 0xDF6D40F4u, 0xCD88886Au, 0x68C27FA7u,
+	// dimension 63
+	0x80000000u, 0x40000000u, 0x60000000u, 0xD0000000u, 0xC8000000u, 0xBC000000u, 0x4E000000u, 0x57000000u,
+	0x80800000u, 0x0A400000u, 0xFD200000u, 0x8DB00000u, 0xFFA80000u, 0xA6840000u, 0x110E0000u, 0x4BDF0000u,
+	0x74D78000u, 0xB8724000u, 0x84082000u, 0x8A741000u, 0xBD061800u, 0xEDAB3400u, 0x2FD1B200u, 0x6ED96F00u,
+	0xAD59B380u, 0x05ED45C0u, 0x23FF9820u, 0x38B66690u, 0x8E263548u, 0x771B286Cu, 0x30F9866Au, 0x121D6761u,
+	// dimension 64
+	0x80000000u, 0x40000000u, 0x20000000u, 0xB0000000u, 0xA8000000u, 0xD4000000u, 0xFA000000u, 0xF9000000u,
+	0x92800000u, 0x19400000u, 0x42A00000u, 0x21500000u, 0x8EF80000u, 0xA7040000u, 0x59920000u, 0x36F90000u,
+	0x2B2E8000u, 0xFFD04000u, 0x51922000u, 0x12F91000u, 0x592E8800u, 0x62D06C00u, 0x91120A00u, 0x26B92500u,
+	0x730EB680u, 0xA3C05240u, 0xCFCA2EA0u, 0xB9AD2350u, 0xE6C4A628u, 0x136D5A14u, 0x338E8D1Eu, 0xD7804A91u,
+	// dimension 65
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xB0000000u, 0x58000000u, 0x1C000000u, 0x72000000u, 0x4F000000u,
+	0xA1800000u, 0x77400000u, 0x4DA00000u, 0xBD300000u, 0xAEF80000u, 0x369C0000u, 0x8AB60000u, 0xA8850000u,
+	0x0FE18000u, 0xEA0DC000u, 0xF3362000u, 0x83C51000u, 0xD041B800u, 0xA83DEC00u, 0xA44E3600u, 0xDE191700u,
+	0x6557A480u, 0xF288FFC0u, 0xA4D79E60u, 0x75C8CAD0u, 0x517797E8u, 0x64F8C08Cu, 0xD58F8DDEu, 0x0164EB77u,
+	// dimension 66
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0x88000000u, 0x34000000u, 0xA2000000u, 0x03000000u,
+	0x41800000u, 0xF7400000u, 0x03A00000u, 0x04100000u, 0x9A080000u, 0x4F140000u, 0x0FB20000u, 0xEA550000u,
+	0xD73B8000u, 0x13A1C000u, 0x2C122000u, 0xFE451000u, 0x6533A800u, 0x38B5D400u, 0x09A00200u, 0x23101D00u,
+	0x51880080u, 0xDF5414C0u, 0x67923260u, 0x2E0530D0u, 0xAD13A868u, 0xACE5C1C4u, 0xFB8816E2u, 0xA8543E15u,
+	// dimension 67
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xD0000000u, 0xB8000000u, 0x1C000000u, 0x82000000u, 0xFB000000u,
+	0xED800000u, 0x87400000u, 0xFFA00000u, 0x24300000u, 0xDE480000u, 0x992C0000u, 0xC6E60000u, 0xD2DD0000u,
+	0x64938000u, 0x59A7C000u, 0x01462000u, 0xAAED1000u, 0xD8DBB800u, 0xEB8BF400u, 0x92200E00u, 0xE3701700u,
+	0xC1E81880u, 0x6D1C0AC0u, 0xA0AE1560u, 0x57F126D0u, 0x20759F68u, 0x707AF7CCu, 0x8855ACF2u, 0x740AD79Bu,
+	// dimension 68
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x10000000u, 0x48000000u, 0xAC000000u, 0x06000000u, 0x95000000u,
+	0x05800000u, 0xC9400000u, 0x3BE00000u, 0x08100000u, 0xCC680000u, 0xB6740000u, 0xCD5E0000u, 0xE1A70000u,
+	0x635C8000u, 0xA8E1C000u, 0x98BE2000u, 0x00B73000u, 0x44B4A800u, 0xFED5C400u, 0x25803200u, 0x19401B00u,
+	0xD3E02980u, 0xB4102140u, 0x82681360u, 0x8F741950u, 0xCEDE0F78u, 0xBDE72744u, 0x5D3CB27Au, 0x69B1DFCDu,
+	// dimension 69
+	0x80000000u, 0x40000000u, 0x60000000u, 0xD0000000u, 0xF8000000u, 0x34000000u, 0x1A000000u, 0xFF000000u,
+	0xF3800000u, 0x93400000u, 0x2DA00000u, 0x3E700000u, 0x3D480000u, 0x88CC0000u, 0x52B20000u, 0x8D910000u,
+	0xCE358000u, 0x750CC000u, 0x94922000u, 0x84A11000u, 0x5CDD9800u, 0xD8B0F400u, 0xEAE81E00u, 0xD9BC1D00u,
+	0x047A1E80u, 0x721D0BC0u, 0x532782E0u, 0x0DEDE9D0u, 0x8E6FADE8u, 0x1521E05Cu, 0x44DD8BB2u, 0x7CB0E2E3u,
+	// dimension 70
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x10000000u, 0x28000000u, 0xFC000000u, 0xB2000000u, 0x5B000000u,
+	0x3F800000u, 0x7F400000u, 0x89E00000u, 0x22700000u, 0xB3680000u, 0xA3A40000u, 0xDD360000u, 0xFAAD0000u,
+	0xE1A38000u, 0x7E6EC000u, 0x71562000u, 0xC09D3000u, 0x36AB9800u, 0xCBFAC400u, 0x81682A00u, 0x38A40F00u,
+	0x82B63480u, 0x95ED12C0u, 0x404385E0u, 0xA01EE0D0u, 0x703E2EF8u, 0x38392E5Cu, 0xD41DBB3Au, 0x4E17F339u,
+	// dimension 71
+	0x80000000u, 0x40000000u, 0x60000000u, 0x30000000u, 0x08000000u, 0x4C000000u, 0xF6000000u, 0x7F000000u,
+	0x76800000u, 0x19400000u, 0x11A00000u, 0x7BF00000u, 0x8AF80000u, 0xA7540000u, 0x42AE0000u, 0xCB170000u,
+	0xE4A58000u, 0x8C124000u, 0xD6562000u, 0x2F431000u, 0x4E8B9800u, 0x5D454C00u, 0xABD3A200u, 0xF2E14300u,
+	0x83058580u, 0xC8E243C0u, 0x4A2E27A0u, 0xA1570950u, 0x1585A3E8u, 0xA1A25E3Cu, 0x338E209Eu, 0xA6A73345u,
+	// dimension 72
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x70000000u, 0xB8000000u, 0x7C000000u, 0x4A000000u, 0xF3000000u,
+	0x90800000u, 0x81400000u, 0x5FA00000u, 0xFB900000u, 0x5DD80000u, 0x8CEC0000u, 0x5B360000u, 0xC4B10000u,
+	0xDF338000u, 0x52974000u, 0x166E2000u, 0x891D1000u, 0x7BA5A800u, 0x1DB65C00u, 0x2C858E00u, 0x2B664F00u,
+	0x7CFD9A80u, 0xA31A70C0u, 0x18938220u, 0xE5077350u, 0x19B62368u, 0xFAF11124u, 0x4213A7D6u, 0xD7477CABu,
+	// dimension 73
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xB0000000u, 0x88000000u, 0xD4000000u, 0xEA000000u, 0xB7000000u,
+	0xF5800000u, 0xA5400000u, 0xFEA00000u, 0x7E900000u, 0x3EB80000u, 0x9EF40000u, 0x2E820000u, 0xA6D90000u,
+	0x729D8000u, 0x98C9C000u, 0x2FBA2000u, 0xDA6D1000u, 0x7F3FA800u, 0x81C0EC00u, 0xFF3F8200u, 0xC1C0E500u,
+	0x5F3FB280u, 0x71C0D1C0u, 0xD73F9760u, 0xA5C0E050u, 0x3D3FAF28u, 0x12C0FB64u, 0xC8BFA24Eu, 0xB780EA2Du,
+	// dimension 74
+	0x80000000u, 0x40000000u, 0x20000000u, 0x50000000u, 0x08000000u, 0x34000000u, 0x1A000000u, 0xD1000000u,
+	0xAC800000u, 0x57400000u, 0x43A00000u, 0x18D00000u, 0x0D480000u, 0xB2B40000u, 0xE4620000u, 0x52010000u,
+	0xC5668000u, 0xE6E94000u, 0x8E0A2000u, 0xDB251000u, 0x55EC8800u, 0x9F8C5400u, 0x06C6A200u, 0xBE395D00u,
+	0xA3422E80u, 0x39913040u, 0xB98EA120u, 0xF98D4CD0u, 0xD9A03468u, 0x89D02F74u, 0x81C826F2u, 0xB5F4193Du,
+	// dimension 75
+	0x80000000u, 0x40000000u, 0x60000000u, 0xF0000000u, 0x08000000u, 0xE4000000u, 0xE6000000u, 0x07000000u,
+	0x10800000u, 0x7D400000u, 0x5DA00000u, 0x08F00000u, 0x21180000u, 0x37940000u, 0xFDFA0000u, 0xD8EF0000u,
+	0xB9258000u, 0x2BE14000u, 0xF7C22000u, 0xDDCB1000u, 0x48E79800u, 0x412A7C00u, 0xC7A5A200u, 0xF5A16900u,
+	0x3CE20180u, 0x5F7B2DC0u, 0x2CDF9E20u, 0xE70E5A50u, 0xA0E78CE8u, 0x152A6AFCu, 0x49A58DE6u, 0xE6A17F75u,
+	// dimension 76
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xB0000000u, 0x38000000u, 0xAC000000u, 0xA2000000u, 0xCF000000u,
+	0x57800000u, 0x2FC00000u, 0x63A00000u, 0x51B00000u, 0x16E80000u, 0xD5740000u, 0xF4E20000u, 0xFA130000u,
+	0x33448000u, 0x5DC74000u, 0xC4C4A000u, 0x02077000u, 0xBF64A800u, 0x4FB75C00u, 0x338CA600u, 0xF9C37700u,
+	0x32EE8E80u, 0xE31044C0u, 0x358A1B60u, 0xC0A70F30u, 0x8406A388u, 0x46646B5Cu, 0xD9680E32u, 0x26B40201u,
+	// dimension 77
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x10000000u, 0x78000000u, 0x6C000000u, 0x7E000000u, 0xFF000000u,
+	0x18800000u, 0xC0C00000u, 0x7CA00000u, 0x5AB00000u, 0xD9B80000u, 0xC7040000u, 0x94F20000u, 0x8EED0000u,
+	0xEBE28000u, 0x5676C000u, 0x0B62A000u, 0x3AB6F000u, 0x29C2A800u, 0x8F06F400u, 0x90FAB600u, 0xE4C2EF00u,
+	0x06A8A980u, 0xCF9FD0C0u, 0x2C722FA0u, 0x9E2D20F0u, 0xCF429088u, 0x70C6C65Cu, 0xD4DA8EE6u, 0x6EB2C39Du,
+	// dimension 78
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x30000000u, 0xD8000000u, 0xF4000000u, 0xD2000000u, 0xAB000000u,
+	0x98800000u, 0x90C00000u, 0xECA00000u, 0x82F00000u, 0xE7E80000u, 0x2A040000u, 0xAF3E0000u, 0x32B70000u,
+	0xFFF28000u, 0x7E46C000u, 0x4D72A000u, 0x4186F000u, 0x93528800u, 0x3CB6FC00u, 0x0A9ABE00u, 0x5B82C100u,
+	0xE46C8A80u, 0xFA01EBC0u, 0x27682CA0u, 0x8EC40FF0u, 0x319E3788u, 0x2B471F4Cu, 0x589AA672u, 0x3082D9CDu,
+	// dimension 79
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x30000000u, 0x08000000u, 0x0C000000u, 0x72000000u, 0xF9000000u,
+	0x4A800000u, 0x86C00000u, 0x14E00000u, 0x7DB00000u, 0x0F280000u, 0x8DEC0000u, 0xE70A0000u, 0x11830000u,
+	0xAD578000u, 0xECDEC000u, 0x99B7A000u, 0xE16ED000u, 0x3E9F8800u, 0x5082DC00u, 0xA3958A00u, 0xB401DF00u,
+	0x36421680u, 0x271F2140u, 0xF195A420u, 0x3D01D0F0u, 0xD4C22918u, 0x9DDF139Cu, 0x9F75A0D2u, 0xB5B1EFE7u,
+	// dimension 80
+	0x80000000u, 0x40000000u, 0x60000000u, 0x50000000u, 0x28000000u, 0xE4000000u, 0x1E000000u, 0x0D000000u,
+	0x4F800000u, 0x03C00000u, 0xB9E00000u, 0xCAD00000u, 0xD8780000u, 0xBC2C0000u, 0xE27E0000u, 0x8F410000u,
+	0x90EF8000u, 0xBB1C4000u, 0xE68FA000u, 0x320C5000u, 0xE717B800u, 0x14F04400u, 0xF511B200u, 0xC39D7D00u,
+	0x99803580u, 0xFAC03E40u, 0xA0600660u, 0x70102EB0u, 0x18183018u, 0x9C3C0804u, 0xD2660C06u, 0xF77D1E0Fu,
+	// dimension 81
+	0x80000000u, 0x40000000u, 0x20000000u, 0xB0000000u, 0x38000000u, 0x2C000000u, 0xD2000000u, 0x8D000000u,
+	0x70800000u, 0x14C00000u, 0xB2E00000u, 0x51F00000u, 0xF6280000u, 0x0B740000u, 0x23C20000u, 0x8B7B0000u,
+	0x63858000u, 0xAB51C000u, 0xD3E5A000u, 0x9361D000u, 0xFFADA800u, 0x4125FC00u, 0x72A7A600u, 0x31DAF700u,
+	0x66481280u, 0x83441440u, 0x378A2EA0u, 0x753F0170u, 0x3C8F8A18u, 0x56AEF90Cu, 0xB78A1992u, 0x353F20D1u,
+	// dimension 82
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x50000000u, 0xD8000000u, 0xEC000000u, 0xF2000000u, 0x65000000u,
+	0x87800000u, 0x05C00000u, 0x48A00000u, 0xCB100000u, 0x58F80000u, 0xB3340000u, 0x84D20000u, 0xC9130000u,
+	0xD5F58000u, 0x50944000u, 0x470DA000u, 0xFAA07000u, 0x0E5FB800u, 0xEF736400u, 0x3E8A0E00u, 0xF8371F00u,
+	0x1C5F9280u, 0x1A737640u, 0x010A0B60u, 0x41F71330u, 0x7EFF9748u, 0x58637EF4u, 0x2C7233F6u, 0x92031479u,
+	// dimension 83
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x90000000u, 0x58000000u, 0xC4000000u, 0x66000000u, 0x3B000000u,
+	0x39800000u, 0xD7C00000u, 0x10A00000u, 0xBB700000u, 0xF9F80000u, 0x77F40000u, 0x80A60000u, 0xE30D0000u,
+	0x3DB48000u, 0x11C64000u, 0xBBCCA000u, 0xDAF27000u, 0xEA4A8800u, 0x014F5400u, 0x00A61E00u, 0x230D2500u,
+	0x9DB4A780u, 0x81C65BC0u, 0xE3CCA1E0u, 0x1EF27A30u, 0x8C4A9BC8u, 0x3A4F41ECu, 0x39262A36u, 0xF4CD23D1u,
+	// dimension 84
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x10000000u, 0xB8000000u, 0xB4000000u, 0xFA000000u, 0x47000000u,
+	0xD1800000u, 0x1FC00000u, 0xE2E00000u, 0x94100000u, 0x4A580000u, 0x0F240000u, 0xCD8E0000u, 0xE9BB0000u,
+	0xEBE48000u, 0xF8A64000u, 0xC35CA000u, 0x23925000u, 0xA48A9800u, 0xD50D5400u, 0x3AE03600u, 0x70103900u,
+	0xE8582880u, 0xEC2438C0u, 0x5E0E24E0u, 0x057B3B30u, 0x2284B258u, 0x34767334u, 0xBA64BE4Eu, 0xA766713Du,
+	// dimension 85
+	0x80000000u, 0x40000000u, 0x60000000u, 0x50000000u, 0xB8000000u, 0x14000000u, 0xD2000000u, 0x6D000000u,
+	0x25800000u, 0x73C00000u, 0x54E00000u, 0x38500000u, 0x54380000u, 0xB2440000u, 0x3D7E0000u, 0x9DBF0000u,
+	0x67958000u, 0x86AD4000u, 0x554DA000u, 0x71B95000u, 0xC18BB800u, 0x69824400u, 0xA5801600u, 0x33C00100u,
+	0x34E00280u, 0x68500A40u, 0xEC3813E0u, 0xA64402B0u, 0xEF7E28D8u, 0xF0BF09A4u, 0x42158956u, 0xF56D7E75u,
+	// dimension 86
+	0x80000000u, 0x40000000u, 0xE0000000u, 0xF0000000u, 0x38000000u, 0x2C000000u, 0x86000000u, 0x79000000u,
+	0xE2800000u, 0xD8C00000u, 0xAFE00000u, 0xC0100000u, 0xA0280000u, 0x10140000u, 0xC8720000u, 0x14490000u,
+	0xAA698000u, 0xFF0EC000u, 0x9BA1A000u, 0x3A0AD000u, 0x777B9800u, 0x6F97EC00u, 0x60001600u, 0xB0002700u,
+	0xD8001780u, 0xDC002940u, 0xBE001720u, 0x55002370u, 0x648032D8u, 0xA1C01874u, 0x4D603B52u, 0x18D00231u,
+	// dimension 87
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x30000000u, 0x48000000u, 0x34000000u, 0x3E000000u, 0x1B000000u,
+	0xE0800000u, 0xE2C00000u, 0xD3A00000u, 0xC6500000u, 0xA7080000u, 0x0ACC0000u, 0xF7E60000u, 0x60010000u,
+	0xF0188000u, 0xA80AC000u, 0x0430A000u, 0x7656F000u, 0x2F7E9800u, 0xDECBFC00u, 0xF9880A00u, 0x330C3100u,
+	0x24C62580u, 0x749107C0u, 0xCCB0A5A0u, 0x5096F370u, 0x6ADEA348u, 0x079BFFE4u, 0xC8003D0Au, 0xF4003797u,
+	// dimension 88
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xF0000000u, 0x98000000u, 0x9C000000u, 0x4E000000u, 0x59000000u,
+	0x07800000u, 0xDDC00000u, 0xDEA00000u, 0x1A300000u, 0x23080000u, 0x34A40000u, 0xA13A0000u, 0x8BC50000u,
+	0xDB958000u, 0x73D04000u, 0x57BDA000u, 0x75847000u, 0xFAAFA800u, 0x38154C00u, 0xAC280E00u, 0xF6542B00u,
+	0x35123D80u, 0xD1910D40u, 0x1887B460u, 0x97414630u, 0x9EBA05C8u, 0xFA0517BCu, 0xF335B68Au, 0x5CE040D5u,
+	// dimension 89
+	0x80000000u, 0x40000000u, 0x20000000u, 0x10000000u, 0x08000000u, 0x84000000u, 0x92000000u, 0x91000000u,
+	0xBD800000u, 0x8CC00000u, 0x61600000u, 0xC5B00000u, 0x30D80000u, 0x6F6C0000u, 0x4AF60000u, 0x0A530000u,
+	0x5D2D8000u, 0x8BC04000u, 0x9FDBA000u, 0x45935000u, 0x70F62800u, 0x4F531400u, 0x5AAD8A00u, 0x02006500u,
+	0xD93B8680u, 0x19E35540u, 0x0ECE23E0u, 0xF84F1370u, 0xFC63BD38u, 0x2E4F775Cu, 0x9F5812EEu, 0x32AC3FF7u,
+	// dimension 90
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xF0000000u, 0x78000000u, 0xAC000000u, 0x3A000000u, 0x0D000000u,
+	0xF1800000u, 0x6CC00000u, 0xF5200000u, 0x9DF00000u, 0x76A80000u, 0x08640000u, 0x141A0000u, 0xB6230000u,
+	0xC75F8000u, 0x84944000u, 0x3145A000u, 0xA3B77000u, 0x659A2800u, 0x1AE30C00u, 0x127F9600u, 0xE9645700u,
+	0x3FEDB080u, 0x07D35840u, 0x4B801AE0u, 0xA1C01470u, 0x24A01728u, 0x01302B4Cu, 0xFB883062u, 0x39940D25u,
+	// dimension 91
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x30000000u, 0x98000000u, 0x6C000000u, 0xAA000000u, 0x83000000u,
+	0xD7800000u, 0xC0C00000u, 0xA1600000u, 0x30D00000u, 0x99280000u, 0x8CF40000u, 0x9B4A0000u, 0xFBDB0000u,
+	0x8AE88000u, 0x12644000u, 0x7F42A000u, 0x35AF5000u, 0x87E21800u, 0x28EF1C00u, 0xB5429E00u, 0xC6AF5700u,
+	0x28622C80u, 0xB42F2BC0u, 0x2622A760u, 0x197F5CF0u, 0xCCCA1BB8u, 0x7B1B3704u, 0xCB889C92u, 0x12B443C9u,
+	// dimension 92
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x30000000u, 0x28000000u, 0x8C000000u, 0x2E000000u, 0xC3000000u,
+	0xAE800000u, 0x79C00000u, 0x9D200000u, 0xE5D00000u, 0x0B680000u, 0xD2EC0000u, 0x1FA20000u, 0xE2690000u,
+	0x4D328000u, 0x3DD8C000u, 0xCF30A000u, 0x40A1F000u, 0xDACA3800u, 0x03853C00u, 0xB4109200u, 0x1A71EF00u,
+	0x19222180u, 0xD7A923C0u, 0x9E12B820u, 0x2B08E2B0u, 0x42D8A6E8u, 0x678DF404u, 0x76481612u, 0xC73C010Fu,
+	// dimension 93
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x70000000u, 0x48000000u, 0x6C000000u, 0x4E000000u, 0x3B000000u,
+	0x94800000u, 0xC1C00000u, 0xBE200000u, 0xB3500000u, 0x98880000u, 0xFFDC0000u, 0xCD320000u, 0x4BC10000u,
+	0x17728000u, 0x7AABC000u, 0xEAC8A000u, 0x12B6F000u, 0x56883800u, 0x04DC2C00u, 0x39B20A00u, 0xFA010700u,
+	0xE1528180u, 0xA5FBD5C0u, 0x3C4096A0u, 0xD66ACEB0u, 0x0F3A32A8u, 0x8EDD30A4u, 0x90E083AAu, 0x33FAD423u,
+	// dimension 94
+	0x80000000u, 0x40000000u, 0x60000000u, 0x90000000u, 0x58000000u, 0x44000000u, 0x1A000000u, 0xF1000000u,
+	0x4E800000u, 0xF5C00000u, 0x32600000u, 0x3D100000u, 0x28F80000u, 0xCAA40000u, 0xCFEE0000u, 0x337F0000u,
+	0xBBAD8000u, 0xC14BC000u, 0xA6BBA000u, 0x1990D000u, 0xA4783800u, 0xCA643400u, 0xC90E0E00u, 0x9AAF3500u,
+	0xB7B59080u, 0x873FED40u, 0x69CDB520u, 0x2C5BD130u, 0xB643A738u, 0x0734C634u, 0x299628A6u, 0x4C1B18EDu,
+	// dimension 95
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xF0000000u, 0xC8000000u, 0xE4000000u, 0x42000000u, 0xBD000000u,
+	0x6A800000u, 0x05C00000u, 0x2A200000u, 0x89100000u, 0xF0880000u, 0x64DC0000u, 0x2EB60000u, 0x97830000u,
+	0x4F578000u, 0x3FE7C000u, 0x9B69A000u, 0x55B8F000u, 0x32081800u, 0xB51C0C00u, 0x6E960A00u, 0xB7930500u,
+	0x5F5FA280u, 0x07FBD640u, 0xB77FAA20u, 0xF3EBDE30u, 0xCD778828u, 0x62F7EF34u, 0x01E19CAAu, 0x9864CE73u,
+	// dimension 96
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x10000000u, 0x48000000u, 0xDC000000u, 0x92000000u, 0x53000000u,
+	0x6C800000u, 0x85C00000u, 0x36600000u, 0xE5500000u, 0xC9F80000u, 0xAC6C0000u, 0x8A6A0000u, 0x27570000u,
+	0x32E88000u, 0x0CFBC000u, 0xD5FAA000u, 0x9E00D000u, 0x29181800u, 0x13FC1400u, 0x23722A00u, 0x74AB3300u,
+	0xF19AB680u, 0x6850E3C0u, 0x6C601FA0u, 0x2A5025B0u, 0xD7782EB8u, 0x6AAC1C24u, 0x988A2DE6u, 0x9BC7254Fu,
+	// dimension 97
+	0x80000000u, 0xC0000000u, 0x60000000u, 0xD0000000u, 0x98000000u, 0x6C000000u, 0x2E000000u, 0x71000000u,
+	0x7C800000u, 0xEBC00000u, 0xD2200000u, 0x67500000u, 0xD1D80000u, 0xF1640000u, 0xBC9A0000u, 0x8BD10000u,
+	0x02678000u, 0xFF1AC000u, 0xBDA5A000u, 0xDF6FF000u, 0xCDF83800u, 0xF7340400u, 0xE9C23E00u, 0x2D752F00u,
+	0xDADDAD80u, 0x0E9BC740u, 0x3C9A34A0u, 0x4BD116B0u, 0x6267B3A8u, 0x2F1AD724u, 0x25A586FEu, 0xB36FCE8Du,
+	// dimension 98
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x30000000u, 0xB8000000u, 0xAC000000u, 0x06000000u, 0xFD000000u,
+	0xEF800000u, 0xF8C00000u, 0x8C200000u, 0xF6300000u, 0xE5480000u, 0x73C40000u, 0x46CA0000u, 0xDD750000u,
+	0x1FCD8000u, 0xE0814000u, 0x106FA000u, 0x48007000u, 0xB4200800u, 0x9A303C00u, 0x43480600u, 0xBEC42700u,
+	0x114A2F80u, 0x89B51440u, 0x95EDBA60u, 0xEBB14170u, 0x1AA7B8E8u, 0xC30473BCu, 0x7ECA125Au, 0xB1751D7Du,
+	// dimension 99
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x50000000u, 0x58000000u, 0x14000000u, 0x5A000000u, 0x75000000u,
+	0x6C800000u, 0x87C00000u, 0xDC600000u, 0xF6700000u, 0xCB780000u, 0x4B840000u, 0xD2660000u, 0x79070000u,
+	0x82C78000u, 0xF8E4C000u, 0x9DB9A000u, 0x0917D000u, 0xCAE00800u, 0x14B00400u, 0x83983E00u, 0x7E341100u,
+	0xC77E0080u, 0xA5F31840u, 0xAD598DA0u, 0x38A7FCB0u, 0x7DF80C38u, 0xF9440C6Cu, 0xC2862DC6u, 0x58B73B7Du,
+	// dimension 100
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x70000000u, 0xE8000000u, 0x94000000u, 0x42000000u, 0x7B000000u,
+	0x49800000u, 0x3CC00000u, 0x90200000u, 0x58500000u, 0x1C080000u, 0xA64C0000u, 0xD13E0000u, 0xA6EB0000u,
+	0x375C8000u, 0xD7F94000u, 0x81CAA000u, 0x78CE7000u, 0x2A003800u, 0x2F002C00u, 0x6B802200u, 0x37C03900u,
+	0x31A02A80u, 0xF0903BC0u, 0xCE2802E0u, 0x851C11F0u, 0x84B63668u, 0x3C671924u, 0x7642A30Au, 0x29427F87u,
+	// dimension 101
+	0x80000000u, 0xC0000000u, 0x20000000u, 0xF0000000u, 0x28000000u, 0x14000000u, 0x4A000000u, 0xE3000000u,
+	0x6F800000u, 0x72C00000u, 0x70200000u, 0xE8300000u, 0x34080000u, 0xBA3C0000u, 0xCB0A0000u, 0x7B850000u,
+	0x38D28000u, 0x9318C000u, 0x87ABE000u, 0x46D4B000u, 0xCA000800u, 0x23000C00u, 0x4F800200u, 0x82C00F00u,
+	0x58200280u, 0xFC300140u, 0x7E0804A0u, 0x593C0E30u, 0xA48A06F8u, 0x0945072Cu, 0x48F28702u, 0x7B28CE83u,
+	// dimension 102
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x50000000u, 0x28000000u, 0x9C000000u, 0x7E000000u, 0xFF000000u,
+	0x43800000u, 0x79C00000u, 0xB8200000u, 0x14100000u, 0x52380000u, 0xF9140000u, 0x088A0000u, 0xD8670000u,
+	0x40FF8000u, 0x108FC000u, 0x7C78E000u, 0x6AD27000u, 0x5D800800u, 0x96C00400u, 0x33A00E00u, 0xA1D00500u,
+	0xBC180280u, 0x8E0409C0u, 0x673207E0u, 0xA7B30FF0u, 0xB3D58438u, 0xA538C79Cu, 0xD69F6B82u, 0x9759B141u,
+	// dimension 103
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x70000000u, 0x48000000u, 0x1C000000u, 0xAE000000u, 0xF9000000u,
+	0x6C800000u, 0x95C00000u, 0x7C200000u, 0x3E300000u, 0xE1080000u, 0x489C0000u, 0x6FD20000u, 0x37270000u,
+	0x059B8000u, 0xE1764000u, 0xCDE72000u, 0xB8277000u, 0x94200800u, 0x92300C00u, 0x27080200u, 0xDD9C0700u,
+	0xE5520480u, 0x47E701C0u, 0xBB3B8AE0u, 0xB3864F90u, 0x3C4F26C8u, 0x5B4B795Cu, 0x66DA0FC2u, 0xD3BB0FE3u,
+	// dimension 104
+	0x80000000u, 0x40000000u, 0x60000000u, 0xD0000000u, 0x48000000u, 0xBC000000u, 0x0E000000u, 0xE1000000u,
+	0xB5800000u, 0x3DC00000u, 0x8C200000u, 0xD6100000u, 0x75180000u, 0xD7B40000u, 0x9AD20000u, 0x648F0000u,
+	0x50538000u, 0x25C04000u, 0x38296000u, 0x04157000u, 0x4A200800u, 0xCB100400u, 0xAE980600u, 0xDB740D00u,
+	0xEB720480u, 0x335F0BC0u, 0xA76B80E0u, 0xC5644E10u, 0x62636B58u, 0x8AEE73DCu, 0x0C8180C2u, 0x5C4F4961u,
+	// dimension 105
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0xD0000000u, 0x98000000u, 0x34000000u, 0x12000000u, 0x43000000u,
+	0x04800000u, 0xB8400000u, 0x46200000u, 0x41300000u, 0x3FB80000u, 0x58F40000u, 0x74460000u, 0x701D0000u,
+	0x680C8000u, 0x9C1CC000u, 0x6E132000u, 0xFD051000u, 0x61980800u, 0xEDC40C00u, 0xB9FE0E00u, 0xBBE90D00u,
+	0x80CA8980u, 0x6041C340u, 0x523FA120u, 0x6329D430u, 0x34B32848u, 0xF0751784u, 0xEA000262u, 0x67000513u,
+	// dimension 106
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x50000000u, 0x98000000u, 0xEC000000u, 0x0E000000u, 0x29000000u,
+	0x9F800000u, 0xA9400000u, 0x52200000u, 0x8F300000u, 0x32A80000u, 0x1CD40000u, 0xA8460000u, 0x89AB0000u,
+	0xAC5B8000u, 0x63964000u, 0x5F65E000u, 0x673F5000u, 0xD6880800u, 0xC6E40C00u, 0x336E0A00u, 0xA93F0500u,
+	0x5FBD8980u, 0x094D4EC0u, 0x023660E0u, 0x170D1290u, 0xDEA3E1F8u, 0x12D45694u, 0x81738722u, 0x160241F3u,
+	// dimension 107
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x30000000u, 0xF8000000u, 0xFC000000u, 0x1E000000u, 0x2B000000u,
+	0x67800000u, 0xC5400000u, 0xAB200000u, 0x27900000u, 0x65680000u, 0x9B2C0000u, 0xDFAE0000u, 0x99570000u,
+	0x852B8000u, 0xF4A4C000u, 0xFECEE000u, 0x405AD000u, 0x5FAE0800u, 0xD9570400u, 0x252B8A00u, 0xC4A4C300u,
+	0x06CEEF80u, 0xBC5ADFC0u, 0x41AE09E0u, 0xF25706B0u, 0x42AB8C78u, 0x01E4CF54u, 0xADEEE532u, 0x9BCADDB9u,
+	// dimension 108
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x90000000u, 0x68000000u, 0x9C000000u, 0x06000000u, 0x2F000000u,
+	0xF8800000u, 0x2A400000u, 0x7F200000u, 0x30900000u, 0xC6780000u, 0x81040000u, 0xEB8A0000u, 0xA4DF0000u,
+	0x82458000u, 0x4321C000u, 0x46B12000u, 0x11571000u, 0x8D8A0800u, 0x5BDF0400u, 0xF2C58E00u, 0x6561C900u,
+	0x57912680u, 0x92C719C0u, 0xB5720860u, 0xDF9B06F0u, 0x9EEF8188u, 0xDB6ECBA4u, 0x6C8CA172u, 0x6072DAC9u,
+	// dimension 109
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x70000000u, 0xA8000000u, 0x44000000u, 0xC2000000u, 0x13000000u,
+	0xCF800000u, 0xE2400000u, 0x71200000u, 0x6CB00000u, 0xA5C80000u, 0xA77C0000u, 0x77BA0000u, 0x9E690000u,
+	0x0F048000u, 0x2182C000u, 0x5740E000u, 0x1FA51000u, 0xFA720800u, 0xBD150C00u, 0x9ABE8200u, 0xDCEBC700u,
+	0x3FC46A80u, 0x9867D440u, 0x1E12E420u, 0xDD001D30u, 0x0A8486F8u, 0x24C2C524u, 0xA3E0EF92u, 0xB655158Bu,
+	// dimension 110
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x10000000u, 0x18000000u, 0x7C000000u, 0x8E000000u, 0x6F000000u,
+	0x52800000u, 0x1FC00000u, 0x59200000u, 0x71B00000u, 0x2B780000u, 0x5DE40000u, 0x90160000u, 0xD8170000u,
+	0x9C1F8000u, 0x9E19C000u, 0x770DA000u, 0x2EBB7000u, 0x91EE0800u, 0x36330C00u, 0x23298E00u, 0x34BEC100u,
+	0x04EA2180u, 0xE186B7C0u, 0xF355A0E0u, 0xC1EF7AF0u, 0x0E000328u, 0xAF000CFCu, 0xB2800A12u, 0x0FC001DBu,
+	// dimension 111
+	0x80000000u, 0x40000000u, 0xA0000000u, 0xB0000000u, 0x08000000u, 0xF4000000u, 0xA6000000u, 0x77000000u,
+	0x65800000u, 0xD3C00000u, 0x45200000u, 0xE4900000u, 0xD9680000u, 0xBF4C0000u, 0x28720000u, 0x5DE50000u,
+	0x361D8000u, 0x8F0BC000u, 0x39A26000u, 0x31CE7000u, 0x9C3A0800u, 0x02390400u, 0xC9078A00u, 0x5EA2CB00u,
+	0xEC4DE080u, 0xB3E0BF40u, 0x1525E260u, 0xFCACB370u, 0x9557E458u, 0xE549B23Cu, 0x0D4A66D2u, 0xE9427E09u,
+	// dimension 112
+	0x80000000u, 0xC0000000u, 0x60000000u, 0xD0000000u, 0x48000000u, 0xF4000000u, 0x26000000u, 0x61000000u,
+	0x17800000u, 0x08C00000u, 0xBB200000u, 0x04B00000u, 0xE8580000u, 0x5D540000u, 0x1CC20000u, 0x8D350000u,
+	0x4D958000u, 0xDBE64000u, 0x3BBEE000u, 0x32D4B000u, 0xB83A0800u, 0xCC110C00u, 0x2A2F8600u, 0x2B374D00u,
+	0xECB16480u, 0xAC53FF40u, 0xE3536A60u, 0xC1D6FA10u, 0x489EEF78u, 0x0264B18Cu, 0x16620132u, 0x20450E0Bu,
+	// dimension 113
+	0x80000000u, 0x40000000u, 0xE0000000u, 0x70000000u, 0x78000000u, 0x74000000u, 0x7E000000u, 0x5F000000u,
+	0xD0800000u, 0x75400000u, 0x7D200000u, 0x2D900000u, 0x18F80000u, 0x85FC0000u, 0xD86E0000u, 0xB8950000u,
+	0x496B8000u, 0xEF0DC000u, 0x08BB2000u, 0x9179D000u, 0x0B360800u, 0x7EB90400u, 0xC25D8E00u, 0xD1B4C700u,
+	0x2AE6A780u, 0x30CD1740u, 0x59D0AFE0u, 0x3A7411F0u, 0xE58D2B08u, 0xB4C0D454u, 0x1FEB8652u, 0xF14DC699u,
+	// dimension 114
+	0x80000000u, 0xC0000000u, 0x20000000u, 0x90000000u, 0xC8000000u, 0x24000000u, 0x8E000000u, 0x39000000u,
+	0x6A800000u, 0x60400000u, 0x5AA00000u, 0xF8700000u, 0x96A80000u, 0xC2540000u, 0xE99A0000u, 0xB5DD0000u,
+	0x6D798000u, 0xB6334000u, 0xA5332000u, 0xB8B35000u, 0xAB798800u, 0x6B334C00u, 0x61B32200u, 0x71F35900u,
+	0x53598480u, 0xD7034E40u, 0x23BB2AE0u, 0x72D75A90u, 0x46EB8228u, 0xC0CA4844u, 0xFDF8AF4Au, 0x89491517u,
+	// dimension 115
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0xD0000000u, 0xF8000000u, 0xBC000000u, 0xCA000000u, 0x39000000u,
+	0x13800000u, 0x55400000u, 0xBBA00000u, 0xD1700000u, 0x6D880000u, 0xF2440000u, 0xBF360000u, 0x08AB0000u,
+	0x9BE48000u, 0x5B754000u, 0x34986000u, 0x91EC1000u, 0xC2648800u, 0xF7354C00u, 0x3CB86A00u, 0xC5DC1D00u,
+	0xEC4C8780u, 0x680147C0u, 0x240666A0u, 0x06331E90u, 0xDB1E06B8u, 0x6E9F0294u, 0x30DA8D1Au, 0x1DDA4387u,
+	// dimension 116
+	0x80000000u, 0x40000000u, 0x60000000u, 0x30000000u, 0xF8000000u, 0xE4000000u, 0xFA000000u, 0xAD000000u,
+	0xB6800000u, 0x89C00000u, 0x92A00000u, 0x53D00000u, 0x6FB80000u, 0x2D5C0000u, 0xFA460000u, 0xA1C50000u,
+	0xFEA88000u, 0xD5D64000u, 0xEC992000u, 0x34D23000u, 0x8C088800u, 0xF6064400u, 0x1B212600u, 0xCD8E3300u,
+	0x744E8780u, 0x1EC34A40u, 0xA909A9A0u, 0x3C9879D0u, 0xBCF7ACE8u, 0xF00172DCu, 0xD819288Au, 0xB41238EDu,
+	// dimension 117
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x10000000u, 0x68000000u, 0xE4000000u, 0x86000000u, 0x9D000000u,
+	0xE1800000u, 0xB0C00000u, 0xEDA00000u, 0x12F00000u, 0x16980000u, 0x7E740000u, 0x2FC20000u, 0xC72D0000u,
+	0x56B38000u, 0x5E624000u, 0xDFE7E000u, 0xBF387000u, 0xDA938800u, 0x3C524C00u, 0xC4DFEE00u, 0xC3BC7100u,
+	0x8BC98E80u, 0x610B4240u, 0x3BAE6660u, 0xC7F338D0u, 0xE31DE098u, 0x3091794Cu, 0xD37A00BAu, 0x566905FFu,
+	// dimension 118
+	0x80000000u, 0x40000000u, 0x20000000u, 0x70000000u, 0xA8000000u, 0x34000000u, 0xD2000000u, 0x59000000u,
+	0xD6800000u, 0xF1400000u, 0x9AA00000u, 0x8F500000u, 0xADA80000u, 0x96CC0000u, 0xA9420000u, 0x46A10000u,
+	0x49468000u, 0x56AF4000u, 0xB1672000u, 0xBAA51000u, 0xFF668800u, 0x05BF4400u, 0xA2EF2200u, 0x7B791700u,
+	0x1FAC8280u, 0x9FC24740u, 0xA7E3AF20u, 0x2BEB5290u, 0x35E72FE8u, 0x52E51854u, 0x93468E8Au, 0x0BAF4E65u,
+	// dimension 119
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x90000000u, 0x88000000u, 0xCC000000u, 0x5A000000u, 0x77000000u,
+	0x4E800000u, 0x23400000u, 0xD4A00000u, 0xB4500000u, 0xAA080000u, 0x8F340000u, 0x3A8A0000u, 0xAD570000u,
+	0xBD948000u, 0x1BFEC000u, 0xEACD2000u, 0x41411000u, 0x379C8800u, 0x44CAC400u, 0xF8472A00u, 0xB0161900u,
+	0x58080080u, 0xE43408C0u, 0x060A0FA0u, 0xA5170E70u, 0xF5B48C68u, 0x37EECEF4u, 0x80E528EAu, 0x2E651C35u,
+	// dimension 120
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x70000000u, 0x68000000u, 0xB4000000u, 0xB6000000u, 0x09000000u,
+	0x40800000u, 0xB9400000u, 0x3EA00000u, 0x54700000u, 0x30180000u, 0x482C0000u, 0x24220000u, 0xAE310000u,
+	0xD5378000u, 0x42AF4000u, 0x067DA000u, 0x770C1000u, 0xADAF8800u, 0xB7C34C00u, 0x22FFAE00u, 0x404D1700u,
+	0xD6000E80u, 0xB9000740u, 0xC8800560u, 0x7D400790u, 0xE0A00288u, 0xE97000D4u, 0xC698088Au, 0xF86C05D7u,
+	// dimension 121
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x10000000u, 0xB8000000u, 0xE4000000u, 0x86000000u, 0x8D000000u,
+	0x4B800000u, 0x8EC00000u, 0x79A00000u, 0x1DF00000u, 0xAB180000u, 0xF6B40000u, 0x8D560000u, 0xBB5D0000u,
+	0xBE5F8000u, 0x59F24000u, 0x1D1F6000u, 0x33A2F000u, 0x8AE78800u, 0xEFB64C00u, 0x28D16E00u, 0x048BF100u,
+	0xFE4E0380u, 0x79E90240u, 0xED098660u, 0x9BAF49D0u, 0xD6C0EF38u, 0x8D90B6ACu, 0x23D8E7FAu, 0xC224B50Fu,
+	// dimension 122
+	0x80000000u, 0x40000000u, 0x60000000u, 0xB0000000u, 0x88000000u, 0xBC000000u, 0xBA000000u, 0x6B000000u,
+	0xBB800000u, 0x27400000u, 0x30A00000u, 0x6CD00000u, 0xFFF80000u, 0x505C0000u, 0xA10A0000u, 0x788B0000u,
+	0xF0F88000u, 0x95DBC000u, 0x037D6000u, 0x2EBA9000u, 0x59F28800u, 0x1150C400u, 0x2985E600u, 0x60615B00u,
+	0x690FE080u, 0xA4AA5FC0u, 0xFAD765A0u, 0x76E199B0u, 0x04F20D38u, 0xB3D706B4u, 0x0272862Au, 0xC610C0BDu,
+	// dimension 123
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x50000000u, 0x58000000u, 0x54000000u, 0x56000000u, 0x33000000u,
+	0x54800000u, 0xE4C00000u, 0x17A00000u, 0x18700000u, 0xCF780000u, 0x05C40000u, 0xBE1E0000u, 0xAF290000u,
+	0x6E8F8000u, 0x85DBC000u, 0x7E23A000u, 0xCF057000u, 0x3E918800u, 0xDDF2CC00u, 0x2A2C2600u, 0x991EB500u,
+	0x0D922D80u, 0x8947B940u, 0xCEE5AB60u, 0x8E987A30u, 0x15F80EC8u, 0x4604020Cu, 0xCB3E079Au, 0x309902F7u,
+	// dimension 124
+	0x80000000u, 0x40000000u, 0xA0000000u, 0x30000000u, 0x78000000u, 0xDC000000u, 0xCA000000u, 0x43000000u,
+	0xE3800000u, 0x9C400000u, 0xB8A00000u, 0x73D00000u, 0x06C80000u, 0x1C7C0000u, 0xF8860000u, 0xD3C30000u,
+	0x36E88000u, 0x6445C000u, 0x24BB6000u, 0x19C65000u, 0x75EE8800u, 0x87C6C400u, 0xB8F3EA00u, 0xA1539300u,
+	0x061DEF80u, 0x813C99C0u, 0xA4BB6EA0u, 0x59C65330u, 0xD5EE8BB8u, 0xB7C6C304u, 0xC0F3EAAAu, 0x7D539DCDu,
+	// dimension 125
+	0x80000000u, 0xC0000000u, 0xA0000000u, 0x90000000u, 0x08000000u, 0x5C000000u, 0x3A000000u, 0x2F000000u,
+	0xAC800000u, 0x94C00000u, 0x5FA00000u, 0xC2700000u, 0x44480000u, 0xA1740000u, 0x1AFA0000u, 0xE68B0000u,
+	0x43F08000u, 0x9732C000u, 0xA8A4A000u, 0x5ADD7000u, 0x86AA8800u, 0x73C9CC00u, 0x0F1C2A00u, 0xFC9BB900u,
+	0x3CF42880u, 0x939FB9C0u, 0xF04621A0u, 0x3760B7F0u, 0x37CCA848u, 0xA119798Cu, 0x15B884DAu, 0x1546CE17u,
+	// dimension 126
+	0x80000000u, 0xC0000000u, 0xE0000000u, 0x70000000u, 0x28000000u, 0xC4000000u, 0x3A000000u, 0x9B000000u,
+	0xA1800000u, 0x93400000u, 0xA0A00000u, 0xF9F00000u, 0x2A580000u, 0x560C0000u, 0xA5020000u, 0xE0950000u,
+	0xD9D88000u, 0xBA7DC000u, 0x0E07E000u, 0x49049000u, 0x1E828800u, 0x78E4CC00u, 0x80DD6E00u, 0x3CEC5700u,
+	0x7ADDEA80u, 0x47DD9040u, 0xAB7805A0u, 0xFCBC02B0u, 0xCFFA0698u, 0x3F690274u, 0x7E828B2Au, 0xC8E4CA6Fu,
+	// dimension 127
+	0x80000000u, 0xC0000000u, 0x60000000u, 0x70000000u, 0x28000000u, 0xA4000000u, 0xFE000000u, 0x3D000000u,
+	0x82800000u, 0xB3400000u, 0x05A00000u, 0x42F00000u, 0x41780000u, 0xA28C0000u, 0x63620000u, 0x3D8D0000u,
+	0xBED98000u, 0x33544000u, 0xC5BA2000u, 0x22FE1000u, 0x31638800u, 0x8AA54C00u, 0xC779A600u, 0xC3AB5700u,
+	0x83E22A80u, 0xB1C21640u, 0x76D981E0u, 0x275448D0u, 0x73BA2CA8u, 0xCBFE1674u, 0x65E3853Au, 0xA0E541BFu,
+};
@@ -4,9 +4,60 @@
 #include "Pipeline/RenderGraph/KH_PostProcessGraph.h"
 #include "Utils/KH_Algorithms.h"
 #include "Pipeline/RenderGraph/ScenePass/KH_DrawSobolPass.h"
+#include "Headless/KH_HeadlessRenderer.h"
+#include "Benchmark/KH_Benchmark.h"
+#include "Utils/KH_JobSystem.h"
+#include "Utils/KH_Profiler.h"
+#include "Utils/KH_SobolTable.h"
 
-int main()
+int main(int argc, char** argv)
 {
+	KH_Profiler::Instance().SetThreadName("Render");
+
+	// --export-sobol-table [输出路径] [维数]：从 joe-kuo 文本重新生成内嵌的 Sobol 方向数表，更换方向数文件或维数时使用
+	if (argc >= 2 && std::strcmp(argv[1], "--export-sobol-table") == 0)
+	{
+		const std::string OutputPath = argc >= 3 ? argv[2] : "Source/Utils/KH_SobolTable.h";
+		const uint32_t Dimensions = argc >= 4 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : KH_SOBOL_TABLE_DIMENSIONS;
+		if (Dimensions == 0)
+			return 1;
+
+		return KH_Sobol::ExportDirectionTable("Assert/Miscellaneous/new-joe-kuo-6.21201", OutputPath, Dimensions) ? 0 : 1;
+	}
+
+	// --benchmark：不创建窗口，运行 CPU 微基准与光线回放后写出 JSON / CSV；只有 --gpu 时才创建离屏 GL 上下文
+	if (KH_Benchmark::IsBenchmarkRequested(argc, argv))
+	{
+		KH_BenchmarkSettings Settings;
+		if (!KH_Benchmark::ParseArguments(argc, argv, Settings))
+			return 1;
+
+		KH_JobSystemSettings JobSettings;
+		JobSettings.WorkerCount = Settings.Threads;
+		KH_JobSystem::Instance().Initialize(JobSettings);
+
+		KH_Benchmark Benchmark;
+		return Benchmark.Run(Settings) ? 0 : 1;
+	}
+
+	// --headless：不创建窗口与 ImGui，离屏渲染场景后写出图像
+	if (KH_HeadlessRenderer::IsHeadlessRequested(argc, argv))
+	{
+		KH_HeadlessSettings Settings;
+		if (!KH_HeadlessRenderer::ParseArguments(argc, argv, Settings))
+			return 1;
+
+		KH_JobSystemSettings JobSettings;
+		JobSettings.WorkerCount = Settings.Threads;
+		KH_JobSystem::Instance().Initialize(JobSettings);
+
+		KH_HeadlessRenderer Renderer;
+		return Renderer.Run(Settings) ? 0 : 1;
+	}
+
+	// 先于编辑器创建，所有后台任务与并行循环共用这组工作线程
+	KH_JobSystem::Instance().Initialize();
+
 	KH_Editor::SetEditorWidth(1480);
 	KH_Editor::SetEditorHeight(920);
 	KH_Editor::SetTitle("KH_Renderer");
@@ -29,14 +80,18 @@ int main()
 	{
 		Editor.BeginRender();
 
-		Editor.BindCanvasFramebuffer();
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		// 累积收敛且场景未变时不再派发路径追踪与后处理，画布沿用上一次的最终图像
+		if (!Editor.IsIdleFrame())
+		{
+			Editor.BindCanvasFramebuffer();
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		Editor.Render();
+			Editor.Render();
 
-		Editor.UnbindCanvasFramebuffer();
+			Editor.UnbindCanvasFramebuffer();
 
-		KH_PostProcessHelper::Instance().SingleGammaCorrectionGraph.Execute();
+			KH_PostProcessHelper::Instance().SingleGammaCorrectionGraph.Execute();
+		}
 
 		Editor.EndRender();
 	}